@@ -5,12 +5,18 @@ set -xe
 if [ $CHECK_CLANG_FORMAT ]; then exit 0; fi
 
 mkdir _build ; cd _build
-if [ -z $CMAKE_CXX_STANDARD ]
-then
-  cmake .. -DCMAKE_BUILD_TYPE=$CMAKE_BUILD_TYPE
-else
-  cmake .. -DCMAKE_BUILD_TYPE=$CMAKE_BUILD_TYPE -DCMAKE_CXX_STANDARD=$CMAKE_CXX_STANDARD
+CMAKE_ARGS="-DCMAKE_BUILD_TYPE=$CMAKE_BUILD_TYPE"
+if [ $CMAKE_CXX_STANDARD ]; then
+  CMAKE_ARGS="$CMAKE_ARGS -DCMAKE_CXX_STANDARD=$CMAKE_CXX_STANDARD"
 fi
+if [ $BUILD_WITH_CODEGEN ]; then
+  CMAKE_ARGS="$CMAKE_ARGS -DBUILD_WITH_CODEGEN_SUPPORT=ON"
+fi
+if [ $BUILD_WITH_CODEGEN_LLVM ]; then
+  CMAKE_ARGS="$CMAKE_ARGS -DBUILD_WITH_CODEGEN_LLVM_SUPPORT=ON -DLLVM_DIR=/usr/lib/llvm-6.0/lib/cmake/llvm"
+  CMAKE_ARGS="$CMAKE_ARGS -DClang_DIR=/usr/lib/cmake/clang-6.0"
+fi
+cmake .. $CMAKE_ARGS
 
 make -j1
 make test
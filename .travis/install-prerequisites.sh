@@ -5,4 +5,12 @@ set -xe
 if [ $CHECK_CLANG_FORMAT ]; then exit 0; fi
 
 #sudo apt upgrade -y -qq
-sudo apt install -y -qq libeigen3-dev doxygen robotpkg-py27-eigenpy robotpkg-py27-pinocchio robotpkg-py27-example-robot-data python-scipy robotpkg-py27-quadprog
\ No newline at end of file
+sudo apt install -y -qq libeigen3-dev doxygen robotpkg-py27-eigenpy robotpkg-py27-pinocchio robotpkg-py27-example-robot-data python-scipy robotpkg-py27-quadprog
+
+# Install the code generation (and its LLVM JIT) dependencies
+if [ $BUILD_WITH_CODEGEN ]; then
+  sudo apt install -y -qq robotpkg-cppad robotpkg-cppadcodegen
+fi
+if [ $BUILD_WITH_CODEGEN_LLVM ]; then
+  sudo apt install -y -qq llvm-6.0-dev libclang-6.0-dev clang-6.0
+fi
@@ -446,4 +446,31 @@ int main(int argc, char* argv[]) {
 
   std::cout << "ContactDAM+EulerIAM calcDiff :\t\t" << AVG(duration) << " us\t" << STDDEV(duration) << " us\t"
             << duration.maxCoeff() << " us\t" << duration.minCoeff() << " us" << std::endl;
+
+  /*********************Solver**********************************/
+  // The per-iteration latency of the sequential linearization and backward pass versus the pipelined one, which
+  // only differ with multithreading support
+  crocoddyl::SolverDDP ddp(problem);
+  ddp.setCandidate(xs, std::vector<Eigen::VectorXd>(N, Eigen::VectorXd::Zero(actuation->get_nu())));
+  const unsigned int T_ddp = std::max(T / N, 1u);
+  Eigen::ArrayXd duration_ddp(T_ddp);
+
+  duration_ddp.setZero();
+  SMOOTH(T_ddp) {
+    timer.reset();
+    ddp.calcDiff();
+    ddp.backwardPass();
+    duration_ddp[_smooth] = timer.get_us_duration();
+  }
+  std::cout << "SolverDDP calcDiff+backwardPass :\t" << AVG(duration_ddp) << " us\t" << STDDEV(duration_ddp)
+            << " us\t" << duration_ddp.maxCoeff() << " us\t" << duration_ddp.minCoeff() << " us" << std::endl;
+
+  duration_ddp.setZero();
+  SMOOTH(T_ddp) {
+    timer.reset();
+    ddp.calcDiffAndBackwardPass();
+    duration_ddp[_smooth] = timer.get_us_duration();
+  }
+  std::cout << "SolverDDP calcDiffAndBackwardPass :\t" << AVG(duration_ddp) << " us\t" << STDDEV(duration_ddp)
+            << " us\t" << duration_ddp.maxCoeff() << " us\t" << duration_ddp.minCoeff() << " us" << std::endl;
 }
@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/states/euclidean.hpp"
+#include "crocoddyl/core/actions/lqr.hpp"
+#include "crocoddyl/core/solvers/ddp.hpp"
+#include "crocoddyl/core/solvers/fddp.hpp"
+#include "crocoddyl/core/utils/timer.hpp"
+
+// The control Hessian of this LQR is negative definite and the controls barely act on the dynamics, so Quu is
+// indefinite along the whole horizon. Each backward pass fails until the regularization overcomes it, which stresses
+// the failure path of the solvers.
+int main(int argc, char* argv[]) {
+  unsigned int NX = 37;
+  unsigned int NU = 12;
+  unsigned int N = 100;  // number of nodes
+  unsigned int T = 5e3;  // number of trials
+  unsigned int MAXITER = 10;
+  if (argc > 1) {
+    T = atoi(argv[1]);
+  }
+
+  // Creating the action models and warm point for the indefinite LQR system
+  Eigen::VectorXd x0 = Eigen::VectorXd::Zero(NX);
+  boost::shared_ptr<crocoddyl::ActionModelLQR> model = boost::make_shared<crocoddyl::ActionModelLQR>(NX, NU);
+  model->set_Fu(1e-2 * Eigen::MatrixXd::Identity(NX, NU));
+  model->set_Lxu(Eigen::MatrixXd::Zero(NX, NU));
+  model->set_Luu(-1e-1 * Eigen::MatrixXd::Identity(NU, NU));
+  std::vector<Eigen::VectorXd> xs(N + 1, x0);
+  std::vector<Eigen::VectorXd> us(N, Eigen::VectorXd::Zero(NU));
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > runningModels(N, model);
+
+  // Formulating the optimal control problem
+  boost::shared_ptr<crocoddyl::ShootingProblem> problem =
+      boost::make_shared<crocoddyl::ShootingProblem>(x0, runningModels, model);
+  crocoddyl::SolverDDP ddp(problem);
+  crocoddyl::SolverFDDP fddp(problem);
+
+  // Solving the optimal control problem
+  Eigen::ArrayXd duration(T);
+  for (unsigned int i = 0; i < T; ++i) {
+    crocoddyl::Timer timer;
+    ddp.solve(xs, us, MAXITER);
+    duration[i] = timer.get_duration();
+  }
+
+  double avrg_duration = duration.sum() / T;
+  double min_duration = duration.minCoeff();
+  double max_duration = duration.maxCoeff();
+  std::cout << "DDP.solve [ms]: " << avrg_duration << " (" << min_duration << "-" << max_duration << ")" << std::endl;
+
+  for (unsigned int i = 0; i < T; ++i) {
+    crocoddyl::Timer timer;
+    fddp.solve(xs, us, MAXITER);
+    duration[i] = timer.get_duration();
+  }
+
+  avrg_duration = duration.sum() / T;
+  min_duration = duration.minCoeff();
+  max_duration = duration.maxCoeff();
+  std::cout << "FDDP.solve [ms]: " << avrg_duration << " (" << min_duration << "-" << max_duration << ")"
+            << std::endl;
+
+  // Running a failing backward pass
+  ddp.setCandidate(xs, us);
+  ddp.calcDiff();
+  ddp.set_xreg(1e-9);
+  ddp.set_ureg(1e-9);
+  for (unsigned int i = 0; i < T; ++i) {
+    crocoddyl::Timer timer;
+    ddp.backwardPass();
+    duration[i] = timer.get_duration();
+  }
+
+  avrg_duration = duration.sum() / T;
+  min_duration = duration.minCoeff();
+  max_duration = duration.maxCoeff();
+  std::cout << "DDP.backwardPass (failure) [ms]: " << avrg_duration << " (" << min_duration << "-" << max_duration
+            << ")" << std::endl;
+}
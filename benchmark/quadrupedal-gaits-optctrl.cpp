@@ -91,4 +91,31 @@ int main(int argc, char* argv[]) {
   max_duration = duration.maxCoeff();
   std::cout << "  ShootingProblem.calcDiff [ms]: " << avrg_duration << " (" << min_duration << "-" << max_duration
             << ")" << std::endl;
-}
\ No newline at end of file
+
+  // Rebuilding the problem from the contact-phase prototypes
+  for (unsigned int i = 0; i < T; ++i) {
+    crocoddyl::Timer timer;
+    gait.createWalkingProblem(x0, stepLength, stepHeight, timeStep, stepKnots, supportKnots);
+    duration[i] = timer.get_duration();
+  }
+
+  avrg_duration = duration.sum() / T;
+  min_duration = duration.minCoeff();
+  max_duration = duration.maxCoeff();
+  std::cout << "  SimpleQuadrupedGaitProblem.createWalkingProblem [ms]: " << avrg_duration << " (" << min_duration
+            << "-" << max_duration << ")" << std::endl;
+
+  // Rebuilding the problem without prototypes, i.e. creating again the contact models of each phase
+  for (unsigned int i = 0; i < T; ++i) {
+    gait.clearPrototypes();
+    crocoddyl::Timer timer;
+    gait.createWalkingProblem(x0, stepLength, stepHeight, timeStep, stepKnots, supportKnots);
+    duration[i] = timer.get_duration();
+  }
+
+  avrg_duration = duration.sum() / T;
+  min_duration = duration.minCoeff();
+  max_duration = duration.maxCoeff();
+  std::cout << "  SimpleQuadrupedGaitProblem.createWalkingProblem (no prototypes) [ms]: " << avrg_duration << " ("
+            << min_duration << "-" << max_duration << ")" << std::endl;
+}
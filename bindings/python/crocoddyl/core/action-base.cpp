@@ -59,6 +59,20 @@ void exposeActionAbstract() {
            "Each action model (AM) has its own data that needs to be allocated.\n"
            "This function returns the allocated data for a predefined AM.\n"
            ":return AM data.")
+      .def("clone", &ActionModelAbstract_wrap::clone, bp::args("self"),
+           "Clone the action model.\n\n"
+           "The cloned model shares the state (and Pinocchio model) of this model, and duplicates\n"
+           "its cost, contact and actuation models. It can be modified independently.\n"
+           ":return cloned action model.")
+      .def("copyNodeParameters", &ActionModelAbstract::copyNodeParameters, bp::args("self", "data_from", "data_to"),
+           "Copy the node parameters from one data of this model to another one.\n\n"
+           "The node parameters are the cost references and weights stored in the data of a node.\n"
+           ":param data_from: action data that stores the node parameters\n"
+           ":param data_to: action data that receives the node parameters")
+      .def("resetNodeParameters", &ActionModelAbstract::resetNodeParameters, bp::args("self", "data"),
+           "Reset the node parameters of a data of this model.\n\n"
+           "After the reset, the data uses the references and weights of the model again.\n"
+           ":param data: action data")
       .def("quasiStatic", &ActionModelAbstract_wrap::quasiStatic_x,
            ActionModel_quasiStatic_wraps(
                bp::args("self", "data", "x", "maxiter", "tol"),
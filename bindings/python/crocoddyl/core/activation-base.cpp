@@ -35,6 +35,9 @@ void exposeActivationAbstract() {
            ":param r: residual vector \n")
       .def("createData", &ActivationModelAbstract_wrap::createData, &ActivationModelAbstract_wrap::default_createData,
            bp::args("self"), "Create the activation data.\n\n")
+      .def("clone", &ActivationModelAbstract_wrap::clone, bp::args("self"),
+           "Clone the activation model.\n\n"
+           ":return cloned activation model.")
       .add_property(
           "nr",
           bp::make_function(&ActivationModelAbstract_wrap::get_nr, bp::return_value_policy<bp::return_by_value>()),
@@ -45,6 +45,9 @@ void exposeActuationAbstract() {
            "Each actuation model (AM) has its own data that needs to be allocated.\n"
            "This function returns the allocated data for a predefined AM.\n"
            ":return AM data.")
+      .def("clone", &ActuationModelAbstract_wrap::clone, bp::args("self"),
+           "Clone the actuation model.\n\n"
+           ":return cloned actuation model.")
       .add_property(
           "nu",
           bp::make_function(&ActuationModelAbstract_wrap::get_nu, bp::return_value_policy<bp::return_by_value>()),
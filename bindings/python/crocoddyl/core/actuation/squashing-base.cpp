@@ -35,6 +35,9 @@ void exposeSquashingAbstract() {
            ":param data: squashing data\n"
            ":param u: squashing input")
       .def("createData", &SquashingModelAbstract_wrap::createData, bp::args("self"), "Create the squashing data.\n\n")
+      .def("clone", &SquashingModelAbstract_wrap::clone, bp::args("self"),
+           "Clone the squashing model.\n\n"
+           ":return cloned squashing model.")
       .add_property(
           "ns",
           bp::make_function(&SquashingModelAbstract_wrap::get_ns, bp::return_value_policy<bp::return_by_value>()),
@@ -22,8 +22,10 @@ void exposeCore() {
   exposeSquashingSmoothSat();
   exposeActuationSquashing();
   exposeDataCollectorActuation();
+  exposeIntegratedActionAbstract();
   exposeIntegratedActionEuler();
   exposeIntegratedActionRK4();
+  exposeIntegratedActionMultiRate();
   exposeCostAbstract();
   exposeCostSum();
   exposeCostControl();
@@ -31,6 +33,7 @@ void exposeCore() {
   exposeDifferentialActionNumDiff();
   exposeActivationNumDiff();
   exposeShootingProblem();
+  exposeHorizonCompression();
   exposeSolverAbstract();
   exposeStateEuclidean();
   exposeActionUnicycle();
@@ -24,8 +24,10 @@ void exposeSquashingAbstract();
 void exposeSquashingSmoothSat();
 void exposeActuationSquashing();
 void exposeDataCollectorActuation();
+void exposeIntegratedActionAbstract();
 void exposeIntegratedActionEuler();
 void exposeIntegratedActionRK4();
+void exposeIntegratedActionMultiRate();
 void exposeCostAbstract();
 void exposeCostSum();
 void exposeCostControl();
@@ -33,6 +35,7 @@ void exposeActionNumDiff();
 void exposeDifferentialActionNumDiff();
 void exposeActivationNumDiff();
 void exposeShootingProblem();
+void exposeHorizonCompression();
 void exposeSolverAbstract();
 void exposeStateEuclidean();
 void exposeActionUnicycle();
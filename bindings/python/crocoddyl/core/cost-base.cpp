@@ -77,6 +77,9 @@ void exposeCostAbstract() {
            ":param data: shared data\n"
            ":return cost data.")
       .def("createData", &CostModelAbstract_wrap::default_createData, bp::with_custodian_and_ward_postcall<0, 2>())
+      .def("clone", &CostModelAbstract_wrap::clone, bp::args("self"),
+           "Clone the cost model.\n\n"
+           ":return cloned cost model.")
       .add_property(
           "state",
           bp::make_function(&CostModelAbstract_wrap::get_state, bp::return_value_policy<bp::return_by_value>()),
@@ -87,7 +90,13 @@ void exposeCostAbstract() {
           "activation model")
       .add_property("nu",
                     bp::make_function(&CostModelAbstract_wrap::get_nu, bp::return_value_policy<bp::return_by_value>()),
-                    "dimension of control vector");
+                    "dimension of control vector")
+      .add_property("q_dependent", &CostModelAbstract_wrap::get_q_dependent,
+                    "flag that indicates if the cost depends on q")
+      .add_property("v_dependent", &CostModelAbstract_wrap::get_v_dependent,
+                    "flag that indicates if the cost depends on v")
+      .add_property("u_dependent", &CostModelAbstract_wrap::get_u_dependent,
+                    "flag that indicates if the cost depends on u");
 
   bp::register_ptr_to_python<boost::shared_ptr<CostDataAbstract> >();
 
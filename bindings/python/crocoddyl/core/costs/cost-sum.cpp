@@ -102,6 +102,16 @@ void exposeCostSum() {
            "Create the total cost data.\n\n"
            ":param data: shared data\n"
            ":return total cost data.")
+      .def("clone", &CostModelSum::clone, bp::args("self"),
+           "Clone the cost-sum model.\n\n"
+           ":return cloned cost-sum model.")
+      .def("copyNodeParameters", &CostModelSum::copyNodeParameters, bp::args("self", "data_from", "data_to"),
+           "Copy the node weights and references from one data of this cost sum to another one.\n\n"
+           ":param data_from: cost-sum data that stores the node parameters\n"
+           ":param data_to: cost-sum data that receives the node parameters")
+      .def("resetNodeParameters", &CostModelSum::resetNodeParameters, bp::args("self", "data"),
+           "Clear the node weights and references stored in a data of this cost sum.\n\n"
+           ":param data: cost-sum data of the node")
       .add_property("state",
                     bp::make_function(&CostModelSum::get_state, bp::return_value_policy<bp::return_by_value>()),
                     "state description")
@@ -123,6 +133,21 @@ void exposeCostSum() {
                     "name of inactive cost items")
       .def("getCostStatus", &CostModelSum::getCostStatus, bp::args("self", "name"),
            "Return the cost status of a given cost name.\n\n"
+           ":param name: cost name")
+      .def("changeCostWeight", &CostModelSum::changeCostWeight, bp::args("self", "data", "name", "weight"),
+           "Change the cost weight of a given node.\n\n"
+           "The weight is stored in the cost data, and it overrides the weight of the cost item for this node.\n"
+           ":param data: cost data of the node\n"
+           ":param name: cost name\n"
+           ":param weight: cost weight")
+      .def("resetCostReference", &CostModelSum::resetCostReference, bp::args("self", "data", "name"),
+           "Clear the cost reference of a given node.\n\n"
+           "After it, the node uses the model reference of the cost item again.\n"
+           ":param data: cost data of the node\n"
+           ":param name: cost name")
+      .def("getCostWeight", &CostModelSum::getCostWeight, bp::args("self", "data", "name"),
+           "Return the cost weight used by a given node.\n\n"
+           ":param data: cost data of the node\n"
            ":param name: cost name");
 
   bp::register_ptr_to_python<boost::shared_ptr<CostDataSum> >();
@@ -144,6 +169,9 @@ void exposeCostSum() {
       .add_property("shared", bp::make_getter(&CostDataSum::shared, bp::return_internal_reference<>()), "shared data")
       .add_property("cost", bp::make_getter(&CostDataSum::cost, bp::return_value_policy<bp::return_by_value>()),
                     bp::make_setter(&CostDataSum::cost), "cost value")
+      .add_property("nskip", bp::make_getter(&CostDataSum::nskip, bp::return_value_policy<bp::return_by_value>()),
+                    bp::make_setter(&CostDataSum::nskip),
+                    "number of cost derivatives skipped because their activation was inactive")
       .add_property("Lx", bp::make_function(&CostDataSum::get_Lx, bp::return_value_policy<bp::return_by_value>()),
                     bp::make_function(&CostDataSum::set_Lx), "Jacobian of the cost")
       .add_property("Lu", bp::make_function(&CostDataSum::get_Lu, bp::return_value_policy<bp::return_by_value>()),
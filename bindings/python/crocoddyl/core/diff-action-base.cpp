@@ -58,6 +58,9 @@ void exposeDifferentialActionAbstract() {
            "allocated. This function returns the allocated data for a predefined\n"
            "DAM.\n"
            ":return DAM data.")
+      .def("clone", &DifferentialActionModelAbstract_wrap::clone, bp::args("self"),
+           "Clone the differential action model.\n\n"
+           ":return cloned differential action model.")
       .def("quasiStatic", &DifferentialActionModelAbstract_wrap::quasiStatic_x,
            DifferentialActionModel_quasiStatic_wraps(
                bp::args("self", "data", "x", "maxiter", "tol"),
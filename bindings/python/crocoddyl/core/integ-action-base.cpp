@@ -0,0 +1,41 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/core/action-base.hpp"
+#include "crocoddyl/core/integ-action-base.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void exposeIntegratedActionAbstract() {
+  bp::register_ptr_to_python<boost::shared_ptr<IntegratedActionModelAbstract> >();
+
+  bp::class_<IntegratedActionModelAbstract, bp::bases<ActionModelAbstract>, boost::noncopyable>(
+      "IntegratedActionModelAbstract",
+      "Abstract class for integrated action models.\n\n"
+      "It holds the differential action model and the step time of the node, which are shared by\n"
+      "all the integration schemes.",
+      bp::no_init)
+      .def("createWithTimeStep", &IntegratedActionModelAbstract::createWithTimeStep, bp::args("self", "dt"),
+           "Create an integrated model of the same type with a different step time.\n\n"
+           "The new model shares the differential action model with this one.\n"
+           ":param dt: step time of the new model\n"
+           ":return integrated action model")
+      .add_property("differential",
+                    bp::make_function(&IntegratedActionModelAbstract::get_differential,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    &IntegratedActionModelAbstract::set_differential, "differential action model")
+      .add_property("dt",
+                    bp::make_function(&IntegratedActionModelAbstract::get_dt,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    &IntegratedActionModelAbstract::set_dt, "step time");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
@@ -14,7 +14,7 @@ namespace crocoddyl {
 namespace python {
 
 void exposeIntegratedActionEuler() {
-  bp::class_<IntegratedActionModelEuler, bp::bases<ActionModelAbstract> >(
+  bp::class_<IntegratedActionModelEuler, bp::bases<IntegratedActionModelAbstract> >(
       "IntegratedActionModelEuler",
       "Sympletic Euler integrator for differential action models.\n\n"
       "This class implements a sympletic Euler integrator (a.k.a semi-implicit\n"
@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/core/action-base.hpp"
+#include "crocoddyl/core/integrator/multi-rate.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void exposeIntegratedActionMultiRate() {
+  bp::enum_<IntegratorType>("IntegratorType")
+      .value("IntegratorEuler", IntegratorEuler)
+      .value("IntegratorRK4", IntegratorRK4)
+      .export_values();
+
+  bp::class_<IntegratedActionModelMultiRate, bp::bases<IntegratedActionModelAbstract> >(
+      "IntegratedActionModelMultiRate",
+      "Multi-rate integrator for differential action models.\n\n"
+      "This class holds the control input over nsteps substeps of dt / nsteps, which are\n"
+      "integrated with an Euler or RK4 scheme, i.e.:\n"
+      "  x_{k+1} = f_k(x_k, u) for k = 0, ..., nsteps - 1,\n"
+      "and exposes them as a single node whose cost is the sum of the substep costs.",
+      bp::init<boost::shared_ptr<DifferentialActionModelAbstract>,
+               bp::optional<double, std::size_t, IntegratorType, bool> >(
+          bp::args("self", "diffModel", "stepTime", "nsteps", "integrator", "withCostResidual"),
+          "Initialize the multi-rate integrator.\n\n"
+          ":param diffModel: differential action model\n"
+          ":param stepTime: step time of the node (default 1e-3)\n"
+          ":param nsteps: number of integration substeps (default 1)\n"
+          ":param integrator: integration scheme of each substep (default IntegratorEuler)\n"
+          ":param withCostResidual: includes the cost residuals and derivatives."))
+      .def<void (IntegratedActionModelMultiRate::*)(const boost::shared_ptr<ActionDataAbstract>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &IntegratedActionModelMultiRate::calc, bp::args("self", "data", "x", "u"),
+          "Compute the time-discrete evolution of a differential action model.\n\n"
+          "It integrates the differential action model along the substeps.\n"
+          ":param data: action data\n"
+          ":param x: state vector\n"
+          ":param u: control input")
+      .def<void (IntegratedActionModelMultiRate::*)(const boost::shared_ptr<ActionDataAbstract>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &ActionModelAbstract::calc, bp::args("self", "data", "x"))
+      .def<void (IntegratedActionModelMultiRate::*)(const boost::shared_ptr<ActionDataAbstract>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &IntegratedActionModelMultiRate::calcDiff, bp::args("self", "data", "x", "u"),
+          "Computes the derivatives of the integrated action model wrt state and control. \n\n"
+          "The derivatives of each substep are chained along the substeps.\n"
+          "It assumes that calc has been run first.\n"
+          ":param data: action data\n"
+          ":param x: state vector\n"
+          ":param u: control input\n")
+      .def<void (IntegratedActionModelMultiRate::*)(const boost::shared_ptr<ActionDataAbstract>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &ActionModelAbstract::calcDiff, bp::args("self", "data", "x"))
+      .def("createData", &IntegratedActionModelMultiRate::createData, bp::args("self"),
+           "Create the multi-rate integrator data.")
+      .add_property("differential",
+                    bp::make_function(&IntegratedActionModelMultiRate::get_differential,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    &IntegratedActionModelMultiRate::set_differential, "differential action model")
+      .add_property("integrator",
+                    bp::make_function(&IntegratedActionModelMultiRate::get_integrator,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    "integrated action model used in each substep")
+      .add_property("integratorType",
+                    bp::make_function(&IntegratedActionModelMultiRate::get_integrator_type,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    "integration scheme used in each substep")
+      .add_property("dt",
+                    bp::make_function(&IntegratedActionModelMultiRate::get_dt,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    &IntegratedActionModelMultiRate::set_dt, "step time of the node")
+      .add_property("nsteps",
+                    bp::make_function(&IntegratedActionModelMultiRate::get_nsteps,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    "number of integration substeps");
+
+  bp::register_ptr_to_python<boost::shared_ptr<IntegratedActionDataMultiRate> >();
+
+  bp::class_<IntegratedActionDataMultiRate, bp::bases<ActionDataAbstract> >(
+      "IntegratedActionDataMultiRate", "Multi-rate integrator data.",
+      bp::init<IntegratedActionModelMultiRate*>(bp::args("self", "model"),
+                                                "Create multi-rate integrator data.\n\n"
+                                                ":param model: multi-rate integrator model"))
+      .add_property("substeps",
+                    bp::make_getter(&IntegratedActionDataMultiRate::substeps,
+                                    bp::return_value_policy<bp::return_by_value>()),
+                    "list of integrated action data of each substep")
+      .add_property("xs", bp::make_getter(&IntegratedActionDataMultiRate::xs, bp::return_internal_reference<>()),
+                    "list of states visited along the substeps");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
@@ -14,7 +14,7 @@ namespace crocoddyl {
 namespace python {
 
 void exposeIntegratedActionRK4() {
-  bp::class_<IntegratedActionModelRK4, bp::bases<ActionModelAbstract> >(
+  bp::class_<IntegratedActionModelRK4, bp::bases<IntegratedActionModelAbstract> >(
       "IntegratedActionModelRK4",
       "RK4 integrator for differential action models.\n\n"
       "This class implements an RK4 integrator\n"
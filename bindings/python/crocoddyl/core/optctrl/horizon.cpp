@@ -0,0 +1,44 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "python/crocoddyl/core/core.hpp"
+#include "crocoddyl/core/optctrl/horizon.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+bp::tuple compressHorizon_wrap(const ShootingProblem& problem, const Eigen::VectorXd& dts,
+                               const std::vector<Eigen::VectorXd>& xs, const std::vector<Eigen::VectorXd>& us) {
+  std::vector<Eigen::VectorXd> xs_out, us_out;
+  boost::shared_ptr<ShootingProblem> new_problem = compressHorizon(problem, dts, xs, us, xs_out, us_out);
+  return bp::make_tuple(new_problem, xs_out, us_out);
+}
+
+void exposeHorizonCompression() {
+  bp::def("computeGeometricTimeSteps", &computeGeometricTimeSteps<double>, bp::args("dt0", "ratio", "N"),
+          "Compute a geometrically growing sequence of time steps.\n\n"
+          "It returns dt_k = dt0 * ratio^k for k = 0, ..., N - 1.\n"
+          ":param dt0: time step of the first node\n"
+          ":param ratio: growth ratio between consecutive time steps\n"
+          ":param N: number of time steps\n"
+          ":return the sequence of time steps");
+  bp::def("compressHorizon", &compressHorizon_wrap, bp::args("problem", "dts", "xs", "us"),
+          "Rebuild a shooting problem on a different time grid.\n\n"
+          "Each new node is created from the source integrated node that covers its starting time,\n"
+          "and zero-duration nodes (e.g. impulses) are inserted once the new grid reaches them. The\n"
+          "warm start is interpolated onto the new grid.\n"
+          ":param problem: source shooting problem\n"
+          ":param dts: time step of each new running node\n"
+          ":param xs: source state trajectory\n"
+          ":param us: source control sequence\n"
+          ":return the new problem and its interpolated state and control trajectories");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
@@ -80,7 +80,7 @@ void exposeShootingProblem() {
           "circularAppend", &ShootingProblem::circularAppend, bp::args("self", "model"),
           "Circular append the model and data onto the end running node.\n\n"
           "Once we update the end running node, the first running mode is removed as in a circular buffer.\n"
-          "Note that this method allocates new data for the end running node.\n"
+          "Note that the data of the end running node is taken from the data pool.\n"
           ":param model: new model")
       .def("updateNode", &ShootingProblem::updateNode, bp::args("self", "i", "model", "data"),
            "Update the model and data for a specific node.\n\n"
@@ -88,11 +88,34 @@ void exposeShootingProblem() {
            ":param model: new model\n"
            ":param data: new data")
       .def("updateModel", &ShootingProblem::updateModel, bp::args("self", "i", "model"),
-           "Update a model and allocated new data for a specific node.\n\n"
+           "Update a model for a specific node and take its data from the data pool.\n\n"
            ":param i: index of the node (0 <= i <= T + 1)\n"
            ":param model: new model")
+      .def("acquireData", &ShootingProblem::acquireData, bp::args("self", "model"),
+           "Return a data of the given model, recycled from the data pool if possible.\n\n"
+           "A new data is created by the model only if the pool has no data of this model.\n"
+           ":param model: action model\n"
+           ":return action data")
+      .def("releaseData", &ShootingProblem::releaseData, bp::args("self", "model", "data"),
+           "Return a data, created by the given model, to the data pool.\n\n"
+           "The data must not be used anymore by any node.\n"
+           ":param model: action model that created the data\n"
+           ":param data: action data")
+      .def("clearDataPool", &ShootingProblem::clearDataPool, bp::args("self"),
+           "Remove all the datas of the data pool.")
+      .def("updateCost", &ShootingProblem::updateCost, bp::args("self"),
+           "Update the total cost from the cost of each node data.\n\n"
+           ":returns the total cost value")
+      .def("clone", &ShootingProblem::clone, bp::args("self"),
+           "Clone the shooting problem.\n\n"
+           "Each action model is cloned and new data is allocated. Use it to solve or modify\n"
+           "a copy of the problem (e.g. in another thread) without affecting this one.\n"
+           ":return cloned shooting problem.")
       .add_property("T", bp::make_function(&ShootingProblem::get_T, bp::return_value_policy<bp::return_by_value>()),
                     "number of running nodes")
+      .add_property("cost",
+                    bp::make_function(&ShootingProblem::get_cost, bp::return_value_policy<bp::return_by_value>()),
+                    "total cost computed by the last calc, calcDiff or updateCost")
       .add_property("x0", bp::make_function(&ShootingProblem::get_x0, bp::return_internal_reference<>()),
                     &ShootingProblem::set_x0, "initial state")
       .add_property(
@@ -118,7 +141,9 @@ void exposeShootingProblem() {
                     "dimension of the tangent space of the state manifold")
       .add_property("nu_max",
                     bp::make_function(&ShootingProblem::get_nu_max, bp::return_value_policy<bp::return_by_value>()),
-                    "dimension of the maximum control vector");
+                    "dimension of the maximum control vector")
+      .add_property("timeGrid", &ShootingProblem::get_timeGrid,
+                    "starting time of each node (zero-duration for non-integrated nodes)");
 }
 
 }  // namespace python
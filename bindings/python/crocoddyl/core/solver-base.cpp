@@ -123,7 +123,12 @@ void exposeSolverAbstract() {
           "th_stop",
           bp::make_function(&SolverAbstract_wrap::get_th_stop, bp::return_value_policy<bp::copy_const_reference>()),
           bp::make_function(&SolverAbstract_wrap::set_th_stop), "threshold for stopping criteria")
-      .def_readwrite("iter", &SolverAbstract_wrap::iter_, "number of iterations runned in solve()");
+      .def_readwrite("iter", &SolverAbstract_wrap::iter_, "number of iterations runned in solve()")
+      .add_property("cancellation_token",
+                    bp::make_function(&SolverAbstract_wrap::get_cancellation_token,
+                                      bp::return_value_policy<bp::copy_const_reference>()),
+                    bp::make_function(&SolverAbstract_wrap::set_cancellation_token),
+                    "token checked between iterations and line-search trials to cancel the solve");
 
   bp::class_<CallbackAbstract_wrap, boost::noncopyable>(
       "CallbackAbstract",
@@ -32,7 +32,8 @@ void exposeSolverBoxQP() {
                     bp::make_setter(&BoxQPSolution::free_idx), "free indexes")
       .add_property("clamped_idx",
                     bp::make_getter(&BoxQPSolution::clamped_idx, bp::return_value_policy<bp::return_by_value>()),
-                    bp::make_setter(&BoxQPSolution::clamped_idx), "clamped indexes");
+                    bp::make_setter(&BoxQPSolution::clamped_idx), "clamped indexes")
+      .def_readwrite("success", &BoxQPSolution::success, "false if the free Hessian is not positive definite");
 
   bp::register_ptr_to_python<boost::shared_ptr<BoxQP> >();
 
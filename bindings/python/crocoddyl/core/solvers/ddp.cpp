@@ -8,6 +8,7 @@
 
 #include "python/crocoddyl/core/core.hpp"
 #include "crocoddyl/core/solvers/ddp.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
 
 namespace crocoddyl {
 namespace python {
@@ -16,9 +17,29 @@ BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverDDP_solves, SolverDDP::solve, 0, 5)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverDDP_computeDirections, SolverDDP::computeDirection, 0, 1)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverDDP_trySteps, SolverDDP::tryStep, 0, 1)
 
+void backwardPass_wrap(SolverDDP& solver) {
+  solver.backwardPass();
+  if (solver.get_pass_status() != PassSuccess) {
+    throw_pretty("backward_error");
+  }
+}
+
+void forwardPass_wrap(SolverDDP& solver, const double& steplength) {
+  solver.forwardPass(steplength);
+  if (solver.get_pass_status() != PassSuccess) {
+    throw_pretty("forward_error");
+  }
+}
+
 void exposeSolverDDP() {
   bp::register_ptr_to_python<boost::shared_ptr<SolverDDP> >();
 
+  bp::enum_<PassStatus>("PassStatus")
+      .value("PassSuccess", PassSuccess)
+      .value("BackwardError", BackwardError)
+      .value("ForwardError", ForwardError)
+      .export_values();
+
   bp::class_<SolverDDP, bp::bases<SolverAbstract> >(
       "SolverDDP",
       "DDP solver.\n\n"
@@ -74,17 +95,19 @@ void exposeSolverDDP() {
            "These derivatives are computed around the guess state and control\n"
            "trajectory. These trajectory can be set by using setCandidate.\n"
            ":return the total cost around the guess trajectory.")
-      .def("backwardPass", &SolverDDP::backwardPass, bp::args("self"),
+      .def("backwardPass", &backwardPass_wrap, bp::args("self"),
            "Run the backward pass (Riccati sweep)\n\n"
            "It assumes that the Jacobian and Hessians of the optimal control problem have been\n"
            "compute. These terms are computed by running calc.")
-      .def("forwardPass", &SolverDDP::forwardPass, bp::args("self", "stepLength"),
+      .def("forwardPass", &forwardPass_wrap, bp::args("self", "stepLength"),
            "Run the forward pass or rollout\n\n"
            "It rollouts the action model given the computed policy (feedforward terns and feedback\n"
            "gains) by the backwardPass. We can define different step lengths\n"
            ":param stepLength: applied step length (<= 1. and >= 0.)")
       .add_property("Vxx", make_function(&SolverDDP::get_Vxx, bp::return_value_policy<bp::copy_const_reference>()),
                     "Vxx")
+      .add_property("Sxx", make_function(&SolverDDP::get_Sxx, bp::return_value_policy<bp::copy_const_reference>()),
+                    "factors of Vxx (only updated by the square-root backward pass)")
       .add_property("Vx", make_function(&SolverDDP::get_Vx, bp::return_value_policy<bp::copy_const_reference>()), "Vx")
       .add_property("Qxx", make_function(&SolverDDP::get_Qxx, bp::return_value_policy<bp::copy_const_reference>()),
                     "Qxx")
@@ -124,6 +147,10 @@ void exposeSolverDDP() {
       .add_property("th_gaptol",
                     bp::make_function(&SolverDDP::get_th_gaptol, bp::return_value_policy<bp::copy_const_reference>()),
                     bp::make_function(&SolverDDP::set_th_gaptol), "threshold for accepting a gap as non-zero")
+      .add_property("pass_status", &SolverDDP::get_pass_status, "status of the last backward or forward pass")
+      .add_property("square_root", bp::make_function(&SolverDDP::get_square_root),
+                    bp::make_function(&SolverDDP::set_square_root),
+                    "propagate the factors of the Value function in the backward pass (default False)")
       .add_property("alphas",
                     bp::make_function(&SolverDDP::get_alphas, bp::return_value_policy<bp::copy_const_reference>()),
                     bp::make_function(&SolverDDP::set_alphas), "list of step length (alpha) values");
@@ -51,7 +51,10 @@ void exposeSolverFDDP() {
            "Update the expected improvement model\n\n")
       .add_property("th_acceptNegStep", bp::make_function(&SolverFDDP::get_th_acceptnegstep),
                     bp::make_function(&SolverFDDP::set_th_acceptnegstep),
-                    "threshold for step acceptance in ascent direction");
+                    "threshold for step acceptance in ascent direction")
+      .add_property("speculative", bp::make_function(&SolverFDDP::get_speculative),
+                    bp::make_function(&SolverFDDP::set_speculative),
+                    "speculatively linearize the full-step rollouts (default False)");
 }
 
 }  // namespace python
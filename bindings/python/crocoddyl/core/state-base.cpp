@@ -12,6 +12,21 @@
 namespace crocoddyl {
 namespace python {
 
+std::vector<Eigen::VectorXd> diffTrajectory_wrap(const StateAbstract& state, const std::vector<Eigen::VectorXd>& x0s,
+                                                 const std::vector<Eigen::VectorXd>& x1s) {
+  std::vector<Eigen::VectorXd> dxs(x0s.size(), Eigen::VectorXd::Zero(state.get_ndx()));
+  state.diffTrajectory(x0s, x1s, dxs);
+  return dxs;
+}
+
+std::vector<Eigen::VectorXd> integrateTrajectory_wrap(const StateAbstract& state,
+                                                      const std::vector<Eigen::VectorXd>& xs,
+                                                      const std::vector<Eigen::VectorXd>& dxs) {
+  std::vector<Eigen::VectorXd> xouts(xs.size(), Eigen::VectorXd::Zero(state.get_nx()));
+  state.integrateTrajectory(xs, dxs, xouts);
+  return xouts;
+}
+
 void exposeStateAbstract() {
   bp::register_ptr_to_python<boost::shared_ptr<StateAbstract> >();
 
@@ -84,6 +99,18 @@ void exposeStateAbstract() {
            ":param dx: velocity vector (dim state.ndx).\n"
            ":param firstsecond: desired partial derivative\n"
            ":return the partial derivative(s) of the integrate(x, dx) function")
+      .def("diffTrajectory", &diffTrajectory_wrap, bp::args("self", "x0s", "x1s"),
+           "Compute the state manifold differentiation along a trajectory.\n\n"
+           "It returns the values of x1s[k] [-] x0s[k] for every node k.\n"
+           ":param x0s: previous state points (each one with dim state.nx).\n"
+           ":param x1s: current state points (each one with dim state.nx).\n"
+           ":return list of x1s[k] [-] x0s[k] values (each one with dim state.ndx).")
+      .def("integrateTrajectory", &integrateTrajectory_wrap, bp::args("self", "xs", "dxs"),
+           "Compute the state manifold integration along a trajectory.\n\n"
+           "It returns the values of xs[k] [+] dxs[k] for every node k.\n"
+           ":param xs: state points (each one with dim state.nx).\n"
+           ":param dxs: velocity vectors (each one with dim state.ndx).\n"
+           ":return list of xs[k] [+] dxs[k] values (each one with dim state.nx).")
       .add_property("nx",
                     bp::make_function(&StateAbstract_wrap::get_nx, bp::return_value_policy<bp::return_by_value>()),
                     "dimension of state tuple")
@@ -25,6 +25,29 @@ void exposeCallbacks() {
       .def("__call__", &CallbackVerbose::operator(), bp::args("self", "solver"),
            "Run the callback function given a solver.\n\n"
            ":param solver: solver to be diagnostic");
+
+  bp::class_<CallbackProgress, bp::bases<CallbackAbstract> >(
+      "CallbackProgress",
+      "Callback function for publishing the solver progress.\n\n"
+      "The iteration, cost and stopping value can be read from another thread while the solver runs.",
+      bp::init<>(bp::args("self"), "Initialize the progress callback."))
+      .def("__call__", &CallbackProgress::operator(), bp::args("self", "solver"),
+           "Run the callback function given a solver.\n\n"
+           ":param solver: solver to be diagnostic")
+      .def("reset", &CallbackProgress::reset, bp::args("self"), "Clear the published progress.")
+      .add_property("iter", &CallbackProgress::get_iter, "number of completed iterations")
+      .add_property("cost", &CallbackProgress::get_cost, "total cost of the last iteration")
+      .add_property("stop", &CallbackProgress::get_stop, "stopping value of the last iteration");
+
+  bp::register_ptr_to_python<boost::shared_ptr<CancellationToken> >();
+
+  bp::class_<CancellationToken, boost::noncopyable>(
+      "CancellationToken", "Flag used to cooperatively cancel a running solve.",
+      bp::init<>(bp::args("self"), "Initialize the cancellation token."))
+      .def("cancel", &CancellationToken::cancel, bp::args("self"), "Request the cancellation.")
+      .def("reset", &CancellationToken::reset, bp::args("self"), "Clear a previous cancellation request.")
+      .def("is_cancelled", &CancellationToken::is_cancelled, bp::args("self"),
+           "Return true if the cancellation was requested.");
 }
 
 }  // namespace python
@@ -24,12 +24,14 @@ BOOST_PYTHON_MODULE(libcrocoddyl_pywrap) {
   typedef Eigen::Matrix<Scalar, 6, 1> Vector6;
   // typedef Eigen::Matrix<Scalar, 4, 6> Matrix46;
   typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 3> MatrixX3;
+  typedef Eigen::Matrix<Scalar, 3, Eigen::Dynamic> Matrix3X;
   typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1> VectorX;
   typedef Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> MatrixX;
 
   eigenpy::enableEigenPySpecific<Vector6>();
   // eigenpy::enableEigenPySpecific<Matrix46>();
   eigenpy::enableEigenPySpecific<MatrixX3>();
+  eigenpy::enableEigenPySpecific<Matrix3X>();
 
   // Register converters between std::vector and Python list
   StdVectorPythonVisitor<VectorX, std::allocator<VectorX>, true>::expose("StdVec_VectorX");
@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "python/crocoddyl/multibody/multibody.hpp"
+#include "python/crocoddyl/core/diff-action-base.hpp"
+#include "crocoddyl/multibody/actions/centroidal-fwddyn.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void exposeDifferentialActionCentroidalFwdDynamics() {
+  bp::class_<DifferentialActionModelCentroidalFwdDynamics, bp::bases<DifferentialActionModelAbstract> >(
+      "DifferentialActionModelCentroidalFwdDynamics",
+      "Differential action model for the centroidal (single-rigid-body) dynamics.\n\n"
+      "The state is defined by the CoM position, the aggregated orientation and their velocities,\n"
+      "and the control input stacks the 3d contact forces applied at fixed contact points. It\n"
+      "assumes a constant centroidal inertia and neglects the gyroscopic term. On the other hand,\n"
+      "the stack of cost functions are implemented in CostModelSum().",
+      bp::init<boost::shared_ptr<StateAbstract>, double, Eigen::Matrix3d, Eigen::Matrix3Xd,
+               boost::shared_ptr<CostModelSum> >(bp::args("self", "state", "mass", "inertia", "contacts", "costs"),
+                                                 "Initialize the centroidal forward-dynamics action model.\n\n"
+                                                 ":param state: 12-dimensional state vector\n"
+                                                 ":param mass: total mass of the robot\n"
+                                                 ":param inertia: centroidal inertia expressed in the world frame\n"
+                                                 ":param contacts: contact positions (3 x nc)\n"
+                                                 ":param costs: stack of cost functions"))
+      .def<void (DifferentialActionModelCentroidalFwdDynamics::*)(
+          const boost::shared_ptr<DifferentialActionDataAbstract>&, const Eigen::Ref<const Eigen::VectorXd>&,
+          const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &DifferentialActionModelCentroidalFwdDynamics::calc, bp::args("self", "data", "x", "u"),
+          "Compute the next state and cost value.\n\n"
+          "It describes the time-continuous evolution of the centroidal dynamics under the contact forces.\n"
+          "Additionally it computes the cost value associated to this state and control pair.\n"
+          ":param data: centroidal forward-dynamics action data\n"
+          ":param x: time-continuous state vector\n"
+          ":param u: time-continuous control input (contact forces)")
+      .def<void (DifferentialActionModelCentroidalFwdDynamics::*)(
+          const boost::shared_ptr<DifferentialActionDataAbstract>&, const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &DifferentialActionModelAbstract::calc, bp::args("self", "data", "x"))
+      .def<void (DifferentialActionModelCentroidalFwdDynamics::*)(
+          const boost::shared_ptr<DifferentialActionDataAbstract>&, const Eigen::Ref<const Eigen::VectorXd>&,
+          const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &DifferentialActionModelCentroidalFwdDynamics::calcDiff, bp::args("self", "data", "x", "u"),
+          "Compute the derivatives of the centroidal dynamics and its cost functions.\n\n"
+          "It computes the partial derivatives of the centroidal dynamics and the cost function.\n"
+          "It assumes that calc has been run first.\n"
+          ":param data: centroidal forward-dynamics action data\n"
+          ":param x: time-continuous state vector\n"
+          ":param u: time-continuous control input (contact forces)\n")
+      .def<void (DifferentialActionModelCentroidalFwdDynamics::*)(
+          const boost::shared_ptr<DifferentialActionDataAbstract>&, const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &DifferentialActionModelAbstract::calcDiff, bp::args("self", "data", "x"))
+      .def("createData", &DifferentialActionModelCentroidalFwdDynamics::createData, bp::args("self"),
+           "Create the centroidal forward dynamics differential action data.")
+      .add_property("costs",
+                    bp::make_function(&DifferentialActionModelCentroidalFwdDynamics::get_costs,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    "total cost model")
+      .add_property("mass",
+                    bp::make_function(&DifferentialActionModelCentroidalFwdDynamics::get_mass,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    "total mass")
+      .add_property("inertia",
+                    bp::make_function(&DifferentialActionModelCentroidalFwdDynamics::get_inertia,
+                                      bp::return_internal_reference<>()),
+                    "centroidal inertia")
+      .add_property("gravity",
+                    bp::make_function(&DifferentialActionModelCentroidalFwdDynamics::get_gravity,
+                                      bp::return_internal_reference<>()),
+                    &DifferentialActionModelCentroidalFwdDynamics::set_gravity, "gravity vector")
+      .add_property("contacts",
+                    bp::make_function(&DifferentialActionModelCentroidalFwdDynamics::get_contacts,
+                                      bp::return_internal_reference<>()),
+                    &DifferentialActionModelCentroidalFwdDynamics::set_contacts, "contact positions (3 x nc)")
+      .add_property("nc", &DifferentialActionModelCentroidalFwdDynamics::get_nc, "number of contacts");
+
+  bp::register_ptr_to_python<boost::shared_ptr<DifferentialActionDataCentroidalFwdDynamics> >();
+
+  bp::class_<DifferentialActionDataCentroidalFwdDynamics, bp::bases<DifferentialActionDataAbstract> >(
+      "DifferentialActionDataCentroidalFwdDynamics", "Action data for the centroidal forward dynamics system.",
+      bp::init<DifferentialActionModelCentroidalFwdDynamics*>(
+          bp::args("self", "model"),
+          "Create centroidal forward-dynamics action data.\n\n"
+          ":param model: centroidal forward-dynamics action model"))
+      .add_property("costs",
+                    bp::make_getter(&DifferentialActionDataCentroidalFwdDynamics::costs,
+                                    bp::return_value_policy<bp::return_by_value>()),
+                    "total cost data")
+      .add_property(
+          "force",
+          bp::make_getter(&DifferentialActionDataCentroidalFwdDynamics::force, bp::return_internal_reference<>()),
+          "total contact force")
+      .add_property(
+          "torque",
+          bp::make_getter(&DifferentialActionDataCentroidalFwdDynamics::torque, bp::return_internal_reference<>()),
+          "total contact torque about the CoM");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "python/crocoddyl/multibody/multibody.hpp"
+#include "python/crocoddyl/core/action-base.hpp"
+#include "crocoddyl/multibody/actions/centroidal-transition.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void exposeActionCentroidalTransition() {
+  bp::class_<ActionModelCentroidalTransition, bp::bases<ActionModelAbstract> >(
+      "ActionModelCentroidalTransition",
+      "Action model that maps the whole-body state onto the centroidal state.\n\n"
+      "The next state is (c, theta, cdot, omega), where the CoM velocity and the angular\n"
+      "velocity are computed from the centroidal momentum, and theta is set to zero. The\n"
+      "next state has a different dimension than the whole-body state, which allows us to\n"
+      "chain whole-body and centroidal nodes in the same shooting problem.",
+      bp::init<boost::shared_ptr<StateMultibody>, Eigen::Matrix3d>(
+          bp::args("self", "state", "inertia"),
+          "Initialize the whole-body to centroidal transition.\n\n"
+          ":param state: multibody state\n"
+          ":param inertia: centroidal inertia of the centroidal model (world frame)"))
+      .def<void (ActionModelCentroidalTransition::*)(const boost::shared_ptr<ActionDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &ActionModelCentroidalTransition::calc, bp::args("self", "data", "x", "u"),
+          "Compute the centroidal state.\n\n"
+          ":param data: centroidal transition data\n"
+          ":param x: whole-body state vector\n"
+          ":param u: control input (empty)")
+      .def<void (ActionModelCentroidalTransition::*)(const boost::shared_ptr<ActionDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &ActionModelAbstract::calc, bp::args("self", "data", "x"))
+      .def<void (ActionModelCentroidalTransition::*)(const boost::shared_ptr<ActionDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &ActionModelCentroidalTransition::calcDiff, bp::args("self", "data", "x", "u"),
+          "Compute the Jacobian of the centroidal state with respect to the whole-body state.\n\n"
+          "It assumes that calc has been run first.\n"
+          ":param data: centroidal transition data\n"
+          ":param x: whole-body state vector\n"
+          ":param u: control input (empty)")
+      .def<void (ActionModelCentroidalTransition::*)(const boost::shared_ptr<ActionDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &ActionModelAbstract::calcDiff, bp::args("self", "data", "x"))
+      .def("createData", &ActionModelCentroidalTransition::createData, bp::args("self"),
+           "Create the centroidal transition data.")
+      .add_property(
+          "pinocchio",
+          bp::make_function(&ActionModelCentroidalTransition::get_pinocchio, bp::return_internal_reference<>()),
+          "multibody model (i.e. pinocchio model)")
+      .add_property("mass",
+                    bp::make_function(&ActionModelCentroidalTransition::get_mass,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    "total mass of the multibody system")
+      .add_property("inertia",
+                    bp::make_function(&ActionModelCentroidalTransition::get_inertia,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    bp::make_function(&ActionModelCentroidalTransition::set_inertia),
+                    "centroidal inertia of the centroidal model");
+
+  bp::register_ptr_to_python<boost::shared_ptr<ActionDataCentroidalTransition> >();
+
+  bp::class_<ActionDataCentroidalTransition, bp::bases<ActionDataAbstract> >(
+      "ActionDataCentroidalTransition", "Action data for the whole-body to centroidal transition.",
+      bp::init<ActionModelCentroidalTransition*>(bp::args("self", "model"),
+                                                 "Create centroidal transition data.\n\n"
+                                                 ":param model: centroidal transition model"))
+      .add_property("pinocchio",
+                    bp::make_getter(&ActionDataCentroidalTransition::pinocchio, bp::return_internal_reference<>()),
+                    "pinocchio data");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
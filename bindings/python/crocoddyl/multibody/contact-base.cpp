@@ -63,6 +63,9 @@ void exposeContactAbstract() {
            ":param data: Pinocchio data\n"
            ":return contact data.")
       .def("createData", &ContactModelAbstract_wrap::default_createData, bp::with_custodian_and_ward_postcall<0, 2>())
+      .def("clone", &ContactModelAbstract_wrap::clone, bp::args("self"),
+           "Clone the contact model.\n\n"
+           ":return cloned contact model.")
       .add_property(
           "state",
           bp::make_function(&ContactModelAbstract_wrap::get_state, bp::return_value_policy<bp::return_by_value>()),
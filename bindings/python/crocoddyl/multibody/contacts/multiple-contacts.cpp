@@ -101,6 +101,9 @@ void exposeContactMultiple() {
            "Create the total contact data.\n\n"
            ":param data: Pinocchio data\n"
            ":return total contact data.")
+      .def("clone", &ContactModelMultiple::clone, bp::args("self"),
+           "Clone the multi-contact model.\n\n"
+           ":return cloned multi-contact model.")
       .add_property(
           "contacts",
           bp::make_function(&ContactModelMultiple::get_contacts, bp::return_value_policy<bp::return_by_value>()),
@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "python/crocoddyl/multibody/multibody.hpp"
+#include "crocoddyl/multibody/costs/centroidal-com-position.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void exposeCostCentroidalCoMPosition() {
+  bp::class_<CostModelCentroidalCoMPosition, bp::bases<CostModelAbstract> >(
+      "CostModelCentroidalCoMPosition",
+      "This cost function defines a residual vector as r = c - cref, with c and cref as the current and reference "
+      "CoM position of the centroidal dynamics, respetively.",
+      bp::init<boost::shared_ptr<StateAbstract>, boost::shared_ptr<ActivationModelAbstract>, Eigen::Vector3d, int>(
+          bp::args("self", "state", "activation", "cref", "nu"),
+          "Initialize the centroidal CoM position cost model.\n\n"
+          ":param state: state of the centroidal system\n"
+          ":param activation: activation model\n"
+          ":param cref: reference CoM position\n"
+          ":param nu: dimension of control vector"))
+      .def(bp::init<boost::shared_ptr<StateAbstract>, Eigen::Vector3d, int>(
+          bp::args("self", "state", "cref", "nu"),
+          "Initialize the centroidal CoM position cost model.\n\n"
+          "We use ActivationModelQuad as a default activation model (i.e. a=0.5*||r||^2).\n"
+          ":param state: state of the centroidal system\n"
+          ":param cref: reference CoM position\n"
+          ":param nu: dimension of control vector"))
+      .def<void (CostModelCentroidalCoMPosition::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &CostModelCentroidalCoMPosition::calc, bp::args("self", "data", "x", "u"),
+          "Compute the centroidal CoM position cost.\n\n"
+          ":param data: cost data\n"
+          ":param x: time-discrete state vector\n"
+          ":param u: time-discrete control input")
+      .def<void (CostModelCentroidalCoMPosition::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &CostModelAbstract::calc, bp::args("self", "data", "x"))
+      .def<void (CostModelCentroidalCoMPosition::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &CostModelCentroidalCoMPosition::calcDiff, bp::args("self", "data", "x", "u"),
+          "Compute the derivatives of the centroidal CoM position cost.\n\n"
+          "It assumes that calc has been run first.\n"
+          ":param data: action data\n"
+          ":param x: time-discrete state vector\n"
+          ":param u: time-discrete control input\n")
+      .def<void (CostModelCentroidalCoMPosition::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                    const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &CostModelAbstract::calcDiff, bp::args("self", "data", "x"))
+      .add_property("reference", &CostModelCentroidalCoMPosition::get_reference<Eigen::Vector3d>,
+                    &CostModelCentroidalCoMPosition::set_reference<Eigen::Vector3d>, "reference CoM position");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
@@ -0,0 +1,68 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "python/crocoddyl/multibody/multibody.hpp"
+#include "crocoddyl/multibody/costs/centroidal-contact-force.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void exposeCostCentroidalContactForce() {
+  bp::class_<CostModelCentroidalContactForce, bp::bases<CostModelAbstract> >(
+      "CostModelCentroidalContactForce",
+      "This cost function defines a residual vector as r = f - fref, with f and fref as the current and reference "
+      "force of a contact of the centroidal dynamics, respetively.",
+      bp::init<boost::shared_ptr<StateAbstract>, boost::shared_ptr<ActivationModelAbstract>, std::size_t,
+               Eigen::Vector3d, int>(bp::args("self", "state", "activation", "id", "fref", "nu"),
+                                     "Initialize the centroidal contact force cost model.\n\n"
+                                     ":param state: state of the centroidal system\n"
+                                     ":param activation: activation model\n"
+                                     ":param id: contact index\n"
+                                     ":param fref: reference contact force\n"
+                                     ":param nu: dimension of control vector"))
+      .def(bp::init<boost::shared_ptr<StateAbstract>, std::size_t, Eigen::Vector3d, int>(
+          bp::args("self", "state", "id", "fref", "nu"),
+          "Initialize the centroidal contact force cost model.\n\n"
+          "We use ActivationModelQuad as a default activation model (i.e. a=0.5*||r||^2).\n"
+          ":param state: state of the centroidal system\n"
+          ":param id: contact index\n"
+          ":param fref: reference contact force\n"
+          ":param nu: dimension of control vector"))
+      .def<void (CostModelCentroidalContactForce::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &CostModelCentroidalContactForce::calc, bp::args("self", "data", "x", "u"),
+          "Compute the centroidal contact force cost.\n\n"
+          ":param data: cost data\n"
+          ":param x: time-discrete state vector\n"
+          ":param u: time-discrete control input")
+      .def<void (CostModelCentroidalContactForce::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &CostModelAbstract::calc, bp::args("self", "data", "x"))
+      .def<void (CostModelCentroidalContactForce::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &CostModelCentroidalContactForce::calcDiff, bp::args("self", "data", "x", "u"),
+          "Compute the derivatives of the centroidal contact force cost.\n\n"
+          "It assumes that calc has been run first.\n"
+          ":param data: action data\n"
+          ":param x: time-discrete state vector\n"
+          ":param u: time-discrete control input\n")
+      .def<void (CostModelCentroidalContactForce::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &CostModelAbstract::calcDiff, bp::args("self", "data", "x"))
+      .add_property("id",
+                    bp::make_function(&CostModelCentroidalContactForce::get_id,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    "contact index")
+      .add_property("reference", &CostModelCentroidalContactForce::get_reference<Eigen::Vector3d>,
+                    &CostModelCentroidalContactForce::set_reference<Eigen::Vector3d>, "reference contact force");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
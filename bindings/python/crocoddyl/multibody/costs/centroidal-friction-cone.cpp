@@ -0,0 +1,88 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "python/crocoddyl/multibody/multibody.hpp"
+#include "crocoddyl/multibody/costs/centroidal-friction-cone.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void exposeCostCentroidalFrictionCone() {
+  bp::class_<CostModelCentroidalFrictionCone, bp::bases<CostModelAbstract> >(
+      "CostModelCentroidalFrictionCone",
+      "This cost function defines a residual vector as r = A*f, where A, f describe the linearized friction cone "
+      "and the force of a contact of the centroidal dynamics, respectively.",
+      bp::init<boost::shared_ptr<StateAbstract>, boost::shared_ptr<ActivationModelAbstract>, std::size_t,
+               FrictionCone, int>(bp::args("self", "state", "activation", "id", "cone", "nu"),
+                                  "Initialize the centroidal friction cone cost model.\n\n"
+                                  ":param state: state of the centroidal system\n"
+                                  ":param activation: activation model\n"
+                                  ":param id: contact index\n"
+                                  ":param cone: friction cone\n"
+                                  ":param nu: dimension of control vector"))
+      .def(bp::init<boost::shared_ptr<StateAbstract>, std::size_t, FrictionCone, int>(
+          bp::args("self", "state", "id", "cone", "nu"),
+          "Initialize the centroidal friction cone cost model.\n\n"
+          "We use ActivationModelQuad as a default activation model (i.e. a=0.5*||r||^2).\n"
+          ":param state: state of the centroidal system\n"
+          ":param id: contact index\n"
+          ":param cone: friction cone\n"
+          ":param nu: dimension of control vector"))
+      .def<void (CostModelCentroidalFrictionCone::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &CostModelCentroidalFrictionCone::calc, bp::args("self", "data", "x", "u"),
+          "Compute the centroidal friction cone cost.\n\n"
+          ":param data: cost data\n"
+          ":param x: time-discrete state vector\n"
+          ":param u: time-discrete control input")
+      .def<void (CostModelCentroidalFrictionCone::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &CostModelAbstract::calc, bp::args("self", "data", "x"))
+      .def<void (CostModelCentroidalFrictionCone::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &CostModelCentroidalFrictionCone::calcDiff, bp::args("self", "data", "x", "u"),
+          "Compute the derivatives of the centroidal friction cone cost.\n\n"
+          "It assumes that calc has been run first.\n"
+          ":param data: action data\n"
+          ":param x: time-discrete state vector\n"
+          ":param u: time-discrete control input\n")
+      .def<void (CostModelCentroidalFrictionCone::*)(const boost::shared_ptr<CostDataAbstract>&,
+                                                     const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &CostModelAbstract::calcDiff, bp::args("self", "data", "x"))
+      .def("createData", &CostModelCentroidalFrictionCone::createData, bp::with_custodian_and_ward_postcall<0, 2>(),
+           bp::args("self", "data"),
+           "Create the centroidal friction cone cost data.\n\n"
+           "Each cost model has its own data that needs to be allocated. This function\n"
+           "returns the allocated data for a predefined cost.\n"
+           ":param data: shared data\n"
+           ":return cost data.")
+      .add_property("id",
+                    bp::make_function(&CostModelCentroidalFrictionCone::get_id,
+                                      bp::return_value_policy<bp::return_by_value>()),
+                    "contact index")
+      .add_property("reference", &CostModelCentroidalFrictionCone::get_reference<FrictionCone>,
+                    &CostModelCentroidalFrictionCone::set_reference<FrictionCone>, "reference friction cone");
+
+  bp::register_ptr_to_python<boost::shared_ptr<CostDataCentroidalFrictionCone> >();
+
+  bp::class_<CostDataCentroidalFrictionCone, bp::bases<CostDataAbstract> >(
+      "CostDataCentroidalFrictionCone", "Data for centroidal friction cone cost.\n\n",
+      bp::init<CostModelCentroidalFrictionCone*, DataCollectorAbstract*>(
+          bp::args("self", "model", "data"),
+          "Create centroidal friction cone cost data.\n\n"
+          ":param model: centroidal friction cone cost model\n"
+          ":param data: shared data")[bp::with_custodian_and_ward<1, 2, bp::with_custodian_and_ward<1, 3> >()])
+      .add_property("Arr_A",
+                    bp::make_getter(&CostDataCentroidalFrictionCone::Arr_A, bp::return_internal_reference<>()),
+                    "Intermediate product of Arr (2nd deriv of Activation) with A (cone matrix)");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
@@ -76,6 +76,20 @@ void exposeCostCoMPosition() {
            "returns the allocated data for a predefined cost.\n"
            ":param data: shared data\n"
            ":return cost data.")
+      .def("setNodeReference", &CostModelCoMPosition::set_nodeReference<Eigen::Vector3d>,
+           bp::args("self", "data", "ref"),
+           "Modify the reference CoM position of a given node.\n\n"
+           "The reference is stored in the cost data, and it overrides the model reference for this node.\n"
+           ":param data: cost data of the node\n"
+           ":param ref: reference CoM position")
+      .def("getNodeReference", &CostModelCoMPosition::get_nodeReference<Eigen::Vector3d>, bp::args("self", "data"),
+           "Return the reference CoM position used by a given node.\n\n"
+           ":param data: cost data of the node\n"
+           ":return reference CoM position")
+      .def("resetNodeReference", &CostModelCoMPosition::resetNodeParameters, bp::args("self", "data"),
+           "Clear the reference CoM position of a given node.\n\n"
+           "After it, the node uses the model reference again.\n"
+           ":param data: cost data of the node")
       .add_property("reference", &CostModelCoMPosition::get_reference<Eigen::Vector3d>,
                     &CostModelCoMPosition::set_reference<Eigen::Vector3d>, "reference CoM position")
       .add_property("cref",
@@ -76,6 +76,20 @@ void exposeCostFramePlacement() {
            "returns the allocated data for a predefined cost.\n"
            ":param data: shared data\n"
            ":return cost data.")
+      .def("setNodeReference", &CostModelFramePlacement::set_nodeReference<FramePlacement>,
+           bp::args("self", "data", "ref"),
+           "Modify the reference frame placement of a given node.\n\n"
+           "The reference is stored in the cost data, and it overrides the model reference for this node.\n"
+           ":param data: cost data of the node\n"
+           ":param ref: reference frame placement")
+      .def("getNodeReference", &CostModelFramePlacement::get_nodeReference<FramePlacement>, bp::args("self", "data"),
+           "Return the reference frame placement used by a given node.\n\n"
+           ":param data: cost data of the node\n"
+           ":return reference frame placement")
+      .def("resetNodeReference", &CostModelFramePlacement::resetNodeParameters, bp::args("self", "data"),
+           "Clear the reference frame placement of a given node.\n\n"
+           "After it, the node uses the model reference again.\n"
+           ":param data: cost data of the node")
       .add_property("reference", &CostModelFramePlacement::get_reference<FramePlacement>,
                     &CostModelFramePlacement::set_reference<FramePlacement>, "reference frame placement")
       .add_property("Mref",
@@ -76,6 +76,21 @@ void exposeCostFrameTranslation() {
            "returns the allocated data for a predefined cost.\n"
            ":param data: shared data\n"
            ":return cost data.")
+      .def("setNodeReference", &CostModelFrameTranslation::set_nodeReference<FrameTranslation>,
+           bp::args("self", "data", "ref"),
+           "Modify the reference frame translation of a given node.\n\n"
+           "The reference is stored in the cost data, and it overrides the model reference for this node.\n"
+           ":param data: cost data of the node\n"
+           ":param ref: reference frame translation")
+      .def("getNodeReference", &CostModelFrameTranslation::get_nodeReference<FrameTranslation>,
+           bp::args("self", "data"),
+           "Return the reference frame translation used by a given node.\n\n"
+           ":param data: cost data of the node\n"
+           ":return reference frame translation")
+      .def("resetNodeReference", &CostModelFrameTranslation::resetNodeParameters, bp::args("self", "data"),
+           "Clear the reference frame translation of a given node.\n\n"
+           "After it, the node uses the model reference again.\n"
+           ":param data: cost data of the node")
       .add_property("reference", &CostModelFrameTranslation::get_reference<FrameTranslation>,
                     &CostModelFrameTranslation::set_reference<FrameTranslation>, "reference frame translation")
       .add_property("xref",
@@ -101,6 +101,19 @@ void exposeCostState() {
            "returns the allocated data for a predefined cost.\n"
            ":param data: shared data\n"
            ":return cost data.")
+      .def("setNodeReference", &CostModelState::set_nodeReference<Eigen::VectorXd>, bp::args("self", "data", "ref"),
+           "Modify the reference state of a given node.\n\n"
+           "The reference is stored in the cost data, and it overrides the model reference for this node.\n"
+           ":param data: cost data of the node\n"
+           ":param ref: reference state")
+      .def("getNodeReference", &CostModelState::get_nodeReference<Eigen::VectorXd>, bp::args("self", "data"),
+           "Return the reference state used by a given node.\n\n"
+           ":param data: cost data of the node\n"
+           ":return reference state")
+      .def("resetNodeReference", &CostModelState::resetNodeParameters, bp::args("self", "data"),
+           "Clear the reference state of a given node.\n\n"
+           "After it, the node uses the model reference again.\n"
+           ":param data: cost data of the node")
       .add_property("reference", &CostModelState::get_reference<Eigen::VectorXd>,
                     &CostModelState::set_reference<Eigen::VectorXd>, "reference state")
       .add_property("xref",
@@ -56,6 +56,9 @@ void exposeImpulseAbstract() {
            ":param data: Pinocchio data\n"
            ":return impulse data.")
       .def("createData", &ImpulseModelAbstract_wrap::default_createData, bp::with_custodian_and_ward_postcall<0, 2>())
+      .def("clone", &ImpulseModelAbstract_wrap::clone, bp::args("self"),
+           "Clone the impulse model.\n\n"
+           ":return cloned impulse model.")
       .add_property(
           "state",
           bp::make_function(&ImpulseModelAbstract_wrap::get_state, bp::return_value_policy<bp::return_by_value>()),
@@ -99,6 +99,9 @@ void exposeImpulseMultiple() {
            "Create the total impulse data.\n\n"
            ":param data: Pinocchio data\n"
            ":return total impulse data.")
+      .def("clone", &ImpulseModelMultiple::clone, bp::args("self"),
+           "Clone the multi-impulse model.\n\n"
+           ":return cloned multi-impulse model.")
       .add_property(
           "impulses",
           bp::make_function(&ImpulseModelMultiple::get_impulses, bp::return_value_policy<bp::return_by_value>()),
@@ -28,10 +28,15 @@ void exposeMultibody() {
   exposeDataCollectorImpulses();
   exposeDifferentialActionFreeFwdDynamics();
   exposeDifferentialActionContactFwdDynamics();
+  exposeDifferentialActionCentroidalFwdDynamics();
   exposeActionImpulseFwdDynamics();
+  exposeActionCentroidalTransition();
   exposeCostState();
   exposeCostCoMPosition();
   exposeCostCentroidalMomentum();
+  exposeCostCentroidalCoMPosition();
+  exposeCostCentroidalContactForce();
+  exposeCostCentroidalFrictionCone();
   exposeCostFramePlacement();
   exposeCostFrameTranslation();
   exposeCostFrameRotation();
@@ -31,10 +31,15 @@ void exposeDataCollectorContacts();
 void exposeDataCollectorImpulses();
 void exposeDifferentialActionFreeFwdDynamics();
 void exposeDifferentialActionContactFwdDynamics();
+void exposeDifferentialActionCentroidalFwdDynamics();
 void exposeActionImpulseFwdDynamics();
+void exposeActionCentroidalTransition();
 void exposeCostState();
 void exposeCostCoMPosition();
 void exposeCostCentroidalMomentum();
+void exposeCostCentroidalCoMPosition();
+void exposeCostCentroidalContactForce();
+void exposeCostCentroidalFrictionCone();
 void exposeCostFramePlacement();
 void exposeCostFrameTranslation();
 void exposeCostFrameRotation();
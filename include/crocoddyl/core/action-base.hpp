@@ -108,6 +108,41 @@ class ActionModelAbstractTpl {
    */
   virtual boost::shared_ptr<ActionDataAbstract> createData();
 
+  /**
+   * @brief Clone the action model
+   *
+   * The cloned model shares the immutable parts of this model (e.g. the state, or the Pinocchio model), and it
+   * duplicates the parts that can be modified (e.g. its cost and contact models). It means that we can change the
+   * clone, or use it from another thread, without affecting this model.
+   *
+   * @return the cloned action model
+   */
+  virtual boost::shared_ptr<ActionModelAbstractTpl<Scalar> > clone() const;
+
+  /**
+   * @brief Copy the node parameters from one data of this model to another one
+   *
+   * The node parameters are the cost references and weights stored in the data of a node (see
+   * `CostModelAbstractTpl::set_nodeReference()` and `CostModelSumTpl::changeCostWeight()`). The code that
+   * creates another data for the same node (e.g. a copy of the problem, or the trial datas of a solver) uses it to
+   * keep them. By default, the model has no node parameters and nothing is copied.
+   *
+   * @param[in] from  Action data that stores the node parameters
+   * @param[in] to    Action data that receives the node parameters
+   */
+  virtual void copyNodeParameters(const boost::shared_ptr<ActionDataAbstract>& from,
+                                  const boost::shared_ptr<ActionDataAbstract>& to) const;
+
+  /**
+   * @brief Reset the node parameters of a data of this model
+   *
+   * After the reset, the data uses the references and weights of the model again. `ShootingProblemTpl` uses it when
+   * a data is recycled for another node. By default, the model has no node parameters and nothing is reset.
+   *
+   * @param[in] data  Action data
+   */
+  virtual void resetNodeParameters(const boost::shared_ptr<ActionDataAbstract>& data) const;
+
   /**
    * @brief Checks that a specific data belongs to this model
    */
@@ -61,8 +61,8 @@ void ActionModelAbstractTpl<Scalar>::quasiStatic(const boost::shared_ptr<ActionD
       calc(data, x, u);
       calcDiff(data, x, u);
       state_->diff(x, data->xnext, dx);
-      du.noalias() = -pseudoInverse(data->Fu) * dx;
-      u += du;
+      minimumNormSolve(data->Fu, dx, du);
+      u -= du;
       if (du.norm() <= tol) {
         break;
       }
@@ -85,6 +85,18 @@ boost::shared_ptr<ActionDataAbstractTpl<Scalar> > ActionModelAbstractTpl<Scalar>
   return boost::allocate_shared<ActionDataAbstract>(Eigen::aligned_allocator<ActionDataAbstract>(), this);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ActionModelAbstractTpl<Scalar> > ActionModelAbstractTpl<Scalar>::clone() const {
+  throw_pretty("It has not been implemented the clone() function");
+}
+
+template <typename Scalar>
+void ActionModelAbstractTpl<Scalar>::copyNodeParameters(const boost::shared_ptr<ActionDataAbstract>&,
+                                                        const boost::shared_ptr<ActionDataAbstract>&) const {}
+
+template <typename Scalar>
+void ActionModelAbstractTpl<Scalar>::resetNodeParameters(const boost::shared_ptr<ActionDataAbstract>&) const {}
+
 template <typename Scalar>
 bool ActionModelAbstractTpl<Scalar>::checkData(const boost::shared_ptr<ActionDataAbstract>&) {
   return false;
@@ -38,6 +38,7 @@ class DifferentialActionModelLQRTpl : public DifferentialActionModelAbstractTpl<
                         const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u);
   virtual boost::shared_ptr<DifferentialActionDataAbstract> createData();
   virtual bool checkData(const boost::shared_ptr<DifferentialActionDataAbstract>& data);
+  virtual boost::shared_ptr<Base> clone() const;
 
   const MatrixXs& get_Fq() const;
   const MatrixXs& get_Fv() const;
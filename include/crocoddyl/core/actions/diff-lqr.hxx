@@ -93,6 +93,12 @@ bool DifferentialActionModelLQRTpl<Scalar>::checkData(const boost::shared_ptr<Di
   }
 }
 
+template <typename Scalar>
+boost::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> > DifferentialActionModelLQRTpl<Scalar>::clone() const {
+  return boost::allocate_shared<DifferentialActionModelLQRTpl>(
+      Eigen::aligned_allocator<DifferentialActionModelLQRTpl>(), *this);
+}
+
 template <typename Scalar>
 const typename MathBaseTpl<Scalar>::MatrixXs& DifferentialActionModelLQRTpl<Scalar>::get_Fq() const {
   return Fq_;
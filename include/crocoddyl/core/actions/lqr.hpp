@@ -38,6 +38,7 @@ class ActionModelLQRTpl : public ActionModelAbstractTpl<_Scalar> {
                         const Eigen::Ref<const VectorXs>& u);
   virtual boost::shared_ptr<ActionDataAbstract> createData();
   virtual bool checkData(const boost::shared_ptr<ActionDataAbstract>& data);
+  virtual boost::shared_ptr<Base> clone() const;
 
   const MatrixXs& get_Fx() const;
   const MatrixXs& get_Fu() const;
@@ -84,6 +84,11 @@ bool ActionModelLQRTpl<Scalar>::checkData(const boost::shared_ptr<ActionDataAbst
   }
 }
 
+template <typename Scalar>
+boost::shared_ptr<ActionModelAbstractTpl<Scalar> > ActionModelLQRTpl<Scalar>::clone() const {
+  return boost::allocate_shared<ActionModelLQRTpl>(Eigen::aligned_allocator<ActionModelLQRTpl>(), *this);
+}
+
 template <typename Scalar>
 const typename MathBaseTpl<Scalar>::MatrixXs& ActionModelLQRTpl<Scalar>::get_Fx() const {
   return Fx_;
@@ -38,6 +38,7 @@ class ActionModelUnicycleTpl : public ActionModelAbstractTpl<_Scalar> {
                         const Eigen::Ref<const VectorXs>& u);
   virtual boost::shared_ptr<ActionDataAbstract> createData();
   virtual bool checkData(const boost::shared_ptr<ActionDataAbstract>& data);
+  virtual boost::shared_ptr<Base> clone() const;
 
   const Vector2s& get_cost_weights() const;
   void set_cost_weights(const Vector2s& weights);
@@ -87,6 +87,11 @@ bool ActionModelUnicycleTpl<Scalar>::checkData(const boost::shared_ptr<ActionDat
   }
 }
 
+template <typename Scalar>
+boost::shared_ptr<ActionModelAbstractTpl<Scalar> > ActionModelUnicycleTpl<Scalar>::clone() const {
+  return boost::allocate_shared<ActionModelUnicycleTpl>(Eigen::aligned_allocator<ActionModelUnicycleTpl>(), *this);
+}
+
 template <typename Scalar>
 const typename MathBaseTpl<Scalar>::Vector2s& ActionModelUnicycleTpl<Scalar>::get_cost_weights() const {
   return cost_weights_;
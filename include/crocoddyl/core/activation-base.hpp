@@ -16,6 +16,7 @@
 #include "crocoddyl/core/fwd.hpp"
 #include "crocoddyl/core/mathbase.hpp"
 #include "crocoddyl/core/utils/to-string.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
 
 namespace crocoddyl {
 
@@ -39,6 +40,13 @@ class ActivationModelAbstractTpl {
   virtual boost::shared_ptr<ActivationDataAbstract> createData() {
     return boost::allocate_shared<ActivationDataAbstract>(Eigen::aligned_allocator<ActivationDataAbstract>(), this);
   };
+  virtual boost::shared_ptr<ActivationModelAbstractTpl<Scalar> > clone() const {
+    throw_pretty("It has not been implemented the clone() function");
+  }
+  // Return true if the gradient and Hessian are zero at r, so the owning cost can skip its derivatives
+  virtual bool isInactive(const boost::shared_ptr<ActivationDataAbstract>&, const Eigen::Ref<const VectorXs>&) const {
+    return false;
+  }
 
   const std::size_t& get_nr() const { return nr_; };
 
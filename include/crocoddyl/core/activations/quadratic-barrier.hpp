@@ -11,6 +11,7 @@
 
 #include <stdexcept>
 #include <math.h>
+#include <boost/type_traits/is_floating_point.hpp>
 
 #include "crocoddyl/core/fwd.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
@@ -62,6 +63,14 @@ struct ActivationBoundsTpl {
   ActivationBoundsTpl(const ActivationBoundsTpl& bounds) : lb(bounds.lb), ub(bounds.ub), beta(bounds.beta) {}
   ActivationBoundsTpl() : beta(Scalar(1.)) {}
 
+  // Strict check, since the barrier Hessian is non-zero on the bounds. Symbolic scalars cannot be branched on.
+  bool isInside(const Eigen::Ref<const VectorXs>& r) const {
+    if (!boost::is_floating_point<Scalar>::value) {
+      return false;
+    }
+    return ((r - lb).array() > Scalar(0.)).all() && ((r - ub).array() < Scalar(0.)).all();
+  }
+
   VectorXs lb;
   VectorXs ub;
   Scalar beta;
@@ -91,7 +100,7 @@ class ActivationModelQuadraticBarrierTpl : public ActivationModelAbstractTpl<_Sc
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
 
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
 
     d->rlb_min_ = (r - bounds_.lb).array().min(Scalar(0.));
     d->rub_max_ = (r - bounds_.ub).array().max(Scalar(0.));
@@ -105,7 +114,7 @@ class ActivationModelQuadraticBarrierTpl : public ActivationModelAbstractTpl<_Sc
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
 
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
     data->Ar = (d->rlb_min_ + d->rub_max_).matrix();
 
     using pinocchio::internal::if_then_else;
@@ -120,6 +129,15 @@ class ActivationModelQuadraticBarrierTpl : public ActivationModelAbstractTpl<_Sc
     return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
   };
 
+  virtual bool isInactive(const boost::shared_ptr<ActivationDataAbstract>&, const Eigen::Ref<const VectorXs>& r) const {
+    return bounds_.isInside(r);
+  }
+
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<ActivationModelQuadraticBarrierTpl>(
+        Eigen::aligned_allocator<ActivationModelQuadraticBarrierTpl>(), *this);
+  }
+
   const ActivationBounds& get_bounds() const { return bounds_; };
   void set_bounds(const ActivationBounds& bounds) { bounds_ = bounds; };
 
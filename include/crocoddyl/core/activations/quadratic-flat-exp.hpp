@@ -72,7 +72,7 @@ class ActivationModelQuadFlatExpTpl : public ActivationModelAbstractTpl<_Scalar>
       throw_pretty("Invalid argument: "
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
 
     d->a0 = exp(-r.squaredNorm() / alpha_);
     data->a_value = Scalar(1.0) - d->a0;
@@ -89,7 +89,7 @@ class ActivationModelQuadFlatExpTpl : public ActivationModelAbstractTpl<_Scalar>
       throw_pretty("Invalid argument: "
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
 
     d->a1 = Scalar(2.0) / alpha_ * d->a0;
     data->Ar = d->a1 * r;
@@ -107,6 +107,11 @@ class ActivationModelQuadFlatExpTpl : public ActivationModelAbstractTpl<_Scalar>
     return data;
   };
 
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<ActivationModelQuadFlatExpTpl>(
+        Eigen::aligned_allocator<ActivationModelQuadFlatExpTpl>(), *this);
+  }
+
   Scalar get_alpha() const { return alpha_; };
   void set_alpha(const Scalar alpha) { alpha_ = alpha; };
 
@@ -71,7 +71,7 @@ class ActivationModelQuadFlatLogTpl : public ActivationModelAbstractTpl<_Scalar>
       throw_pretty("Invalid argument: "
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
     d->a0 = r.squaredNorm() / alpha_;
     data->a_value = log(Scalar(1.0) + d->a0);
   };
@@ -87,7 +87,7 @@ class ActivationModelQuadFlatLogTpl : public ActivationModelAbstractTpl<_Scalar>
       throw_pretty("Invalid argument: "
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
 
     d->a1 = Scalar(2.0) / (alpha_ + alpha_ * d->a0);
     data->Ar = d->a1 * r;
@@ -105,6 +105,11 @@ class ActivationModelQuadFlatLogTpl : public ActivationModelAbstractTpl<_Scalar>
     return data;
   };
 
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<ActivationModelQuadFlatLogTpl>(
+        Eigen::aligned_allocator<ActivationModelQuadFlatLogTpl>(), *this);
+  }
+
   Scalar get_alpha() const { return alpha_; };
   void set_alpha(const Scalar alpha) { alpha_ = alpha; };
 
@@ -58,6 +58,10 @@ class ActivationModelQuadTpl : public ActivationModelAbstractTpl<_Scalar> {
     return data;
   };
 
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<ActivationModelQuadTpl>(Eigen::aligned_allocator<ActivationModelQuadTpl>(), *this);
+  }
+
  protected:
   using Base::nr_;
 };
@@ -75,7 +75,7 @@ class ActivationModelSmooth1NormTpl : public ActivationModelAbstractTpl<_Scalar>
       throw_pretty("Invalid argument: "
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
 
     d->a = (r.array().cwiseAbs2().array() + eps_).array().cwiseSqrt();
     data->a_value = d->a.sum();
@@ -93,7 +93,7 @@ class ActivationModelSmooth1NormTpl : public ActivationModelAbstractTpl<_Scalar>
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
 
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
     data->Ar = r.cwiseProduct(d->a.cwiseInverse());
     data->Arr.diagonal() = d->a.cwiseProduct(d->a).cwiseProduct(d->a).cwiseInverse();
   };
@@ -107,6 +107,11 @@ class ActivationModelSmooth1NormTpl : public ActivationModelAbstractTpl<_Scalar>
     return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
   };
 
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<ActivationModelSmooth1NormTpl>(
+        Eigen::aligned_allocator<ActivationModelSmooth1NormTpl>(), *this);
+  }
+
  protected:
   using Base::nr_;  //!< Dimension of the residual vector
   Scalar eps_;      //!< Smoothing factor
@@ -98,6 +98,11 @@ class ActivationModelSmooth2NormTpl : public ActivationModelAbstractTpl<_Scalar>
     return boost::allocate_shared<ActivationDataAbstract>(Eigen::aligned_allocator<ActivationDataAbstract>(), this);
   };
 
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<ActivationModelSmooth2NormTpl>(
+        Eigen::aligned_allocator<ActivationModelSmooth2NormTpl>(), *this);
+  }
+
  protected:
   using Base::nr_;  //!< Dimension of the residual vector
   Scalar eps_;      //!< Smoothing factor
@@ -38,7 +38,7 @@ class ActivationModelWeightedQuadraticBarrierTpl : public ActivationModelAbstrac
       throw_pretty("Invalid argument: "
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
 
     d->rlb_min_ = (r - bounds_.lb).array().min(Scalar(0.));
     d->rub_max_ = (r - bounds_.ub).array().max(Scalar(0.));
@@ -53,7 +53,7 @@ class ActivationModelWeightedQuadraticBarrierTpl : public ActivationModelAbstrac
       throw_pretty("Invalid argument: "
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
     data->Ar = (d->rlb_min_ + d->rub_max_).matrix();
     data->Ar.array() *= weights_.array();
 
@@ -71,6 +71,15 @@ class ActivationModelWeightedQuadraticBarrierTpl : public ActivationModelAbstrac
     return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
   };
 
+  virtual bool isInactive(const boost::shared_ptr<ActivationDataAbstract>&, const Eigen::Ref<const VectorXs>& r) const {
+    return bounds_.isInside(r);
+  }
+
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<ActivationModelWeightedQuadraticBarrierTpl>(
+        Eigen::aligned_allocator<ActivationModelWeightedQuadraticBarrierTpl>(), *this);
+  }
+
   const ActivationBounds& get_bounds() const { return bounds_; };
   const VectorXs& get_weights() const { return weights_; };
   void set_bounds(const ActivationBounds& bounds) { bounds_ = bounds; };
@@ -39,7 +39,7 @@ class ActivationModelWeightedQuadTpl : public ActivationModelAbstractTpl<_Scalar
       throw_pretty("Invalid argument: "
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
 
     d->Wr = weights_.cwiseProduct(r);
     data->a_value = Scalar(0.5) * r.dot(d->Wr);
@@ -51,7 +51,7 @@ class ActivationModelWeightedQuadTpl : public ActivationModelAbstractTpl<_Scalar
                    << "r has wrong dimension (it should be " + std::to_string(nr_) + ")");
     }
 
-    boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+    Data* d = static_cast<Data*>(data.get());
     data->Ar = d->Wr;
     if (new_weights_) {
       data->Arr.diagonal() = weights_;
@@ -74,6 +74,11 @@ class ActivationModelWeightedQuadTpl : public ActivationModelAbstractTpl<_Scalar
     return data;
   };
 
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<ActivationModelWeightedQuadTpl>(
+        Eigen::aligned_allocator<ActivationModelWeightedQuadTpl>(), *this);
+  }
+
   const VectorXs& get_weights() const { return weights_; };
   void set_weights(const VectorXs& weights) {
     if (weights.size() != weights_.size()) {
@@ -48,6 +48,9 @@ class ActuationModelAbstractTpl {
   virtual boost::shared_ptr<ActuationDataAbstract> createData() {
     return boost::allocate_shared<ActuationDataAbstract>(Eigen::aligned_allocator<ActuationDataAbstract>(), this);
   };
+  virtual boost::shared_ptr<ActuationModelAbstractTpl<Scalar> > clone() const {
+    throw_pretty("It has not been implemented the clone() function");
+  }
 
   const std::size_t& get_nu() const { return nu_; };
   const boost::shared_ptr<StateAbstract>& get_state() const { return state_; };
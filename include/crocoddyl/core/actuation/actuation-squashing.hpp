@@ -38,7 +38,7 @@ class ActuationSquashingModelTpl : public ActuationModelAbstractTpl<_Scalar> {
 
   virtual void calc(const boost::shared_ptr<ActuationDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
                     const Eigen::Ref<const VectorXs>& u) {
-    boost::shared_ptr<Data> data_squashing = boost::static_pointer_cast<Data>(data);
+    Data* data_squashing = static_cast<Data*>(data.get());
 
     squashing_->calc(data_squashing->squashing, u);
     actuation_->calc(data_squashing->actuation, x, data_squashing->squashing->u);
@@ -47,7 +47,7 @@ class ActuationSquashingModelTpl : public ActuationModelAbstractTpl<_Scalar> {
 
   virtual void calcDiff(const boost::shared_ptr<ActuationDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
                         const Eigen::Ref<const VectorXs>& u) {
-    boost::shared_ptr<Data> data_squashing = boost::static_pointer_cast<Data>(data);
+    Data* data_squashing = static_cast<Data*>(data.get());
 
     squashing_->calcDiff(data_squashing->squashing, u);
     actuation_->calcDiff(data_squashing->actuation, x, data_squashing->squashing->u);
@@ -58,6 +58,14 @@ class ActuationSquashingModelTpl : public ActuationModelAbstractTpl<_Scalar> {
     return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
   };
 
+  virtual boost::shared_ptr<Base> clone() const {
+    boost::shared_ptr<ActuationSquashingModelTpl> model = boost::allocate_shared<ActuationSquashingModelTpl>(
+        Eigen::aligned_allocator<ActuationSquashingModelTpl>(), *this);
+    model->squashing_ = squashing_->clone();
+    model->actuation_ = actuation_->clone();
+    return model;
+  }
+
   const boost::shared_ptr<SquashingModelAbstract>& get_squashing() const { return squashing_; };
   const boost::shared_ptr<ActuationModelAbstract>& get_actuation() const { return actuation_; };
 
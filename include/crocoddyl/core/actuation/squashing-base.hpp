@@ -42,6 +42,9 @@ class SquashingModelAbstractTpl {
   virtual boost::shared_ptr<SquashingDataAbstract> createData() {
     return boost::allocate_shared<SquashingDataAbstract>(Eigen::aligned_allocator<SquashingDataAbstract>(), this);
   }
+  virtual boost::shared_ptr<SquashingModelAbstractTpl<Scalar> > clone() const {
+    throw_pretty("It has not been implemented the clone() function");
+  }
 
   const std::size_t& get_ns() const { return ns_; };
   const VectorXs& get_s_lb() const { return s_lb_; };
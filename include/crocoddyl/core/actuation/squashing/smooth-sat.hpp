@@ -61,6 +61,11 @@ class SquashingModelSmoothSatTpl : public SquashingModelAbstractTpl<_Scalar> {
          Eigen::pow(a_.array() + Eigen::pow((s - u_ub_).array(), 2), Scalar(-0.5)).array() * (s - u_ub_).array());
   }
 
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<SquashingModelSmoothSatTpl>(Eigen::aligned_allocator<SquashingModelSmoothSatTpl>(),
+                                                              *this);
+  }
+
   const Scalar& get_smooth() const { return smooth_; };
   void set_smooth(const Scalar& smooth) {
     if (smooth < 0.) {
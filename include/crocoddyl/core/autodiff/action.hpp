@@ -0,0 +1,333 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, INRIA, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_AUTODIFF_ACTION_HPP_
+#define CROCODDYL_CORE_AUTODIFF_ACTION_HPP_
+
+#include "pinocchio/autodiff/cppad.hpp"
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#include <omp.h>
+#include <mutex>
+#include <vector>
+#endif
+
+#include "crocoddyl/core/fwd.hpp"
+#include "crocoddyl/core/action-base.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+#ifdef CROCODDYL_WITH_MULTITHREADING
+/**
+ * @brief Thread numbers given to CppAD
+ *
+ * OpenMP numbers the threads of each team from zero, so the threads of concurrent teams (e.g. the ones of two
+ * asynchronous solves) share the same numbers. Instead, each thread takes the lowest number that is not used by
+ * another running thread of the process the first time it calls CppAD, and it releases this number when it exits.
+ * The number zero is kept by the first thread that asks for a number, i.e., the one that sets up CppAD.
+ */
+class CppADThreadNumber {
+ public:
+  /**
+   * @brief Return the number of the current thread, which is below `CPPAD_MAX_NUM_THREADS`
+   */
+  static std::size_t get() {
+    static thread_local const Handle handle;
+    return handle.id;
+  }
+
+ private:
+  struct Registry {
+    Registry() : next(0) {}
+    std::mutex mutex;
+    std::size_t next;                   //!< Lowest number never used
+    std::vector<std::size_t> released;  //!< Numbers released by the threads that exited
+  };
+
+  struct Handle {
+    Handle() : id(acquire()) {}
+    ~Handle() { release(id); }
+    const std::size_t id;
+  };
+
+  static Registry& registry() {
+    static Registry r;
+    return r;
+  }
+
+  static std::size_t acquire() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (!r.released.empty()) {
+      const std::size_t id = r.released.back();
+      r.released.pop_back();
+      return id;
+    }
+    if (r.next >= CPPAD_MAX_NUM_THREADS) {
+      throw_pretty("Invalid argument: "
+                   << "CppAD supports up to " + std::to_string(CPPAD_MAX_NUM_THREADS) + " running threads");
+    }
+    return r.next++;
+  }
+
+  static void release(const std::size_t id) {
+    if (id == 0) {
+      return;
+    }
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.released.push_back(id);
+  }
+};
+#endif
+
+/**
+ * @brief Action model whose derivatives are computed by automatic differentiation
+ *
+ * It records the calc of a model templated with `CppAD::AD<Scalar>` once, and it computes the derivatives by
+ * evaluating the (optimized) tape at runtime, i.e., without generating and compiling code as in
+ * `ActionModelCodeGenTpl`. The tape maps the tangent perturbation and control \f$(\delta\mathbf{x},\mathbf{u})\f$
+ * to the cost and the difference of the next state, i.e.,
+ * \f$(\ell(\mathbf{x}\oplus\delta\mathbf{x},\mathbf{u}), \mathbf{f}(\mathbf{x},\mathbf{u})\ominus
+ * \mathbf{f}(\mathbf{x}\oplus\delta\mathbf{x},\mathbf{u}))\f$, where the state \f$\mathbf{x}\f$ and next state
+ * \f$\mathbf{f}(\mathbf{x},\mathbf{u})\f$ are dynamic parameters. Its Jacobian and the Hessian of the cost at
+ * \f$\delta\mathbf{x}=\mathbf{0}\f$ give the exact derivatives of the action model.
+ *
+ * The tape keeps the comparisons of the model (e.g. the branches of a barrier activation). When any of them changes
+ * its result at the evaluated point, the data records its tape again at this point, so the derivatives always follow
+ * the branch taken by `calc()`. Each data owns a copy of the tape. With multithreading support, the constructor sets
+ * up CppAD for concurrent threads, so the datas can be evaluated (and recorded again) concurrently, e.g. by
+ * `ShootingProblem::calcDiff()` or by asynchronous solves. CppAD identifies the threads through
+ * `CppADThreadNumber`, and all the threads but the one that created the first model run in parallel mode.
+ */
+template <typename _Scalar>
+class ActionModelADTpl : public ActionModelAbstractTpl<_Scalar> {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef ActionModelAbstractTpl<Scalar> Base;
+  typedef ActionDataADTpl<Scalar> Data;
+  typedef ActionDataAbstractTpl<Scalar> ActionDataAbstract;
+  typedef typename MathBaseTpl<Scalar>::VectorXs VectorXs;
+
+  typedef CppAD::AD<Scalar> ADScalar;
+  typedef ActionModelAbstractTpl<ADScalar> ADBase;
+  typedef ActionDataAbstractTpl<ADScalar> ADActionDataAbstract;
+  typedef typename MathBaseTpl<ADScalar>::VectorXs ADVectorXs;
+  typedef CppAD::ADFun<Scalar> ADFun;
+
+  /**
+   * @brief Initialize the automatic-differentiation action model
+   *
+   * @param[in] ad_model  Action model templated with `CppAD::AD<Scalar>`, which is recorded
+   * @param[in] model     Same action model templated with `Scalar`, which is used by calc()
+   */
+  ActionModelADTpl(boost::shared_ptr<ADBase> ad_model, boost::shared_ptr<Base> model)
+      : Base(model->get_state(), model->get_nu(), model->get_nr()), model_(model), ad_model_(ad_model) {
+    setupParallelMode();
+    const VectorXs& x0 = state_->zero();
+    recordCalcDiff(tape_, x0, VectorXs::Zero(nu_), x0);
+  }
+  virtual ~ActionModelADTpl() {}
+
+  /**
+   * @brief Compute the next state and cost value through the original model
+   */
+  virtual void calc(const boost::shared_ptr<ActionDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                    const Eigen::Ref<const VectorXs>& u) {
+    Data* d = static_cast<Data*>(data.get());
+    model_->calc(d->data, x, u);
+    d->cost = d->data->cost;
+    d->xnext = d->data->xnext;
+  }
+
+  /**
+   * @brief Compute the derivatives of the dynamics and cost functions from the tape
+   *
+   * It assumes that `calc()` has been run first with the same state and control. If a comparison of the model
+   * changes its result with respect to the recording, then it records the tape of this data again.
+   */
+  virtual void calcDiff(const boost::shared_ptr<ActionDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                        const Eigen::Ref<const VectorXs>& u) {
+    Data* d = static_cast<Data*>(data.get());
+    const std::size_t& nx = state_->get_nx();
+    const std::size_t& ndx = state_->get_ndx();
+    d->P.head(nx) = x;
+    d->P.tail(nx) = d->xnext;
+    d->Z.head(ndx).setZero();
+    d->Z.tail(nu_) = u;
+    d->tape.new_dynamic(d->P);
+    d->J = d->tape.Jacobian(d->Z);
+    // The Jacobian runs a zero-order sweep, which counts the comparisons that differ from the recording
+    if (d->tape.compare_change_number() != 0) {
+      recordCalcDiff(d->tape, x, u, d->xnext);
+      d->J = d->tape.Jacobian(d->Z);
+    }
+    d->H = d->tape.Hessian(d->Z, 0);
+    d->distribute_derivatives();
+  }
+
+  virtual boost::shared_ptr<ActionDataAbstract> createData() {
+    return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
+  }
+
+  /**
+   * @brief Clone the automatic-differentiation model
+   *
+   * The clone wraps a clone of the original model and a copy of the tape, and it shares the model templated with
+   * `CppAD::AD<Scalar>`, which is only used to record the tape again.
+   */
+  virtual boost::shared_ptr<Base> clone() const {
+    boost::shared_ptr<ActionModelADTpl> model(new ActionModelADTpl(*this));
+    model->model_ = model_->clone();
+    return model;
+  }
+
+  /**
+   * @brief Return the original action model
+   */
+  const boost::shared_ptr<Base>& get_model() const { return model_; }
+
+  /**
+   * @brief Return the recorded tape
+   */
+  const ADFun& get_tape() const { return tape_; }
+
+ protected:
+  using Base::nu_;     //!< Control dimension
+  using Base::state_;  //!< Model of the state
+
+  /**
+   * @brief Copy the model (the tape is assigned, as some CppAD versions cannot copy-construct it)
+   */
+  ActionModelADTpl(const ActionModelADTpl& other) : Base(other), model_(other.model_), ad_model_(other.ad_model_) {
+    tape_ = other.tape_;
+  }
+
+ private:
+  /**
+   * @brief Record the tape at a given state and control
+   *
+   * The comparisons are recorded, and kept by the optimization, so `compare_change_number()` detects a branch change.
+   */
+  void recordCalcDiff(ADFun& tape, const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u,
+                      const Eigen::Ref<const VectorXs>& xnext) {
+    const std::size_t& nx = ad_model_->get_state()->get_nx();
+    const std::size_t& ndx = ad_model_->get_state()->get_ndx();
+    const boost::shared_ptr<ADActionDataAbstract> ad_data = ad_model_->createData();
+    ADVectorXs ad_Z = ADVectorXs::Zero(ndx + nu_);
+    ad_Z.tail(nu_) = u.template cast<ADScalar>();
+    ADVectorXs ad_P(2 * nx);
+    ad_P.head(nx) = x.template cast<ADScalar>();
+    ad_P.tail(nx) = xnext.template cast<ADScalar>();
+    ADVectorXs ad_x(nx), ad_Y(ndx + 1);
+
+    CppAD::Independent(ad_Z, 0, true, ad_P);
+    ad_model_->get_state()->integrate(ad_P.head(nx), ad_Z.head(ndx), ad_x);
+    ad_model_->calc(ad_data, ad_x, ad_Z.tail(nu_));
+    ad_Y[0] = ad_data->cost;
+    ad_model_->get_state()->diff(ad_P.tail(nx), ad_data->xnext, ad_Y.tail(ndx));
+    tape.Dependent(ad_Z, ad_Y);
+    tape.optimize();
+  }
+
+  /**
+   * @brief Set up CppAD for the OpenMP threads
+   *
+   * It needs to run in sequential mode, before any data is evaluated in a parallel region.
+   */
+  static void setupParallelMode() {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+    static bool is_setup = false;
+    if (is_setup) {
+      return;
+    }
+    if (inParallel()) {
+      throw_pretty("Invalid argument: "
+                   << "the automatic-differentiation model has to be created outside a parallel region and by "
+                      "the thread that created the first one");
+    }
+    CppAD::thread_alloc::parallel_setup(CPPAD_MAX_NUM_THREADS, inParallel, threadNumber);
+    CppAD::thread_alloc::hold_memory(true);
+    CppAD::parallel_ad<Scalar>();
+    is_setup = true;
+#endif
+  }
+
+#ifdef CROCODDYL_WITH_MULTITHREADING
+  static bool inParallel() { return omp_in_parallel() != 0 || CppADThreadNumber::get() != 0; }
+  static std::size_t threadNumber() { return CppADThreadNumber::get(); }
+#endif
+
+  boost::shared_ptr<Base> model_;
+  boost::shared_ptr<ADBase> ad_model_;
+  ADFun tape_;
+};
+
+template <typename _Scalar>
+struct ActionDataADTpl : public ActionDataAbstractTpl<_Scalar> {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef ActionDataAbstractTpl<Scalar> Base;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXs MatrixXs;
+  typedef Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMatrixXs;
+
+  template <template <typename Scalar> class Model>
+  explicit ActionDataADTpl(Model<Scalar>* const model)
+      : Base(model),
+        data(model->get_model()->createData()),
+        P(2 * model->get_state()->get_nx()),
+        Z(model->get_state()->get_ndx() + model->get_nu()),
+        J((model->get_state()->get_ndx() + 1) * (model->get_state()->get_ndx() + model->get_nu())),
+        H((model->get_state()->get_ndx() + model->get_nu()) * (model->get_state()->get_ndx() + model->get_nu())) {
+    tape = model->get_tape();
+    P.setZero();
+    Z.setZero();
+    J.setZero();
+    H.setZero();
+  }
+
+  void distribute_derivatives() {
+    const Eigen::DenseIndex ndx = Fx.rows();
+    const Eigen::DenseIndex nu = Fu.cols();
+    const Eigen::Map<const RowMatrixXs> Jac(J.data(), ndx + 1, ndx + nu);
+    const Eigen::Map<const MatrixXs> Hess(H.data(), ndx + nu, ndx + nu);
+    Lx = Jac.row(0).head(ndx).transpose();
+    Lu = Jac.row(0).tail(nu).transpose();
+    Fx = Jac.bottomLeftCorner(ndx, ndx);
+    Fu = Jac.bottomRightCorner(ndx, nu);
+    Lxx = Hess.topLeftCorner(ndx, ndx);
+    Lxu = Hess.topRightCorner(ndx, nu);
+    Luu = Hess.bottomRightCorner(nu, nu);
+  }
+
+  boost::shared_ptr<Base> data;  //!< Data of the original model
+  CppAD::ADFun<Scalar> tape;     //!< Copy of the tape (its sweeps store intermediate values)
+  VectorXs P;                    //!< Dynamic parameters: state and next state
+  VectorXs Z;                    //!< Independent variables: tangent perturbation and control
+  VectorXs J;                    //!< Jacobian of the tape (row major)
+  VectorXs H;                    //!< Hessian of the cost
+
+  using Base::cost;
+  using Base::Fu;
+  using Base::Fx;
+  using Base::Lu;
+  using Base::Luu;
+  using Base::Lx;
+  using Base::Lxu;
+  using Base::Lxx;
+  using Base::xnext;
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_AUTODIFF_ACTION_HPP_
@@ -11,12 +11,25 @@
 #define CROCODDYL_CORE_CODEGEN_ACTION_BASE_HPP_
 
 #include <functional>
+#include <memory>
 #include "pinocchio/codegen/cppadcg.hpp"
+#ifdef CROCODDYL_WITH_CODEGEN_LLVM
+#include <cppad/cg/model/llvm/llvm.hpp>
+#endif
 
 #include "crocoddyl/core/action-base.hpp"
 
 namespace crocoddyl {
 
+/**
+ * @brief Backends used to compile the code-generated functions
+ *
+ * `CodeGenDynamicLib` writes the sources, compiles them with GCC into a dynamic library and loads it.
+ * `CodeGenJit` compiles them in memory with LLVM/Clang inside the process. It requires to build Crocoddyl with
+ * `BUILD_WITH_CODEGEN_LLVM_SUPPORT`.
+ */
+enum CodeGenBackend { CodeGenDynamicLib = 0, CodeGenJit };
+
 template <typename Scalar>
 struct ActionDataCodeGenTpl;
 
@@ -49,7 +62,8 @@ class ActionModelCodeGenTpl : public ActionModelAbstractTpl<_Scalar> {
                         std::function<void(boost::shared_ptr<ADBase>, const Eigen::Ref<const ADVectorXs>&)>
                             fn_record_env = empty_record_env,
                         const std::string& function_name_calc = "calc",
-                        const std::string& function_name_calcDiff = "calcDiff")
+                        const std::string& function_name_calcDiff = "calcDiff",
+                        const CodeGenBackend backend = CodeGenDynamicLib)
       : Base(model->get_state(), model->get_nu()),
         model(model),
         ad_model(admodel),
@@ -66,7 +80,11 @@ class ActionModelCodeGenTpl : public ActionModelAbstractTpl<_Scalar> {
     const std::size_t& nu = ad_model->get_nu();
     ad_calcDiffout.resize(2 * ndx * ndx + 2 * ndx * nu + nu * nu + ndx + nu);
     initLib();
-    loadLib();
+    if (backend == CodeGenJit) {
+      loadJitLib();
+    } else {
+      loadLib();
+    }
   }
 
   static void empty_record_env(boost::shared_ptr<ADBase>, const Eigen::Ref<const ADVectorXs>&) {}
@@ -166,21 +184,47 @@ class ActionModelCodeGenTpl : public ActionModelAbstractTpl<_Scalar> {
   }
 
   void loadLib(const bool generate_if_not_exist = true) {
+    if (!libcgen_ptr) {
+      throw_pretty("Invalid argument: "
+                   << "a cloned model cannot load the library again");
+    }
     if (not existLib() && generate_if_not_exist) compileLib();
 
     const auto it = dynamicLibManager_ptr->getOptions().find("dlOpenMode");
     if (it == dynamicLibManager_ptr->getOptions().end()) {
-      dynamicLib_ptr.reset(new CppAD::cg::LinuxDynamicLib<Scalar>(
+      library_ptr.reset(new CppAD::cg::LinuxDynamicLib<Scalar>(
           dynamicLibManager_ptr->getLibraryName() + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION));
     } else {
       int dlOpenMode = std::stoi(it->second);
-      dynamicLib_ptr.reset(new CppAD::cg::LinuxDynamicLib<Scalar>(
+      library_ptr.reset(new CppAD::cg::LinuxDynamicLib<Scalar>(
           dynamicLibManager_ptr->getLibraryName() + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION,
           dlOpenMode));
     }
+  }
 
-    calcFun_ptr = dynamicLib_ptr->model(function_name_calc.c_str());
-    calcDiffFun_ptr = dynamicLib_ptr->model(function_name_calcDiff.c_str());
+  /// \brief Compile the recorded functions in memory with LLVM/Clang, and load them
+  ///
+  /// It neither needs a compiler on the target machine nor writes a dynamic library, so it is suitable to rebuild
+  /// the models at runtime (e.g., when the contact configuration changes).
+  ///
+  /// \param[in] opt_level  Optimization level used by Clang (from 0 to 3)
+  void loadJitLib(const std::size_t opt_level = 2) {
+    if (!libcgen_ptr) {
+      throw_pretty("Invalid argument: "
+                   << "a cloned model cannot load the library again");
+    }
+    if (opt_level > 3) {
+      throw_pretty("Invalid argument: "
+                   << "opt_level should be between 0 and 3");
+    }
+#ifdef CROCODDYL_WITH_CODEGEN_LLVM
+    CppAD::cg::LlvmModelLibraryProcessor<Scalar> processor(*libcgen_ptr);
+    processor.setCustomClangArgs(std::vector<std::string>(1, "-O" + std::to_string(opt_level)));
+    library_ptr = std::shared_ptr<CppAD::cg::ModelLibrary<Scalar> >(processor.create());
+#else
+    throw_pretty("Invalid argument: "
+                 << "the JIT backend requires to build with BUILD_WITH_CODEGEN_LLVM_SUPPORT");
+#endif
   }
 
   void set_env(const boost::shared_ptr<ActionDataAbstract>& data, const Eigen::Ref<const VectorXs>& env_val) const {
@@ -197,7 +241,7 @@ class ActionModelCodeGenTpl : public ActionModelAbstractTpl<_Scalar> {
     d->xu.head(nx) = x;
     d->xu.segment(nx, nu) = u;
 
-    calcFun_ptr->ForwardZero(d->xu, d->calcout);
+    d->calcFun->ForwardZero(d->xu, d->calcout);
     d->distribute_calcout();
   }
 
@@ -209,17 +253,42 @@ class ActionModelCodeGenTpl : public ActionModelAbstractTpl<_Scalar> {
 
     d->xu.head(nx) = x;
     d->xu.segment(nx, nu) = u;
-    calcDiffFun_ptr->ForwardZero(d->xu, d->calcDiffout);
+    d->calcDiffFun->ForwardZero(d->xu, d->calcDiffout);
     d->distribute_calcDiffout();
   }
 
+  /// \brief Create the data of the code-generated model
+  ///
+  /// Each data owns its evaluators of the loaded library, so different datas can be evaluated concurrently (e.g.,
+  /// by the parallel loops of the shooting problem). Note that datas created before `loadLib()` or `loadJitLib()`
+  /// keep evaluating the previously loaded library.
   boost::shared_ptr<ActionDataAbstract> createData() {
     return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
   }
 
+  /// \brief Clone the code-generated model
+  ///
+  /// The clone wraps a clone of the original model, and it shares the recorded model and the loaded library, i.e.
+  /// it neither records nor compiles the functions again. As it does not keep the source generators, it cannot load
+  /// the library again.
+  boost::shared_ptr<Base> clone() const {
+    boost::shared_ptr<ActionModelCodeGenTpl> model(new ActionModelCodeGenTpl(*this));
+    model->model = model->model->clone();
+    return model;
+  }
+
   /// \brief Dimension of the input vector
   Eigen::DenseIndex getInputDimension() const { return ad_X.size(); }
 
+  /// \brief Loaded library (either a dynamic library or a JIT-compiled one)
+  const std::shared_ptr<CppAD::cg::ModelLibrary<Scalar> >& get_library() const { return library_ptr; }
+
+  /// \brief Name of the calc function inside the library
+  const std::string& get_function_name_calc() const { return function_name_calc; }
+
+  /// \brief Name of the calcDiff function inside the library
+  const std::string& get_function_name_calcDiff() const { return function_name_calcDiff; }
+
  protected:
   using Base::has_control_limits_;  //!< Indicates whether any of the control limits
   using Base::nr_;                  //!< Dimension of the cost residual
@@ -229,6 +298,23 @@ class ActionModelCodeGenTpl : public ActionModelAbstractTpl<_Scalar> {
   using Base::u_ub_;                //!< Upper control limits
   using Base::unone_;               //!< Neutral state
 
+  /// \brief Copy the model, which shares the loaded library but not the source generators
+  ActionModelCodeGenTpl(const ActionModelCodeGenTpl& other)
+      : Base(other),
+        model(other.model),
+        ad_model(other.ad_model),
+        ad_data(other.ad_data),
+        function_name_calc(other.function_name_calc),
+        function_name_calcDiff(other.function_name_calcDiff),
+        library_name(other.library_name),
+        n_env(other.n_env),
+        fn_record_env(other.fn_record_env),
+        ad_X(other.ad_X),
+        ad_X2(other.ad_X2),
+        ad_calcout(other.ad_calcout),
+        ad_calcDiffout(other.ad_calcDiffout),
+        library_ptr(other.library_ptr) {}
+
   boost::shared_ptr<Base> model;
   boost::shared_ptr<ADBase> ad_model;
   boost::shared_ptr<ADActionDataAbstract> ad_data;
@@ -258,8 +344,7 @@ class ActionModelCodeGenTpl : public ActionModelAbstractTpl<_Scalar> {
   std::unique_ptr<CppAD::cg::ModelCSourceGen<Scalar> > calcgen_ptr, calcDiffgen_ptr;
   std::unique_ptr<CppAD::cg::ModelLibraryCSourceGen<Scalar> > libcgen_ptr;
   std::unique_ptr<CppAD::cg::DynamicModelLibraryProcessor<Scalar> > dynamicLibManager_ptr;
-  std::unique_ptr<CppAD::cg::DynamicLib<Scalar> > dynamicLib_ptr;
-  std::unique_ptr<CppAD::cg::GenericModel<Scalar> > calcFun_ptr, calcDiffFun_ptr;
+  std::shared_ptr<CppAD::cg::ModelLibrary<Scalar> > library_ptr;
 
 };  // struct CodeGenBase
 
@@ -288,6 +373,12 @@ struct ActionDataCodeGenTpl : public ActionDataAbstractTpl<_Scalar> {
 
   VectorXs calcDiffout;
 
+  /// \brief Library shared with the model (it outlives the evaluators of this data)
+  std::shared_ptr<CppAD::cg::ModelLibrary<Scalar> > library;
+
+  /// \brief Evaluators of the calc and calcDiff functions, with their own work buffers
+  std::unique_ptr<CppAD::cg::GenericModel<Scalar> > calcFun, calcDiffFun;
+
   void distribute_calcout() {
     cost = calcout[0];
     xnext = calcout.tail(xnext.size());
@@ -324,6 +415,9 @@ struct ActionDataCodeGenTpl : public ActionDataAbstractTpl<_Scalar> {
     const std::size_t& nu = model->get_nu();
     calcDiffout.resize(2 * ndx * ndx + 2 * ndx * nu + nu * nu + ndx + nu);
     calcDiffout.setZero();
+    library = m->get_library();
+    calcFun = library->model(m->get_function_name_calc());
+    calcDiffFun = library->model(m->get_function_name_calcDiff());
   }
 };
 
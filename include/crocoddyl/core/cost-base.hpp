@@ -41,6 +41,10 @@ namespace crocoddyl {
  * Additionally, it is important remark that `calcDiff()` computes the derivates using the latest stored values by
  * `calc()`. Thus, we need to run first `calc()`.
  *
+ * The cost reference is stored in the model, and it is shared by all the nodes that use it. Costs that support it
+ * can also store a reference in their data through `set_nodeReference()`, which allows a single model instance to
+ * serve nodes with different references.
+ *
  * \sa `StateAbstractTpl`, `ActivationModelAbstractTpl`, `calc()`, `calcDiff()`, `createData()`
  */
 template <typename _Scalar>
@@ -136,6 +140,36 @@ class CostModelAbstractTpl {
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
 
+  /**
+   * @brief Clone the cost model
+   *
+   * The cloned cost shares the state, and duplicates its activation model and reference.
+   *
+   * @return the cloned cost model
+   */
+  virtual boost::shared_ptr<CostModelAbstractTpl<Scalar> > clone() const;
+
+  /**
+   * @brief Copy the node reference from one data of this cost to another one
+   *
+   * By default, the cost has no node reference and nothing is copied (see `set_nodeReference()`).
+   *
+   * @param[in] from  Cost data that stores the node reference
+   * @param[in] to    Cost data that receives the node reference
+   */
+  virtual void copyNodeParameters(const boost::shared_ptr<CostDataAbstract>& from,
+                                  const boost::shared_ptr<CostDataAbstract>& to) const;
+
+  /**
+   * @brief Clear the node reference stored in a data of this cost
+   *
+   * After it, the node uses the model reference again. By default, the cost has no node reference and nothing is
+   * cleared.
+   *
+   * @param[in] data  Cost data of the node
+   */
+  virtual void resetNodeParameters(const boost::shared_ptr<CostDataAbstract>& data) const;
+
   /**
    * @copybrief calc()
    *
@@ -167,6 +201,29 @@ class CostModelAbstractTpl {
    */
   const std::size_t& get_nu() const;
 
+  /**
+   * @brief Indicate if the cost depends on the configuration
+   *
+   * When it is false, the derivatives are zero in the configuration rows of \f$\mathbf{x}\f$ (i.e. the first
+   * `ndx - nv` elements). `CostModelSumTpl` uses these flags to accumulate only the non-zero blocks.
+   */
+  bool get_q_dependent() const;
+
+  /**
+   * @brief Indicate if the cost depends on the velocity
+   *
+   * When it is false, the derivatives are zero in the velocity rows of \f$\mathbf{x}\f$ (i.e. the last `nv`
+   * elements).
+   */
+  bool get_v_dependent() const;
+
+  /**
+   * @brief Indicate if the cost depends on the control
+   *
+   * When it is false, \f$\mathbf{l_u}\f$, \f$\mathbf{l_{xu}}\f$ and \f$\mathbf{l_{uu}}\f$ are zero.
+   */
+  bool get_u_dependent() const;
+
   /**
    * @brief Modify the cost reference
    */
@@ -179,6 +236,27 @@ class CostModelAbstractTpl {
   template <class ReferenceType>
   ReferenceType get_reference() const;
 
+  /**
+   * @brief Modify the cost reference of a given node
+   *
+   * The reference is stored in the cost data, and it overrides the model reference for this node only.
+   *
+   * @param[in] data  Cost data of the node
+   * @param[in] ref   Cost reference
+   */
+  template <class ReferenceType>
+  void set_nodeReference(const boost::shared_ptr<CostDataAbstract>& data, ReferenceType ref);
+
+  /**
+   * @brief Return the cost reference used by a given node
+   *
+   * It returns the model reference if the node does not store its own reference.
+   *
+   * @param[in] data  Cost data of the node
+   */
+  template <class ReferenceType>
+  ReferenceType get_nodeReference(const boost::shared_ptr<CostDataAbstract>& data) const;
+
  protected:
   /**
    * @copybrief set_reference()
@@ -190,10 +268,25 @@ class CostModelAbstractTpl {
    */
   virtual void get_referenceImpl(const std::type_info&, void*) const;
 
+  /**
+   * @copybrief set_nodeReference()
+   */
+  virtual void set_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data, const std::type_info&,
+                                     const void*);
+
+  /**
+   * @copybrief get_nodeReference()
+   */
+  virtual void get_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data, const std::type_info&,
+                                     void*) const;
+
   boost::shared_ptr<StateAbstract> state_;                 //!< State description
   boost::shared_ptr<ActivationModelAbstract> activation_;  //!< Activation model
   std::size_t nu_;                                         //!< Control dimension
   VectorXs unone_;                                         //!< No control vector
+  bool q_dependent_;                                       //!< Label that indicates if the cost depends on q
+  bool v_dependent_;                                       //!< Label that indicates if the cost depends on v
+  bool u_dependent_;                                       //!< Label that indicates if the cost depends on u
 };
 
 template <typename _Scalar>
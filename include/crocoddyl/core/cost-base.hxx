@@ -12,24 +12,45 @@ template <typename Scalar>
 CostModelAbstractTpl<Scalar>::CostModelAbstractTpl(boost::shared_ptr<StateAbstract> state,
                                                    boost::shared_ptr<ActivationModelAbstract> activation,
                                                    const std::size_t& nu)
-    : state_(state), activation_(activation), nu_(nu), unone_(VectorXs::Zero(nu)) {}
+    : state_(state),
+      activation_(activation),
+      nu_(nu),
+      unone_(VectorXs::Zero(nu)),
+      q_dependent_(true),
+      v_dependent_(true),
+      u_dependent_(true) {}
 
 template <typename Scalar>
 CostModelAbstractTpl<Scalar>::CostModelAbstractTpl(boost::shared_ptr<StateAbstract> state,
                                                    boost::shared_ptr<ActivationModelAbstract> activation)
-    : state_(state), activation_(activation), nu_(state->get_nv()), unone_(VectorXs::Zero(state->get_nv())) {}
+    : state_(state),
+      activation_(activation),
+      nu_(state->get_nv()),
+      unone_(VectorXs::Zero(state->get_nv())),
+      q_dependent_(true),
+      v_dependent_(true),
+      u_dependent_(true) {}
 
 template <typename Scalar>
 CostModelAbstractTpl<Scalar>::CostModelAbstractTpl(boost::shared_ptr<StateAbstract> state, const std::size_t& nr,
                                                    const std::size_t& nu)
-    : state_(state), activation_(boost::make_shared<ActivationModelQuad>(nr)), nu_(nu), unone_(VectorXs::Zero(nu)) {}
+    : state_(state),
+      activation_(boost::make_shared<ActivationModelQuad>(nr)),
+      nu_(nu),
+      unone_(VectorXs::Zero(nu)),
+      q_dependent_(true),
+      v_dependent_(true),
+      u_dependent_(true) {}
 
 template <typename Scalar>
 CostModelAbstractTpl<Scalar>::CostModelAbstractTpl(boost::shared_ptr<StateAbstract> state, const std::size_t& nr)
     : state_(state),
       activation_(boost::make_shared<ActivationModelQuad>(nr)),
       nu_(state->get_nv()),
-      unone_(VectorXs::Zero(state->get_nv())) {}
+      unone_(VectorXs::Zero(state->get_nv())),
+      q_dependent_(true),
+      v_dependent_(true),
+      u_dependent_(true) {}
 
 template <typename Scalar>
 CostModelAbstractTpl<Scalar>::~CostModelAbstractTpl() {}
@@ -52,6 +73,18 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelAbstractTpl<Scalar>::cr
   return boost::allocate_shared<CostDataAbstract>(Eigen::aligned_allocator<CostDataAbstract>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelAbstractTpl<Scalar>::clone() const {
+  throw_pretty("It has not been implemented the clone() function");
+}
+
+template <typename Scalar>
+void CostModelAbstractTpl<Scalar>::copyNodeParameters(const boost::shared_ptr<CostDataAbstract>&,
+                                                      const boost::shared_ptr<CostDataAbstract>&) const {}
+
+template <typename Scalar>
+void CostModelAbstractTpl<Scalar>::resetNodeParameters(const boost::shared_ptr<CostDataAbstract>&) const {}
+
 template <typename Scalar>
 const boost::shared_ptr<StateAbstractTpl<Scalar> >& CostModelAbstractTpl<Scalar>::get_state() const {
   return state_;
@@ -67,6 +100,21 @@ const std::size_t& CostModelAbstractTpl<Scalar>::get_nu() const {
   return nu_;
 }
 
+template <typename Scalar>
+bool CostModelAbstractTpl<Scalar>::get_q_dependent() const {
+  return q_dependent_;
+}
+
+template <typename Scalar>
+bool CostModelAbstractTpl<Scalar>::get_v_dependent() const {
+  return v_dependent_;
+}
+
+template <typename Scalar>
+bool CostModelAbstractTpl<Scalar>::get_u_dependent() const {
+  return u_dependent_;
+}
+
 template <typename Scalar>
 template <class ReferenceType>
 void CostModelAbstractTpl<Scalar>::set_reference(ReferenceType ref) {
@@ -91,4 +139,31 @@ void CostModelAbstractTpl<Scalar>::get_referenceImpl(const std::type_info&, void
   throw_pretty("It has not been implemented the set_referenceImpl() function");
 }
 
+template <typename Scalar>
+template <class ReferenceType>
+void CostModelAbstractTpl<Scalar>::set_nodeReference(const boost::shared_ptr<CostDataAbstract>& data,
+                                                     ReferenceType ref) {
+  set_nodeReferenceImpl(data, typeid(ref), &ref);
+}
+
+template <typename Scalar>
+void CostModelAbstractTpl<Scalar>::set_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>&,
+                                                         const std::type_info&, const void*) {
+  throw_pretty("It has not been implemented the set_nodeReferenceImpl() function");
+}
+
+template <typename Scalar>
+template <class ReferenceType>
+ReferenceType CostModelAbstractTpl<Scalar>::get_nodeReference(const boost::shared_ptr<CostDataAbstract>& data) const {
+  ReferenceType ref;
+  get_nodeReferenceImpl(data, typeid(ref), &ref);
+  return ref;
+}
+
+template <typename Scalar>
+void CostModelAbstractTpl<Scalar>::get_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>&,
+                                                         const std::type_info&, void*) const {
+  throw_pretty("It has not been implemented the get_nodeReferenceImpl() function");
+}
+
 }  // namespace crocoddyl
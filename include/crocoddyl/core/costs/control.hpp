@@ -133,6 +133,11 @@ class CostModelControlTpl : public CostModelAbstractTpl<_Scalar> {
   virtual void calcDiff(const boost::shared_ptr<CostDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
                         const Eigen::Ref<const VectorXs>& u);
 
+  /**
+   * @brief Clone the control cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
   DEPRECATED("Use set_reference<MathbTpl<Scalare>::VectorXs>()", void set_uref(const VectorXs& uref_in));
   DEPRECATED("Use get_reference<MathbTpl<Scalare>::VectorXs>()", const VectorXs& get_uref() const);
 
@@ -149,8 +154,10 @@ class CostModelControlTpl : public CostModelAbstractTpl<_Scalar> {
 
   using Base::activation_;
   using Base::nu_;
+  using Base::q_dependent_;
   using Base::state_;
   using Base::unone_;
+  using Base::v_dependent_;
 
  private:
   VectorXs uref_;  //!< Reference control input
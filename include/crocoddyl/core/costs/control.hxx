@@ -14,6 +14,8 @@ CostModelControlTpl<Scalar>::CostModelControlTpl(boost::shared_ptr<typename Base
                                                  boost::shared_ptr<ActivationModelAbstract> activation,
                                                  const VectorXs& uref)
     : Base(state, activation, static_cast<std::size_t>(uref.size())), uref_(uref) {
+  q_dependent_ = false;
+  v_dependent_ = false;
   if (activation_->get_nr() != nu_) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to " + std::to_string(nu_));
@@ -23,13 +25,18 @@ CostModelControlTpl<Scalar>::CostModelControlTpl(boost::shared_ptr<typename Base
 template <typename Scalar>
 CostModelControlTpl<Scalar>::CostModelControlTpl(boost::shared_ptr<typename Base::StateAbstract> state,
                                                  boost::shared_ptr<ActivationModelAbstract> activation)
-    : Base(state, activation), uref_(VectorXs::Zero(activation->get_nr())) {}
+    : Base(state, activation), uref_(VectorXs::Zero(activation->get_nr())) {
+  q_dependent_ = false;
+  v_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelControlTpl<Scalar>::CostModelControlTpl(boost::shared_ptr<typename Base::StateAbstract> state,
                                                  boost::shared_ptr<ActivationModelAbstract> activation,
                                                  const std::size_t& nu)
     : Base(state, activation, nu), uref_(VectorXs::Zero(nu)) {
+  q_dependent_ = false;
+  v_dependent_ = false;
   if (activation_->get_nr() != nu_) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to " + std::to_string(nu_));
@@ -39,16 +46,25 @@ CostModelControlTpl<Scalar>::CostModelControlTpl(boost::shared_ptr<typename Base
 template <typename Scalar>
 CostModelControlTpl<Scalar>::CostModelControlTpl(boost::shared_ptr<typename Base::StateAbstract> state,
                                                  const VectorXs& uref)
-    : Base(state, static_cast<std::size_t>(uref.size()), static_cast<std::size_t>(uref.size())), uref_(uref) {}
+    : Base(state, static_cast<std::size_t>(uref.size()), static_cast<std::size_t>(uref.size())), uref_(uref) {
+  q_dependent_ = false;
+  v_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelControlTpl<Scalar>::CostModelControlTpl(boost::shared_ptr<typename Base::StateAbstract> state)
-    : Base(state, state->get_nv()), uref_(VectorXs::Zero(state->get_nv())) {}
+    : Base(state, state->get_nv()), uref_(VectorXs::Zero(state->get_nv())) {
+  q_dependent_ = false;
+  v_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelControlTpl<Scalar>::CostModelControlTpl(boost::shared_ptr<typename Base::StateAbstract> state,
                                                  const std::size_t& nu)
-    : Base(state, nu, nu), uref_(VectorXs::Zero(nu)) {}
+    : Base(state, nu, nu), uref_(VectorXs::Zero(nu)) {
+  q_dependent_ = false;
+  v_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelControlTpl<Scalar>::~CostModelControlTpl() {}
@@ -87,6 +103,14 @@ void CostModelControlTpl<Scalar>::calcDiff(const boost::shared_ptr<CostDataAbstr
   data->Luu.diagonal() = data->activation->Arr.diagonal();
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelControlTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelControlTpl> model =
+      boost::allocate_shared<CostModelControlTpl>(Eigen::aligned_allocator<CostModelControlTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelControlTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(VectorXs)) {
@@ -116,6 +116,40 @@ class CostModelSumTpl {
    */
   void changeCostStatus(const std::string& name, bool active);
 
+  /**
+   * @brief Change the cost weight of a given node
+   *
+   * The weight is stored in the cost data, and it overrides the weight of the cost item for this node only.
+   *
+   * @param[in] data    Cost data of the node
+   * @param[in] name    Cost name
+   * @param[in] weight  Cost weight
+   */
+  void changeCostWeight(const boost::shared_ptr<CostDataSum>& data, const std::string& name, const Scalar& weight);
+
+  /**
+   * @brief Change the cost reference of a given node
+   *
+   * The reference is stored in the data of the cost item (see `CostModelAbstractTpl::set_nodeReference()`), and it
+   * overrides the model reference for this node only.
+   *
+   * @param[in] data  Cost data of the node
+   * @param[in] name  Cost name
+   * @param[in] ref   Cost reference
+   */
+  template <class ReferenceType>
+  void changeCostReference(const boost::shared_ptr<CostDataSum>& data, const std::string& name, ReferenceType ref);
+
+  /**
+   * @brief Clear the cost reference of a given node
+   *
+   * After it, the node uses the model reference of the cost item again.
+   *
+   * @param[in] data  Cost data of the node
+   * @param[in] name  Cost name
+   */
+  void resetCostReference(const boost::shared_ptr<CostDataSum>& data, const std::string& name);
+
   /**
    * @brief Compute the total cost value
    *
@@ -148,6 +182,30 @@ class CostModelSumTpl {
    */
   boost::shared_ptr<CostDataSum> createData(DataCollectorAbstract* const data);
 
+  /**
+   * @brief Clone the cost sum
+   *
+   * The cloned cost sum has its own copy of each cost item, whose cost model is cloned as well.
+   *
+   * @return the cloned cost sum
+   */
+  boost::shared_ptr<CostModelSumTpl<Scalar> > clone() const;
+
+  /**
+   * @brief Copy the node weights and references from one data of this cost sum to another one
+   *
+   * @param[in] from  Cost data that stores the node parameters
+   * @param[in] to    Cost data that receives the node parameters
+   */
+  void copyNodeParameters(const boost::shared_ptr<CostDataSum>& from, const boost::shared_ptr<CostDataSum>& to) const;
+
+  /**
+   * @brief Clear the node weights and references stored in a data of this cost sum
+   *
+   * @param[in] data  Cost data of the node
+   */
+  void resetNodeParameters(const boost::shared_ptr<CostDataSum>& data) const;
+
   /**
    * @copybrief calc()
    *
@@ -206,7 +264,18 @@ class CostModelSumTpl {
    */
   bool getCostStatus(const std::string& name) const;
 
+  /**
+   * @brief Return the weight of a given cost name used by a given node
+   *
+   * @param[in] data  Cost data of the node
+   * @param[in] name  Cost name
+   */
+  Scalar getCostWeight(const boost::shared_ptr<CostDataSum>& data, const std::string& name) const;
+
  private:
+  Scalar getWeight(const boost::shared_ptr<CostDataSum>& data,
+                   const typename CostModelContainer::const_iterator& it) const;
+
   boost::shared_ptr<StateAbstract> state_;  //!< State description
   CostModelContainer costs_;                //!< Stack of cost items
   std::size_t nu_;                          //!< Dimension of the control input
@@ -237,6 +306,7 @@ struct CostDataSumTpl {
         Luu_internal(model->get_nu(), model->get_nu()),
         shared(data),
         cost(Scalar(0.)),
+        nskip(0),
         Lx(Lx_internal.data(), model->get_state()->get_ndx()),
         Lu(Lu_internal.data(), model->get_nu()),
         Lxx(Lxx_internal.data(), model->get_state()->get_ndx(), model->get_state()->get_ndx()),
@@ -317,8 +387,10 @@ struct CostDataSumTpl {
   MatrixXs Luu_internal;
 
   typename CostModelSumTpl<Scalar>::CostDataContainer costs;
+  std::map<std::string, Scalar> weights;  //!< Cost weights that are overridden in this node
   DataCollectorAbstract* shared;
   Scalar cost;
+  std::size_t nskip;  //!< Number of cost derivatives skipped because their activation was inactive
   Eigen::Map<VectorXs> Lx;
   Eigen::Map<VectorXs> Lu;
   Eigen::Map<MatrixXs> Lxx;
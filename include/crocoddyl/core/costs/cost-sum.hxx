@@ -85,6 +85,43 @@ void CostModelSumTpl<Scalar>::changeCostStatus(const std::string& name, bool act
   }
 }
 
+template <typename Scalar>
+void CostModelSumTpl<Scalar>::changeCostWeight(const boost::shared_ptr<CostDataSum>& data, const std::string& name,
+                                               const Scalar& weight) {
+  if (costs_.find(name) != costs_.end()) {
+    data->weights[name] = weight;
+  } else {
+    std::cout << "Warning: we couldn't change the weight of the " << name << " cost item, it doesn't exist."
+              << std::endl;
+  }
+}
+
+template <typename Scalar>
+template <class ReferenceType>
+void CostModelSumTpl<Scalar>::changeCostReference(const boost::shared_ptr<CostDataSum>& data,
+                                                  const std::string& name, ReferenceType ref) {
+  typename CostModelContainer::iterator it_m = costs_.find(name);
+  typename CostDataContainer::iterator it_d = data->costs.find(name);
+  if (it_m != costs_.end() && it_d != data->costs.end()) {
+    it_m->second->cost->set_nodeReference(it_d->second, ref);
+  } else {
+    std::cout << "Warning: we couldn't change the reference of the " << name << " cost item, it doesn't exist."
+              << std::endl;
+  }
+}
+
+template <typename Scalar>
+void CostModelSumTpl<Scalar>::resetCostReference(const boost::shared_ptr<CostDataSum>& data, const std::string& name) {
+  typename CostModelContainer::iterator it_m = costs_.find(name);
+  typename CostDataContainer::iterator it_d = data->costs.find(name);
+  if (it_m != costs_.end() && it_d != data->costs.end()) {
+    it_m->second->cost->resetNodeParameters(it_d->second);
+  } else {
+    std::cout << "Warning: we couldn't reset the reference of the " << name << " cost item, it doesn't exist."
+              << std::endl;
+  }
+}
+
 template <typename Scalar>
 void CostModelSumTpl<Scalar>::calc(const boost::shared_ptr<CostDataSum>& data, const Eigen::Ref<const VectorXs>& x,
                                    const Eigen::Ref<const VectorXs>& u) {
@@ -113,7 +150,7 @@ void CostModelSumTpl<Scalar>::calc(const boost::shared_ptr<CostDataSum>& data, c
                                                     << it_m->first << " != " << it_d->first << ")");
 
       m_i->cost->calc(d_i, x, u);
-      data->cost += m_i->weight * d_i->cost;
+      data->cost += getWeight(data, it_m) * d_i->cost;
     }
   }
 }
@@ -139,6 +176,8 @@ void CostModelSumTpl<Scalar>::calcDiff(const boost::shared_ptr<CostDataSum>& dat
   data->Lxu.setZero();
   data->Luu.setZero();
 
+  const std::size_t& nv = state_->get_nv();
+  const std::size_t ndq = state_->get_ndx() - nv;
   typename CostModelContainer::iterator it_m, end_m;
   typename CostDataContainer::iterator it_d, end_d;
   for (it_m = costs_.begin(), end_m = costs_.end(), it_d = data->costs.begin(), end_d = data->costs.end();
@@ -149,12 +188,37 @@ void CostModelSumTpl<Scalar>::calcDiff(const boost::shared_ptr<CostDataSum>& dat
       assert_pretty(it_m->first == it_d->first, "it doesn't match the cost name between model and data ("
                                                     << it_m->first << " != " << it_d->first << ")");
 
+      // An inactive barrier has zero gradient and Hessian, so its cost derivatives are not needed
+      if (m_i->cost->get_activation()->isInactive(d_i->activation, d_i->r)) {
+        ++data->nskip;
+        continue;
+      }
       m_i->cost->calcDiff(d_i, x, u);
-      data->Lx += m_i->weight * d_i->Lx;
-      data->Lu += m_i->weight * d_i->Lu;
-      data->Lxx += m_i->weight * d_i->Lxx;
-      data->Lxu += m_i->weight * d_i->Lxu;
-      data->Luu += m_i->weight * d_i->Luu;
+      const Scalar weight = getWeight(data, it_m);
+      // Accumulate only the blocks in which the cost derivatives can be non-zero
+      const bool q_dependent = m_i->cost->get_q_dependent();
+      const bool v_dependent = m_i->cost->get_v_dependent();
+      if (q_dependent && v_dependent) {
+        data->Lx += weight * d_i->Lx;
+        data->Lxx += weight * d_i->Lxx;
+      } else if (q_dependent) {
+        data->Lx.head(ndq) += weight * d_i->Lx.head(ndq);
+        data->Lxx.topLeftCorner(ndq, ndq) += weight * d_i->Lxx.topLeftCorner(ndq, ndq);
+      } else if (v_dependent) {
+        data->Lx.tail(nv) += weight * d_i->Lx.tail(nv);
+        data->Lxx.bottomRightCorner(nv, nv) += weight * d_i->Lxx.bottomRightCorner(nv, nv);
+      }
+      if (m_i->cost->get_u_dependent()) {
+        data->Lu += weight * d_i->Lu;
+        data->Luu += weight * d_i->Luu;
+        if (q_dependent && v_dependent) {
+          data->Lxu += weight * d_i->Lxu;
+        } else if (q_dependent) {
+          data->Lxu.topRows(ndq) += weight * d_i->Lxu.topRows(ndq);
+        } else if (v_dependent) {
+          data->Lxu.bottomRows(nv) += weight * d_i->Lxu.bottomRows(nv);
+        }
+      }
     }
   }
 }
@@ -164,6 +228,38 @@ boost::shared_ptr<CostDataSumTpl<Scalar> > CostModelSumTpl<Scalar>::createData(D
   return boost::allocate_shared<CostDataSum>(Eigen::aligned_allocator<CostDataSum>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelSumTpl<Scalar> > CostModelSumTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelSumTpl> model =
+      boost::allocate_shared<CostModelSumTpl>(Eigen::aligned_allocator<CostModelSumTpl>(), *this);
+  for (typename CostModelContainer::iterator it = model->costs_.begin(); it != model->costs_.end(); ++it) {
+    const CostItem& item = *it->second;
+    it->second = boost::make_shared<CostItem>(item.name, item.cost->clone(), item.weight, item.active);
+  }
+  return model;
+}
+
+template <typename Scalar>
+void CostModelSumTpl<Scalar>::copyNodeParameters(const boost::shared_ptr<CostDataSum>& from,
+                                                 const boost::shared_ptr<CostDataSum>& to) const {
+  to->weights = from->weights;
+  typename CostDataContainer::const_iterator it_f = from->costs.begin();
+  typename CostDataContainer::const_iterator it_t = to->costs.begin();
+  for (typename CostModelContainer::const_iterator it_m = costs_.begin(); it_m != costs_.end();
+       ++it_m, ++it_f, ++it_t) {
+    it_m->second->cost->copyNodeParameters(it_f->second, it_t->second);
+  }
+}
+
+template <typename Scalar>
+void CostModelSumTpl<Scalar>::resetNodeParameters(const boost::shared_ptr<CostDataSum>& data) const {
+  data->weights.clear();
+  typename CostDataContainer::const_iterator it_d = data->costs.begin();
+  for (typename CostModelContainer::const_iterator it_m = costs_.begin(); it_m != costs_.end(); ++it_m, ++it_d) {
+    it_m->second->cost->resetNodeParameters(it_d->second);
+  }
+}
+
 template <typename Scalar>
 void CostModelSumTpl<Scalar>::calc(const boost::shared_ptr<CostDataSumTpl<Scalar> >& data,
                                    const Eigen::Ref<const VectorXs>& x) {
@@ -211,6 +307,18 @@ const std::vector<std::string>& CostModelSumTpl<Scalar>::get_inactive() const {
   return inactive_;
 }
 
+template <typename Scalar>
+Scalar CostModelSumTpl<Scalar>::getCostWeight(const boost::shared_ptr<CostDataSum>& data,
+                                              const std::string& name) const {
+  typename CostModelContainer::const_iterator it = costs_.find(name);
+  if (it != costs_.end()) {
+    return getWeight(data, it);
+  } else {
+    std::cout << "Warning: we couldn't get the weight of the " << name << " cost item, it doesn't exist." << std::endl;
+    return Scalar(0.);
+  }
+}
+
 template <typename Scalar>
 bool CostModelSumTpl<Scalar>::getCostStatus(const std::string& name) const {
   typename CostModelContainer::const_iterator it = costs_.find(name);
@@ -222,4 +330,14 @@ bool CostModelSumTpl<Scalar>::getCostStatus(const std::string& name) const {
   }
 }
 
+template <typename Scalar>
+Scalar CostModelSumTpl<Scalar>::getWeight(const boost::shared_ptr<CostDataSum>& data,
+                                          const typename CostModelContainer::const_iterator& it) const {
+  if (data->weights.empty()) {
+    return it->second->weight;
+  }
+  typename std::map<std::string, Scalar>::const_iterator it_w = data->weights.find(it->first);
+  return it_w != data->weights.end() ? it_w->second : it->second->weight;
+}
+
 }  // namespace crocoddyl
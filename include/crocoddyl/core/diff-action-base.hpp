@@ -104,6 +104,37 @@ class DifferentialActionModelAbstractTpl {
    */
   virtual boost::shared_ptr<DifferentialActionDataAbstract> createData();
 
+  /**
+   * @brief Clone the differential action model
+   *
+   * The cloned model shares the state and the Pinocchio model, and duplicates its actuation, contact and cost models.
+   *
+   * @return the cloned differential action model
+   */
+  virtual boost::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> > clone() const;
+
+  /**
+   * @brief Copy the node parameters from one data of this model to another one
+   *
+   * By default, the model has no node parameters and nothing is copied (see
+   * `ActionModelAbstractTpl::copyNodeParameters()`).
+   *
+   * @param[in] from  Differential action data that stores the node parameters
+   * @param[in] to    Differential action data that receives the node parameters
+   */
+  virtual void copyNodeParameters(const boost::shared_ptr<DifferentialActionDataAbstract>& from,
+                                  const boost::shared_ptr<DifferentialActionDataAbstract>& to) const;
+
+  /**
+   * @brief Reset the node parameters of a data of this model
+   *
+   * By default, the model has no node parameters and nothing is reset (see
+   * `ActionModelAbstractTpl::resetNodeParameters()`).
+   *
+   * @param[in] data  Differential action data
+   */
+  virtual void resetNodeParameters(const boost::shared_ptr<DifferentialActionDataAbstract>& data) const;
+
   /**
    * @brief Checks that a specific data belongs to this model
    */
@@ -53,8 +53,8 @@ void DifferentialActionModelAbstractTpl<Scalar>::quasiStatic(
     for (std::size_t i = 0; i < maxiter; ++i) {
       calc(data, x, u);
       calcDiff(data, x, u);
-      du.noalias() = -pseudoInverse(data->Fu) * data->xout;
-      u += du;
+      minimumNormSolve(data->Fu, data->xout, du);
+      u -= du;
       if (du.norm() <= tol) {
         break;
       }
@@ -85,6 +85,21 @@ DifferentialActionModelAbstractTpl<Scalar>::createData() {
       Eigen::aligned_allocator<DifferentialActionDataAbstract>(), this);
 }
 
+template <typename Scalar>
+boost::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> > DifferentialActionModelAbstractTpl<Scalar>::clone()
+    const {
+  throw_pretty("It has not been implemented the clone() function");
+}
+
+template <typename Scalar>
+void DifferentialActionModelAbstractTpl<Scalar>::copyNodeParameters(
+    const boost::shared_ptr<DifferentialActionDataAbstract>&,
+    const boost::shared_ptr<DifferentialActionDataAbstract>&) const {}
+
+template <typename Scalar>
+void DifferentialActionModelAbstractTpl<Scalar>::resetNodeParameters(
+    const boost::shared_ptr<DifferentialActionDataAbstract>&) const {}
+
 template <typename Scalar>
 bool DifferentialActionModelAbstractTpl<Scalar>::checkData(const boost::shared_ptr<DifferentialActionDataAbstract>&) {
   return false;
@@ -42,6 +42,9 @@ template <typename Scalar>
 struct DifferentialActionDataLQRTpl;
 
 // integrated action
+template <typename Scalar>
+class IntegratedActionModelAbstractTpl;
+
 template <typename Scalar>
 class IntegratedActionModelEulerTpl;
 template <typename Scalar>
@@ -52,6 +55,11 @@ class IntegratedActionModelRK4Tpl;
 template <typename Scalar>
 struct IntegratedActionDataRK4Tpl;
 
+template <typename Scalar>
+class IntegratedActionModelMultiRateTpl;
+template <typename Scalar>
+struct IntegratedActionDataMultiRateTpl;
+
 // activation
 template <typename Scalar>
 struct ActivationBoundsTpl;
@@ -185,6 +193,12 @@ class ActionModelCodeGenTpl;
 template <typename Scalar>
 struct ActionDataCodeGenTpl;
 
+template <typename Scalar>
+class ActionModelADTpl;
+
+template <typename Scalar>
+struct ActionDataADTpl;
+
 /********************Template Instantiation*************/
 typedef ActionModelAbstractTpl<double> ActionModelAbstract;
 typedef ActionDataAbstractTpl<double> ActionDataAbstract;
@@ -198,10 +212,13 @@ typedef DifferentialActionDataAbstractTpl<double> DifferentialActionDataAbstract
 typedef DifferentialActionModelLQRTpl<double> DifferentialActionModelLQR;
 typedef DifferentialActionDataLQRTpl<double> DifferentialActionDataLQR;
 
+typedef IntegratedActionModelAbstractTpl<double> IntegratedActionModelAbstract;
 typedef IntegratedActionModelEulerTpl<double> IntegratedActionModelEuler;
 typedef IntegratedActionDataEulerTpl<double> IntegratedActionDataEuler;
 typedef IntegratedActionModelRK4Tpl<double> IntegratedActionModelRK4;
 typedef IntegratedActionDataRK4Tpl<double> IntegratedActionDataRK4;
+typedef IntegratedActionModelMultiRateTpl<double> IntegratedActionModelMultiRate;
+typedef IntegratedActionDataMultiRateTpl<double> IntegratedActionDataMultiRate;
 
 typedef ActivationDataQuadraticBarrierTpl<double> ActivationDataQuadraticBarrier;
 typedef ActivationModelQuadraticBarrierTpl<double> ActivationModelQuadraticBarrier;
@@ -262,6 +279,9 @@ typedef ActuationDataNumDiffTpl<double> ActuationDataNumDiff;
 typedef ActionModelCodeGenTpl<double> ActionModelCodeGen;
 typedef ActionDataCodeGenTpl<double> ActionDataCodeGen;
 
+typedef ActionModelADTpl<double> ActionModelAD;
+typedef ActionDataADTpl<double> ActionDataAD;
+
 }  // namespace crocoddyl
 
 #endif  // CROCODDYL_CORE_FWD_HPP_
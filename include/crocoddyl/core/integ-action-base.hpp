@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_INTEG_ACTION_BASE_HPP_
+#define CROCODDYL_CORE_INTEG_ACTION_BASE_HPP_
+
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+
+#include "crocoddyl/core/fwd.hpp"
+#include "crocoddyl/core/action-base.hpp"
+#include "crocoddyl/core/diff-action-base.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Abstract class for integrated action models
+ *
+ * An integrated action model discretizes a differential action model over a node of duration \f$\delta t\f$. This
+ * class holds the differential model and the time step shared by all the integration schemes, so the duration of
+ * each node of a shooting problem can be queried (see `ShootingProblemTpl::get_timeGrid()`) and changed
+ * independently. A time step equals to zero disables the integration, and the node describes only the cost at the
+ * current state.
+ *
+ * The integration scheme is defined in `calc()` and `calcDiff()` of the derived classes, which also implement
+ * `createWithTimeStep()`. The latter builds a new integrated model of the same type over a different time step,
+ * which is used to rebuild a problem on a different time grid.
+ *
+ * \sa `IntegratedActionModelEulerTpl`, `IntegratedActionModelRK4Tpl`, `IntegratedActionModelMultiRateTpl`
+ */
+template <typename _Scalar>
+class IntegratedActionModelAbstractTpl : public ActionModelAbstractTpl<_Scalar> {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef ActionModelAbstractTpl<Scalar> Base;
+  typedef DifferentialActionModelAbstractTpl<Scalar> DifferentialActionModelAbstract;
+  typedef typename MathBase::VectorXs VectorXs;
+
+  /**
+   * @brief Initialize the integrated action model
+   *
+   * @param[in] model               Differential action model
+   * @param[in] time_step           Step time (default 1e-3)
+   * @param[in] with_cost_residual  Compute cost residual (default true)
+   */
+  IntegratedActionModelAbstractTpl(boost::shared_ptr<DifferentialActionModelAbstract> model,
+                                   const Scalar& time_step = Scalar(1e-3), const bool& with_cost_residual = true);
+  virtual ~IntegratedActionModelAbstractTpl();
+
+  /**
+   * @brief Create an integrated model of the same type with a different time step
+   *
+   * The new model shares the differential action model with this one.
+   *
+   * @param[in] dt  Step time of the new model
+   */
+  virtual boost::shared_ptr<IntegratedActionModelAbstractTpl<Scalar> > createWithTimeStep(const Scalar& dt) = 0;
+
+  /**
+   * @brief Return the differential action model
+   */
+  const boost::shared_ptr<DifferentialActionModelAbstract>& get_differential() const;
+
+  /**
+   * @brief Return the time step
+   */
+  const Scalar& get_dt() const;
+
+  /**
+   * @brief Modify the time step
+   *
+   * As in the constructor, a time step equals to zero disables the integration.
+   */
+  virtual void set_dt(const Scalar& dt);
+
+  /**
+   * @brief Modify the differential action model
+   */
+  virtual void set_differential(boost::shared_ptr<DifferentialActionModelAbstract> model);
+
+ protected:
+  using Base::has_control_limits_;  //!< Indicates whether any of the control limits are active
+  using Base::nr_;                  //!< Dimension of the cost residual
+  using Base::nu_;                  //!< Control dimension
+  using Base::state_;               //!< Model of the state
+  using Base::u_lb_;                //!< Lower control limits
+  using Base::u_ub_;                //!< Upper control limits
+  using Base::unone_;               //!< Neutral state
+
+  boost::shared_ptr<DifferentialActionModelAbstract> differential_;  //!< Differential action model
+  Scalar time_step_;                                                 //!< Time step of the node
+  bool with_cost_residual_;                                          //!< Indicates if the cost residual is computed
+  bool enable_integration_;  //!< Indicates if the dynamics are integrated (time step different than zero)
+};
+
+}  // namespace crocoddyl
+
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+#include "crocoddyl/core/integ-action-base.hxx"
+
+#endif  // CROCODDYL_CORE_INTEG_ACTION_BASE_HPP_
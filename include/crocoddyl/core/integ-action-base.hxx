@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+
+#include "crocoddyl/core/utils/exception.hpp"
+#include "crocoddyl/core/integ-action-base.hpp"
+
+namespace crocoddyl {
+
+template <typename Scalar>
+IntegratedActionModelAbstractTpl<Scalar>::IntegratedActionModelAbstractTpl(
+    boost::shared_ptr<DifferentialActionModelAbstract> model, const Scalar& time_step, const bool& with_cost_residual)
+    : Base(model->get_state(), model->get_nu(), model->get_nr()),
+      differential_(model),
+      time_step_(time_step),
+      with_cost_residual_(with_cost_residual),
+      enable_integration_(true) {
+  Base::set_u_lb(differential_->get_u_lb());
+  Base::set_u_ub(differential_->get_u_ub());
+  if (time_step_ < Scalar(0.)) {
+    time_step_ = Scalar(1e-3);
+    std::cerr << "Warning: dt should be positive, set to 1e-3" << std::endl;
+  }
+  if (time_step == Scalar(0.)) {
+    enable_integration_ = false;
+  }
+}
+
+template <typename Scalar>
+IntegratedActionModelAbstractTpl<Scalar>::~IntegratedActionModelAbstractTpl() {}
+
+template <typename Scalar>
+const boost::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> >&
+IntegratedActionModelAbstractTpl<Scalar>::get_differential() const {
+  return differential_;
+}
+
+template <typename Scalar>
+const Scalar& IntegratedActionModelAbstractTpl<Scalar>::get_dt() const {
+  return time_step_;
+}
+
+template <typename Scalar>
+void IntegratedActionModelAbstractTpl<Scalar>::set_dt(const Scalar& dt) {
+  if (dt < 0.) {
+    throw_pretty("Invalid argument: "
+                 << "dt has positive value");
+  }
+  time_step_ = dt;
+  enable_integration_ = (dt != Scalar(0.));
+}
+
+template <typename Scalar>
+void IntegratedActionModelAbstractTpl<Scalar>::set_differential(
+    boost::shared_ptr<DifferentialActionModelAbstract> model) {
+  const std::size_t& nu = model->get_nu();
+  if (nu_ != nu) {
+    nu_ = nu;
+    unone_ = VectorXs::Zero(nu_);
+  }
+  nr_ = model->get_nr();
+  state_ = model->get_state();
+  differential_ = model;
+  Base::set_u_lb(differential_->get_u_lb());
+  Base::set_u_ub(differential_->get_u_ub());
+}
+
+}  // namespace crocoddyl
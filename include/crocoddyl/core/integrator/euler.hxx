@@ -6,8 +6,6 @@
 // All rights reserved.
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <iostream>
-
 #include "crocoddyl/core/utils/exception.hpp"
 #include "crocoddyl/core/integrator/euler.hpp"
 
@@ -16,23 +14,7 @@ namespace crocoddyl {
 template <typename Scalar>
 IntegratedActionModelEulerTpl<Scalar>::IntegratedActionModelEulerTpl(
     boost::shared_ptr<DifferentialActionModelAbstract> model, const Scalar& time_step, const bool& with_cost_residual)
-    : Base(model->get_state(), model->get_nu(), model->get_nr()),
-      differential_(model),
-      time_step_(time_step),
-      time_step2_(time_step * time_step),
-      with_cost_residual_(with_cost_residual),
-      enable_integration_(true) {
-  Base::set_u_lb(differential_->get_u_lb());
-  Base::set_u_ub(differential_->get_u_ub());
-  if (time_step_ < Scalar(0.)) {
-    time_step_ = Scalar(1e-3);
-    time_step2_ = time_step_ * time_step_;
-    std::cerr << "Warning: dt should be positive, set to 1e-3" << std::endl;
-  }
-  if (time_step == Scalar(0.)) {
-    enable_integration_ = false;
-  }
-}
+    : Base(model, time_step, with_cost_residual), time_step2_(time_step_ * time_step_) {}
 
 template <typename Scalar>
 IntegratedActionModelEulerTpl<Scalar>::~IntegratedActionModelEulerTpl() {}
@@ -53,7 +35,7 @@ void IntegratedActionModelEulerTpl<Scalar>::calc(const boost::shared_ptr<ActionD
   const std::size_t& nv = differential_->get_state()->get_nv();
 
   // Static casting the data
-  boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+  Data* d = static_cast<Data*>(data.get());
 
   // Computing the acceleration and cost
   differential_->calc(d->differential, x, u);
@@ -95,7 +77,7 @@ void IntegratedActionModelEulerTpl<Scalar>::calcDiff(const boost::shared_ptr<Act
   const std::size_t& nv = differential_->get_state()->get_nv();
 
   // Static casting the data
-  boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+  Data* d = static_cast<Data*>(data.get());
 
   // Computing the derivatives for the time-continuous model (i.e. differential model)
   differential_->calcDiff(d->differential, x, u);
@@ -135,6 +117,21 @@ boost::shared_ptr<ActionDataAbstractTpl<Scalar> > IntegratedActionModelEulerTpl<
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
 }
 
+template <typename Scalar>
+void IntegratedActionModelEulerTpl<Scalar>::copyNodeParameters(const boost::shared_ptr<ActionDataAbstract>& from,
+                                                               const boost::shared_ptr<ActionDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  differential_->copyNodeParameters(d_from->differential, d_to->differential);
+}
+
+template <typename Scalar>
+void IntegratedActionModelEulerTpl<Scalar>::resetNodeParameters(
+    const boost::shared_ptr<ActionDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  differential_->resetNodeParameters(d->differential);
+}
+
 template <typename Scalar>
 bool IntegratedActionModelEulerTpl<Scalar>::checkData(const boost::shared_ptr<ActionDataAbstract>& data) {
   boost::shared_ptr<Data> d = boost::dynamic_pointer_cast<Data>(data);
@@ -146,41 +143,27 @@ bool IntegratedActionModelEulerTpl<Scalar>::checkData(const boost::shared_ptr<Ac
 }
 
 template <typename Scalar>
-const boost::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> >&
-IntegratedActionModelEulerTpl<Scalar>::get_differential() const {
-  return differential_;
+boost::shared_ptr<ActionModelAbstractTpl<Scalar> > IntegratedActionModelEulerTpl<Scalar>::clone() const {
+  boost::shared_ptr<IntegratedActionModelEulerTpl> model =
+      boost::allocate_shared<IntegratedActionModelEulerTpl>(
+          Eigen::aligned_allocator<IntegratedActionModelEulerTpl>(), *this);
+  model->differential_ = differential_->clone();
+  return model;
 }
 
 template <typename Scalar>
-const Scalar& IntegratedActionModelEulerTpl<Scalar>::get_dt() const {
-  return time_step_;
+boost::shared_ptr<IntegratedActionModelAbstractTpl<Scalar> > IntegratedActionModelEulerTpl<Scalar>::createWithTimeStep(
+    const Scalar& dt) {
+  return boost::allocate_shared<IntegratedActionModelEulerTpl<Scalar> >(
+      Eigen::aligned_allocator<IntegratedActionModelEulerTpl<Scalar> >(), differential_, dt, with_cost_residual_);
 }
 
 template <typename Scalar>
 void IntegratedActionModelEulerTpl<Scalar>::set_dt(const Scalar& dt) {
-  if (dt < 0.) {
-    throw_pretty("Invalid argument: "
-                 << "dt has positive value");
-  }
-  time_step_ = dt;
+  Base::set_dt(dt);
   time_step2_ = dt * dt;
 }
 
-template <typename Scalar>
-void IntegratedActionModelEulerTpl<Scalar>::set_differential(
-    boost::shared_ptr<DifferentialActionModelAbstract> model) {
-  const std::size_t& nu = model->get_nu();
-  if (nu_ != nu) {
-    nu_ = nu;
-    unone_ = VectorXs::Zero(nu_);
-  }
-  nr_ = model->get_nr();
-  state_ = model->get_state();
-  differential_ = model;
-  Base::set_u_lb(differential_->get_u_lb());
-  Base::set_u_ub(differential_->get_u_ub());
-}
-
 template <typename Scalar>
 void IntegratedActionModelEulerTpl<Scalar>::quasiStatic(const boost::shared_ptr<ActionDataAbstract>& data,
                                                         Eigen::Ref<VectorXs> u, const Eigen::Ref<const VectorXs>& x,
@@ -195,7 +178,7 @@ void IntegratedActionModelEulerTpl<Scalar>::quasiStatic(const boost::shared_ptr<
   }
 
   // Static casting the data
-  boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+  Data* d = static_cast<Data*>(data.get());
 
   differential_->quasiStatic(d->differential, u, x, maxiter, tol);
 }
@@ -0,0 +1,167 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_INTEGRATOR_MULTI_RATE_HPP_
+#define CROCODDYL_CORE_INTEGRATOR_MULTI_RATE_HPP_
+
+#include "crocoddyl/core/fwd.hpp"
+#include "crocoddyl/core/integ-action-base.hpp"
+
+namespace crocoddyl {
+
+enum IntegratorType { IntegratorEuler = 0, IntegratorRK4 };
+
+/**
+ * @brief Multi-rate integrator for differential action models
+ *
+ * It holds the control input constant over `nsteps` internal integration substeps of length `dt / nsteps`, which
+ * are computed with an Euler or RK4 scheme. The substeps are chained internally, so the solver sees a single node
+ * whose dynamics and cost are
+ * \f{eqnarray*}
+ *   \mathbf{x}_{k+1} &=& \mathbf{f}_k(\mathbf{x}_k,\mathbf{u}),\quad k=0,\cdots,n-1,\\
+ *   l &=& \sum_{k=0}^{n-1} l_k(\mathbf{x}_k,\mathbf{u}).
+ * \f}
+ * The derivatives are propagated with the chain rule through the Jacobians of each substep, i.e. the products
+ * \f$\mathbf{F_x}^{(k)}\cdots\mathbf{F_x}^{(0)}\f$ of the substep Jacobians \f$\mathbf{F_x}^{(k)}\f$ and
+ * \f$\mathbf{F_u}^{(k)}\f$ computed by the Euler or RK4 substep models. As in the RK4 integrator, the cost Hessians
+ * neglect the curvature of the dynamics (Gauss-Newton approximation).
+ *
+ * \sa `IntegratedActionModelEulerTpl`, `IntegratedActionModelRK4Tpl`
+ */
+template <typename _Scalar>
+class IntegratedActionModelMultiRateTpl : public IntegratedActionModelAbstractTpl<_Scalar> {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef IntegratedActionModelAbstractTpl<Scalar> Base;
+  typedef IntegratedActionDataMultiRateTpl<Scalar> Data;
+  typedef ActionModelAbstractTpl<Scalar> ActionModelAbstract;
+  typedef ActionDataAbstractTpl<Scalar> ActionDataAbstract;
+  typedef DifferentialActionModelAbstractTpl<Scalar> DifferentialActionModelAbstract;
+  typedef IntegratedActionModelEulerTpl<Scalar> IntegratedActionModelEuler;
+  typedef IntegratedActionModelRK4Tpl<Scalar> IntegratedActionModelRK4;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXs MatrixXs;
+
+  /**
+   * @brief Initialize the multi-rate integrator
+   *
+   * @param[in] model               Differential action model
+   * @param[in] time_step           Step time of the node (default 1e-3)
+   * @param[in] nsteps              Number of integration substeps per node (default 1)
+   * @param[in] integrator          Integration scheme used in each substep (default IntegratorEuler)
+   * @param[in] with_cost_residual  Compute cost residual (default true)
+   */
+  IntegratedActionModelMultiRateTpl(boost::shared_ptr<DifferentialActionModelAbstract> model,
+                                    const Scalar& time_step = Scalar(1e-3), const std::size_t& nsteps = 1,
+                                    const IntegratorType& integrator = IntegratorEuler,
+                                    const bool& with_cost_residual = true);
+  virtual ~IntegratedActionModelMultiRateTpl();
+
+  virtual void calc(const boost::shared_ptr<ActionDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                    const Eigen::Ref<const VectorXs>& u);
+  virtual void calcDiff(const boost::shared_ptr<ActionDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                        const Eigen::Ref<const VectorXs>& u);
+  virtual boost::shared_ptr<ActionDataAbstract> createData();
+  virtual void copyNodeParameters(const boost::shared_ptr<ActionDataAbstract>& from,
+                                  const boost::shared_ptr<ActionDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<ActionDataAbstract>& data) const;
+  virtual bool checkData(const boost::shared_ptr<ActionDataAbstract>& data);
+  virtual boost::shared_ptr<ActionModelAbstract> clone() const;
+  virtual boost::shared_ptr<Base> createWithTimeStep(const Scalar& dt);
+
+  virtual void quasiStatic(const boost::shared_ptr<ActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
+                           const Eigen::Ref<const VectorXs>& x, const std::size_t& maxiter = 100,
+                           const Scalar& tol = Scalar(1e-9));
+
+  const boost::shared_ptr<ActionModelAbstract>& get_integrator() const;
+  const IntegratorType& get_integrator_type() const;
+  const std::size_t& get_nsteps() const;
+
+  virtual void set_dt(const Scalar& dt);
+  virtual void set_differential(boost::shared_ptr<DifferentialActionModelAbstract> model);
+
+ protected:
+  using Base::has_control_limits_;  //!< Indicates whether any of the control limits are active
+  using Base::nr_;                  //!< Dimension of the cost residual
+  using Base::nu_;                  //!< Control dimension
+  using Base::state_;               //!< Model of the state
+  using Base::u_lb_;                //!< Lower control limits
+  using Base::u_ub_;                //!< Upper control limits
+  using Base::unone_;               //!< Neutral state
+  using Base::differential_;        //!< Differential action model
+  using Base::time_step_;           //!< Time step of the node
+  using Base::with_cost_residual_;  //!< Indicates if the cost residual is computed
+  using Base::enable_integration_;  //!< Indicates if the dynamics are integrated
+
+ private:
+  void createIntegrator();
+
+  boost::shared_ptr<ActionModelAbstract> integrator_;
+  IntegratorType integrator_type_;
+  std::size_t nsteps_;
+};
+
+template <typename _Scalar>
+struct IntegratedActionDataMultiRateTpl : public ActionDataAbstractTpl<_Scalar> {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef ActionDataAbstractTpl<Scalar> Base;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXs MatrixXs;
+
+  template <template <typename Scalar> class Model>
+  explicit IntegratedActionDataMultiRateTpl(Model<Scalar>* const model) : Base(model) {
+    const std::size_t& nx = model->get_state()->get_nx();
+    const std::size_t& ndx = model->get_state()->get_ndx();
+    const std::size_t& nu = model->get_nu();
+    const std::size_t& nsteps = model->get_nsteps();
+    for (std::size_t i = 0; i < nsteps; ++i) {
+      substeps.push_back(model->get_integrator()->createData());
+    }
+    xs = std::vector<VectorXs>(nsteps + 1, VectorXs::Zero(nx));
+    Fx_partial = MatrixXs::Zero(ndx, ndx);
+    Fu_partial = MatrixXs::Zero(ndx, nu);
+    Lxx_partialx = MatrixXs::Zero(ndx, ndx);
+    Lxx_partialu = MatrixXs::Zero(ndx, nu);
+    Lxu_partialu = MatrixXs::Zero(nu, nu);
+  }
+  virtual ~IntegratedActionDataMultiRateTpl() {}
+
+  std::vector<boost::shared_ptr<ActionDataAbstractTpl<Scalar> > > substeps;  //!< Data of each substep
+  std::vector<VectorXs> xs;  //!< States visited along the substeps (size nsteps + 1)
+  MatrixXs Fx_partial;       //!< Jacobian of the current substep state with respect to the node state
+  MatrixXs Fu_partial;       //!< Jacobian of the current substep state with respect to the node control
+  MatrixXs Lxx_partialx;
+  MatrixXs Lxx_partialu;
+  MatrixXs Lxu_partialu;
+
+  using Base::cost;
+  using Base::Fu;
+  using Base::Fx;
+  using Base::Lu;
+  using Base::Luu;
+  using Base::Lx;
+  using Base::Lxu;
+  using Base::Lxx;
+  using Base::r;
+  using Base::xnext;
+};
+
+}  // namespace crocoddyl
+
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+#include "crocoddyl/core/integrator/multi-rate.hxx"
+
+#endif  // CROCODDYL_CORE_INTEGRATOR_MULTI_RATE_HPP_
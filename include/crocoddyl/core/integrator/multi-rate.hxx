@@ -0,0 +1,257 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/utils/exception.hpp"
+#include "crocoddyl/core/integrator/euler.hpp"
+#include "crocoddyl/core/integrator/rk4.hpp"
+#include "crocoddyl/core/integrator/multi-rate.hpp"
+
+namespace crocoddyl {
+
+template <typename Scalar>
+IntegratedActionModelMultiRateTpl<Scalar>::IntegratedActionModelMultiRateTpl(
+    boost::shared_ptr<DifferentialActionModelAbstract> model, const Scalar& time_step, const std::size_t& nsteps,
+    const IntegratorType& integrator, const bool& with_cost_residual)
+    : Base(model, time_step, with_cost_residual), integrator_type_(integrator), nsteps_(nsteps) {
+  if (nsteps_ == 0) {
+    throw_pretty("Invalid argument: "
+                 << "nsteps should be at least 1");
+  }
+  createIntegrator();
+}
+
+template <typename Scalar>
+IntegratedActionModelMultiRateTpl<Scalar>::~IntegratedActionModelMultiRateTpl() {}
+
+template <typename Scalar>
+void IntegratedActionModelMultiRateTpl<Scalar>::calc(const boost::shared_ptr<ActionDataAbstract>& data,
+                                                     const Eigen::Ref<const VectorXs>& x,
+                                                     const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty("Invalid argument: "
+                 << "x has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty("Invalid argument: "
+                 << "u has wrong dimension (it should be " + std::to_string(nu_) + ")");
+  }
+
+  // Static casting the data
+  Data* d = static_cast<Data*>(data.get());
+
+  // Holding the control input along the substeps
+  const std::size_t nsteps = enable_integration_ ? nsteps_ : 1;
+  d->xs[0] = x;
+  d->cost = Scalar(0.);
+  for (std::size_t i = 0; i < nsteps; ++i) {
+    const boost::shared_ptr<ActionDataAbstract>& di = d->substeps[i];
+    integrator_->calc(di, d->xs[i], u);
+    d->xs[i + 1] = di->xnext;
+    d->cost += di->cost;
+  }
+  d->xnext = d->xs[nsteps];
+
+  // Updating the cost value
+  if (with_cost_residual_) {
+    d->r = d->substeps[0]->r;
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiRateTpl<Scalar>::calcDiff(const boost::shared_ptr<ActionDataAbstract>& data,
+                                                         const Eigen::Ref<const VectorXs>& x,
+                                                         const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty("Invalid argument: "
+                 << "x has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty("Invalid argument: "
+                 << "u has wrong dimension (it should be " + std::to_string(nu_) + ")");
+  }
+
+  // Static casting the data
+  Data* d = static_cast<Data*>(data.get());
+
+  // The first substep starts from the node state, so its derivatives are the initial values of the chain
+  const boost::shared_ptr<ActionDataAbstract>& d0 = d->substeps[0];
+  integrator_->calcDiff(d0, x, u);
+  d->Fx = d0->Fx;
+  d->Fu = d0->Fu;
+  d->Lx = d0->Lx;
+  d->Lu = d0->Lu;
+  d->Lxx = d0->Lxx;
+  d->Lxu = d0->Lxu;
+  d->Luu = d0->Luu;
+
+  // Chaining the derivatives of the remaining substeps, where Fx and Fu hold the Jacobians of the substep state
+  // with respect to the node state and control
+  const std::size_t nsteps = enable_integration_ ? nsteps_ : 1;
+  for (std::size_t i = 1; i < nsteps; ++i) {
+    const boost::shared_ptr<ActionDataAbstract>& di = d->substeps[i];
+    integrator_->calcDiff(di, d->xs[i], u);
+
+    d->Lx.noalias() += d->Fx.transpose() * di->Lx;
+    d->Lu += di->Lu;
+    d->Lu.noalias() += d->Fu.transpose() * di->Lx;
+
+    d->Lxx_partialx.noalias() = di->Lxx * d->Fx;
+    d->Lxx_partialu.noalias() = di->Lxx * d->Fu;
+    d->Lxu_partialu.noalias() = d->Fu.transpose() * di->Lxu;
+    d->Lxx.noalias() += d->Fx.transpose() * d->Lxx_partialx;
+    d->Lxu.noalias() += d->Fx.transpose() * d->Lxx_partialu;
+    d->Lxu.noalias() += d->Fx.transpose() * di->Lxu;
+    d->Luu += di->Luu;
+    d->Luu += d->Lxu_partialu;
+    d->Luu += d->Lxu_partialu.transpose();
+    d->Luu.noalias() += d->Fu.transpose() * d->Lxx_partialu;
+
+    d->Fx_partial.noalias() = di->Fx * d->Fx;
+    d->Fu_partial = di->Fu;
+    d->Fu_partial.noalias() += di->Fx * d->Fu;
+    d->Fx = d->Fx_partial;
+    d->Fu = d->Fu_partial;
+  }
+}
+
+template <typename Scalar>
+boost::shared_ptr<ActionDataAbstractTpl<Scalar> > IntegratedActionModelMultiRateTpl<Scalar>::createData() {
+  return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiRateTpl<Scalar>::copyNodeParameters(
+    const boost::shared_ptr<ActionDataAbstract>& from, const boost::shared_ptr<ActionDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  for (std::size_t i = 0; i < d_to->substeps.size(); ++i) {
+    integrator_->copyNodeParameters(d_from->substeps[i], d_to->substeps[i]);
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiRateTpl<Scalar>::resetNodeParameters(
+    const boost::shared_ptr<ActionDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  for (std::size_t i = 0; i < d->substeps.size(); ++i) {
+    integrator_->resetNodeParameters(d->substeps[i]);
+  }
+}
+
+template <typename Scalar>
+bool IntegratedActionModelMultiRateTpl<Scalar>::checkData(const boost::shared_ptr<ActionDataAbstract>& data) {
+  boost::shared_ptr<Data> d = boost::dynamic_pointer_cast<Data>(data);
+  if (d != NULL) {
+    if (d->substeps.size() != nsteps_) {
+      return false;
+    }
+    for (std::size_t i = 0; i < nsteps_; ++i) {
+      if (!integrator_->checkData(d->substeps[i])) {
+        return false;
+      }
+    }
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <typename Scalar>
+boost::shared_ptr<ActionModelAbstractTpl<Scalar> > IntegratedActionModelMultiRateTpl<Scalar>::clone() const {
+  boost::shared_ptr<IntegratedActionModelMultiRateTpl> model =
+      boost::allocate_shared<IntegratedActionModelMultiRateTpl>(
+          Eigen::aligned_allocator<IntegratedActionModelMultiRateTpl>(), *this);
+  model->differential_ = differential_->clone();
+  model->createIntegrator();
+  return model;
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiRateTpl<Scalar>::quasiStatic(const boost::shared_ptr<ActionDataAbstract>& data,
+                                                            Eigen::Ref<VectorXs> u,
+                                                            const Eigen::Ref<const VectorXs>& x,
+                                                            const std::size_t& maxiter, const Scalar& tol) {
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty("Invalid argument: "
+                 << "u has wrong dimension (it should be " + std::to_string(nu_) + ")");
+  }
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty("Invalid argument: "
+                 << "x has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
+  }
+
+  // Static casting the data
+  Data* d = static_cast<Data*>(data.get());
+
+  // The quasi-static commands keep the system at rest, so they hold for every substep
+  integrator_->quasiStatic(d->substeps[0], u, x, maxiter, tol);
+}
+
+template <typename Scalar>
+boost::shared_ptr<IntegratedActionModelAbstractTpl<Scalar> >
+IntegratedActionModelMultiRateTpl<Scalar>::createWithTimeStep(const Scalar& dt) {
+  return boost::allocate_shared<IntegratedActionModelMultiRateTpl<Scalar> >(
+      Eigen::aligned_allocator<IntegratedActionModelMultiRateTpl<Scalar> >(), differential_, dt, nsteps_,
+      integrator_type_, with_cost_residual_);
+}
+
+template <typename Scalar>
+const boost::shared_ptr<ActionModelAbstractTpl<Scalar> >& IntegratedActionModelMultiRateTpl<Scalar>::get_integrator()
+    const {
+  return integrator_;
+}
+
+template <typename Scalar>
+const IntegratorType& IntegratedActionModelMultiRateTpl<Scalar>::get_integrator_type() const {
+  return integrator_type_;
+}
+
+template <typename Scalar>
+const std::size_t& IntegratedActionModelMultiRateTpl<Scalar>::get_nsteps() const {
+  return nsteps_;
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiRateTpl<Scalar>::set_dt(const Scalar& dt) {
+  Base::set_dt(dt);
+  const Scalar substep = dt / static_cast<Scalar>(nsteps_);
+  switch (integrator_type_) {
+    case IntegratorEuler:
+      boost::static_pointer_cast<IntegratedActionModelEuler>(integrator_)->set_dt(substep);
+      break;
+    case IntegratorRK4:
+      boost::static_pointer_cast<IntegratedActionModelRK4>(integrator_)->set_dt(substep);
+      break;
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiRateTpl<Scalar>::set_differential(
+    boost::shared_ptr<DifferentialActionModelAbstract> model) {
+  Base::set_differential(model);
+  createIntegrator();
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiRateTpl<Scalar>::createIntegrator() {
+  const Scalar substep = time_step_ / static_cast<Scalar>(nsteps_);
+  switch (integrator_type_) {
+    case IntegratorEuler:
+      integrator_ = boost::make_shared<IntegratedActionModelEuler>(differential_, substep, with_cost_residual_);
+      break;
+    case IntegratorRK4:
+      integrator_ = boost::make_shared<IntegratedActionModelRK4>(differential_, substep, with_cost_residual_);
+      break;
+    default:
+      throw_pretty("Invalid argument: "
+                   << "unknown integrator type");
+      break;
+  }
+}
+
+}  // namespace crocoddyl
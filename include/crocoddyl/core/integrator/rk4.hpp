@@ -10,19 +10,19 @@
 #define CROCODDYL_CORE_INTEGRATOR_RK4_HPP_
 
 #include "crocoddyl/core/fwd.hpp"
-#include "crocoddyl/core/action-base.hpp"
-#include "crocoddyl/core/diff-action-base.hpp"
+#include "crocoddyl/core/integ-action-base.hpp"
 
 namespace crocoddyl {
 
 template <typename _Scalar>
-class IntegratedActionModelRK4Tpl : public ActionModelAbstractTpl<_Scalar> {
+class IntegratedActionModelRK4Tpl : public IntegratedActionModelAbstractTpl<_Scalar> {
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
   typedef _Scalar Scalar;
   typedef MathBaseTpl<Scalar> MathBase;
-  typedef ActionModelAbstractTpl<Scalar> Base;
+  typedef IntegratedActionModelAbstractTpl<Scalar> Base;
+  typedef ActionModelAbstractTpl<Scalar> ActionModelAbstract;
   typedef IntegratedActionDataRK4Tpl<Scalar> Data;
   typedef ActionDataAbstractTpl<Scalar> ActionDataAbstract;
   typedef DifferentialActionModelAbstractTpl<Scalar> DifferentialActionModelAbstract;
@@ -38,18 +38,17 @@ class IntegratedActionModelRK4Tpl : public ActionModelAbstractTpl<_Scalar> {
   virtual void calcDiff(const boost::shared_ptr<ActionDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
                         const Eigen::Ref<const VectorXs>& u);
   virtual boost::shared_ptr<ActionDataAbstract> createData();
+  virtual void copyNodeParameters(const boost::shared_ptr<ActionDataAbstract>& from,
+                                  const boost::shared_ptr<ActionDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<ActionDataAbstract>& data) const;
   virtual bool checkData(const boost::shared_ptr<ActionDataAbstract>& data);
+  virtual boost::shared_ptr<ActionModelAbstract> clone() const;
+  virtual boost::shared_ptr<Base> createWithTimeStep(const Scalar& dt);
 
   virtual void quasiStatic(const boost::shared_ptr<ActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
                            const Eigen::Ref<const VectorXs>& x, const std::size_t& maxiter = 100,
                            const Scalar& tol = Scalar(1e-9));
 
-  const boost::shared_ptr<DifferentialActionModelAbstract>& get_differential() const;
-  const Scalar& get_dt() const;
-
-  void set_dt(const Scalar& dt);
-  void set_differential(boost::shared_ptr<DifferentialActionModelAbstract> model);
-
  protected:
   using Base::has_control_limits_;  //!< Indicates whether any of the control limits are active
   using Base::nr_;                  //!< Dimension of the cost residual
@@ -58,13 +57,13 @@ class IntegratedActionModelRK4Tpl : public ActionModelAbstractTpl<_Scalar> {
   using Base::u_lb_;                //!< Lower control limits
   using Base::u_ub_;                //!< Upper control limits
   using Base::unone_;               //!< Neutral state
+  using Base::differential_;        //!< Differential action model
+  using Base::time_step_;           //!< Time step of the node
+  using Base::with_cost_residual_;  //!< Indicates if the cost residual is computed
+  using Base::enable_integration_;  //!< Indicates if the dynamics are integrated
 
  private:
-  boost::shared_ptr<DifferentialActionModelAbstract> differential_;
-  Scalar time_step_;
   std::vector<Scalar> rk4_c_;
-  bool with_cost_residual_;
-  bool enable_integration_;
 };
 
 template <typename _Scalar>
@@ -6,8 +6,6 @@
 // All rights reserved.
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <iostream>
-
 #include "crocoddyl/core/utils/exception.hpp"
 #include "crocoddyl/core/integrator/rk4.hpp"
 
@@ -16,20 +14,7 @@ namespace crocoddyl {
 template <typename Scalar>
 IntegratedActionModelRK4Tpl<Scalar>::IntegratedActionModelRK4Tpl(
     boost::shared_ptr<DifferentialActionModelAbstract> model, const Scalar& time_step, const bool& with_cost_residual)
-    : Base(model->get_state(), model->get_nu(), model->get_nr()),
-      differential_(model),
-      time_step_(time_step),
-      with_cost_residual_(with_cost_residual),
-      enable_integration_(true) {
-  Base::set_u_lb(differential_->get_u_lb());
-  Base::set_u_ub(differential_->get_u_ub());
-  if (time_step_ < Scalar(0.)) {
-    time_step_ = Scalar(1e-3);
-    std::cerr << "Warning: dt should be positive, set to 1e-3" << std::endl;
-  }
-  if (time_step == Scalar(0.)) {
-    enable_integration_ = false;
-  }
+    : Base(model, time_step, with_cost_residual) {
   rk4_c_.push_back(Scalar(0.));
   rk4_c_.push_back(Scalar(0.5));
   rk4_c_.push_back(Scalar(0.5));
@@ -54,7 +39,7 @@ void IntegratedActionModelRK4Tpl<Scalar>::calc(const boost::shared_ptr<ActionDat
   const std::size_t& nv = differential_->get_state()->get_nv();
 
   // Static casting the data
-  boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+  Data* d = static_cast<Data*>(data.get());
 
   // Computing the acceleration and cost
   differential_->calc(d->differential[0], x, u);
@@ -104,7 +89,7 @@ void IntegratedActionModelRK4Tpl<Scalar>::calcDiff(const boost::shared_ptr<Actio
 
   const std::size_t& nv = differential_->get_state()->get_nv();
 
-  boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+  Data* d = static_cast<Data*>(data.get());
 
   differential_->calcDiff(d->differential[0], x, u);
 
@@ -187,6 +172,24 @@ boost::shared_ptr<ActionDataAbstractTpl<Scalar> > IntegratedActionModelRK4Tpl<Sc
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
 }
 
+template <typename Scalar>
+void IntegratedActionModelRK4Tpl<Scalar>::copyNodeParameters(const boost::shared_ptr<ActionDataAbstract>& from,
+                                                             const boost::shared_ptr<ActionDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  for (std::size_t i = 0; i < d_to->differential.size(); ++i) {
+    differential_->copyNodeParameters(d_from->differential[i], d_to->differential[i]);
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelRK4Tpl<Scalar>::resetNodeParameters(const boost::shared_ptr<ActionDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  for (std::size_t i = 0; i < d->differential.size(); ++i) {
+    differential_->resetNodeParameters(d->differential[i]);
+  }
+}
+
 template <typename Scalar>
 bool IntegratedActionModelRK4Tpl<Scalar>::checkData(const boost::shared_ptr<ActionDataAbstract>& data) {
   boost::shared_ptr<Data> d = boost::dynamic_pointer_cast<Data>(data);
@@ -199,37 +202,19 @@ bool IntegratedActionModelRK4Tpl<Scalar>::checkData(const boost::shared_ptr<Acti
 }
 
 template <typename Scalar>
-const boost::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> >&
-IntegratedActionModelRK4Tpl<Scalar>::get_differential() const {
-  return differential_;
-}
-
-template <typename Scalar>
-const Scalar& IntegratedActionModelRK4Tpl<Scalar>::get_dt() const {
-  return time_step_;
-}
-
-template <typename Scalar>
-void IntegratedActionModelRK4Tpl<Scalar>::set_dt(const Scalar& dt) {
-  if (dt < 0.) {
-    throw_pretty("Invalid argument: "
-                 << "dt has positive value");
-  }
-  time_step_ = dt;
+boost::shared_ptr<ActionModelAbstractTpl<Scalar> > IntegratedActionModelRK4Tpl<Scalar>::clone() const {
+  boost::shared_ptr<IntegratedActionModelRK4Tpl> model =
+      boost::allocate_shared<IntegratedActionModelRK4Tpl>(
+          Eigen::aligned_allocator<IntegratedActionModelRK4Tpl>(), *this);
+  model->differential_ = differential_->clone();
+  return model;
 }
 
 template <typename Scalar>
-void IntegratedActionModelRK4Tpl<Scalar>::set_differential(boost::shared_ptr<DifferentialActionModelAbstract> model) {
-  const std::size_t& nu = model->get_nu();
-  if (nu_ != nu) {
-    nu_ = nu;
-    unone_ = VectorXs::Zero(nu_);
-  }
-  nr_ = model->get_nr();
-  state_ = model->get_state();
-  differential_ = model;
-  Base::set_u_lb(differential_->get_u_lb());
-  Base::set_u_ub(differential_->get_u_ub());
+boost::shared_ptr<IntegratedActionModelAbstractTpl<Scalar> > IntegratedActionModelRK4Tpl<Scalar>::createWithTimeStep(
+    const Scalar& dt) {
+  return boost::allocate_shared<IntegratedActionModelRK4Tpl<Scalar> >(
+      Eigen::aligned_allocator<IntegratedActionModelRK4Tpl<Scalar> >(), differential_, dt, with_cost_residual_);
 }
 
 template <typename Scalar>
@@ -246,7 +231,7 @@ void IntegratedActionModelRK4Tpl<Scalar>::quasiStatic(const boost::shared_ptr<Ac
   }
 
   // Static casting the data
-  boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+  Data* d = static_cast<Data*>(data.get());
 
   differential_->quasiStatic(d->differential[0], u, x, maxiter, tol);
 }
@@ -91,6 +91,14 @@ class ActionModelNumDiffTpl : public ActionModelAbstractTpl<_Scalar> {
    * @return boost::shared_ptr<ActionDataAbstract>
    */
   virtual boost::shared_ptr<ActionDataAbstract> createData();
+  virtual void copyNodeParameters(const boost::shared_ptr<ActionDataAbstract>& from,
+                                  const boost::shared_ptr<ActionDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<ActionDataAbstract>& data) const;
+
+  /**
+   * @brief Clone the numdiff model, which wraps a clone of the original model
+   */
+  virtual boost::shared_ptr<Base> clone() const;
 
   /**
    * @brief Get the model_ object
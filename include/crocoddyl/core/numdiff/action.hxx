@@ -33,7 +33,7 @@ void ActionModelNumDiffTpl<Scalar>::calc(const boost::shared_ptr<ActionDataAbstr
     throw_pretty("Invalid argument: "
                  << "u has wrong dimension (it should be " + std::to_string(nu_) + ")");
   }
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
   model_->calc(data_nd->data_0, x, u);
   data->cost = data_nd->data_0->cost;
   data->xnext = data_nd->data_0->xnext;
@@ -51,7 +51,7 @@ void ActionModelNumDiffTpl<Scalar>::calcDiff(const boost::shared_ptr<ActionDataA
     throw_pretty("Invalid argument: "
                  << "u has wrong dimension (it should be " + std::to_string(nu_) + ")");
   }
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
 
   const VectorXs& xn0 = data_nd->data_0->xnext;
   const Scalar& c0 = data_nd->data_0->cost;
@@ -113,6 +113,40 @@ boost::shared_ptr<ActionDataAbstractTpl<Scalar> > ActionModelNumDiffTpl<Scalar>:
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ActionModelAbstractTpl<Scalar> > ActionModelNumDiffTpl<Scalar>::clone() const {
+  boost::shared_ptr<ActionModelNumDiffTpl> model =
+      boost::allocate_shared<ActionModelNumDiffTpl>(Eigen::aligned_allocator<ActionModelNumDiffTpl>(), *this);
+  model->model_ = model_->clone();
+  return model;
+}
+
+template <typename Scalar>
+void ActionModelNumDiffTpl<Scalar>::copyNodeParameters(const boost::shared_ptr<ActionDataAbstract>& from,
+                                                       const boost::shared_ptr<ActionDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  model_->copyNodeParameters(d_from->data_0, d_to->data_0);
+  for (std::size_t i = 0; i < d_to->data_x.size(); ++i) {
+    model_->copyNodeParameters(d_from->data_0, d_to->data_x[i]);
+  }
+  for (std::size_t i = 0; i < d_to->data_u.size(); ++i) {
+    model_->copyNodeParameters(d_from->data_0, d_to->data_u[i]);
+  }
+}
+
+template <typename Scalar>
+void ActionModelNumDiffTpl<Scalar>::resetNodeParameters(const boost::shared_ptr<ActionDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  model_->resetNodeParameters(d->data_0);
+  for (std::size_t i = 0; i < d->data_x.size(); ++i) {
+    model_->resetNodeParameters(d->data_x[i]);
+  }
+  for (std::size_t i = 0; i < d->data_u.size(); ++i) {
+    model_->resetNodeParameters(d->data_u[i]);
+  }
+}
+
 template <typename Scalar>
 const boost::shared_ptr<ActionModelAbstractTpl<Scalar> >& ActionModelNumDiffTpl<Scalar>::get_model() const {
   return model_;
@@ -60,6 +60,11 @@ class ActivationModelNumDiffTpl : public ActivationModelAbstractTpl<_Scalar> {
    */
   virtual boost::shared_ptr<ActivationDataAbstract> createData();
 
+  /**
+   * @brief Clone the numdiff model, which wraps a clone of the original model
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
   /**
    * @brief Get the model_ object
    *
@@ -27,7 +27,7 @@ void ActivationModelNumDiffTpl<Scalar>::calc(const boost::shared_ptr<ActivationD
     throw_pretty("Invalid argument: "
                  << "r has wrong dimension (it should be " + std::to_string(model_->get_nr()) + ")");
   }
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
   model_->calc(data_nd->data_0, r);
   data->a_value = data_nd->data_0->a_value;
 }
@@ -39,7 +39,7 @@ void ActivationModelNumDiffTpl<Scalar>::calcDiff(const boost::shared_ptr<Activat
     throw_pretty("Invalid argument: "
                  << "r has wrong dimension (it should be " + std::to_string(model_->get_nr()) + ")");
   }
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
 
   const Scalar& a_value0 = data_nd->data_0->a_value;
   data->a_value = data_nd->data_0->a_value;
@@ -64,6 +64,14 @@ boost::shared_ptr<ActivationDataAbstractTpl<Scalar> > ActivationModelNumDiffTpl<
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ActivationModelAbstractTpl<Scalar> > ActivationModelNumDiffTpl<Scalar>::clone() const {
+  boost::shared_ptr<ActivationModelNumDiffTpl> model =
+      boost::allocate_shared<ActivationModelNumDiffTpl>(Eigen::aligned_allocator<ActivationModelNumDiffTpl>(), *this);
+  model->model_ = model_->clone();
+  return model;
+}
+
 template <typename Scalar>
 const boost::shared_ptr<ActivationModelAbstractTpl<Scalar> >& ActivationModelNumDiffTpl<Scalar>::get_model() const {
   return model_;
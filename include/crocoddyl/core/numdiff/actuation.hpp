@@ -59,6 +59,11 @@ class ActuationModelNumDiffTpl : public ActuationModelAbstractTpl<_Scalar> {
    */
   virtual boost::shared_ptr<ActuationDataAbstract> createData();
 
+  /**
+   * @brief Clone the numdiff model, which wraps a clone of the original model
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
   /**
    * @brief Get the model_ object
    *
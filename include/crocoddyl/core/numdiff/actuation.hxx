@@ -31,7 +31,7 @@ void ActuationModelNumDiffTpl<Scalar>::calc(const boost::shared_ptr<ActuationDat
     throw_pretty("Invalid argument: "
                  << "u has wrong dimension (it should be " + std::to_string(nu_) + ")");
   }
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
   model_->calc(data_nd->data_0, x, u);
   data->tau = data_nd->data_0->tau;
 }
@@ -48,7 +48,7 @@ void ActuationModelNumDiffTpl<Scalar>::calcDiff(const boost::shared_ptr<Actuatio
     throw_pretty("Invalid argument: "
                  << "u has wrong dimension (it should be " + std::to_string(nu_) + ")");
   }
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
 
   const VectorXs& tau0 = data_nd->data_0->tau;
 
@@ -77,6 +77,14 @@ boost::shared_ptr<ActuationDataAbstractTpl<Scalar> > ActuationModelNumDiffTpl<Sc
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ActuationModelAbstractTpl<Scalar> > ActuationModelNumDiffTpl<Scalar>::clone() const {
+  boost::shared_ptr<ActuationModelNumDiffTpl> model =
+      boost::allocate_shared<ActuationModelNumDiffTpl>(Eigen::aligned_allocator<ActuationModelNumDiffTpl>(), *this);
+  model->model_ = model_->clone();
+  return model;
+}
+
 template <typename Scalar>
 const boost::shared_ptr<ActuationModelAbstractTpl<Scalar> >& ActuationModelNumDiffTpl<Scalar>::get_model() const {
   return model_;
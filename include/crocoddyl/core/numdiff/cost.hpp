@@ -62,6 +62,14 @@ class CostModelNumDiffTpl : public CostModelAbstractTpl<_Scalar> {
    * @return the cost data
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
+  virtual void copyNodeParameters(const boost::shared_ptr<CostDataAbstract>& from,
+                                  const boost::shared_ptr<CostDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<CostDataAbstract>& data) const;
+
+  /**
+   * @brief Clone the numdiff cost model, which wraps a clone of the original model
+   */
+  virtual boost::shared_ptr<Base> clone() const;
 
   /**
    * @brief Return the original cost model
@@ -23,7 +23,7 @@ CostModelNumDiffTpl<Scalar>::~CostModelNumDiffTpl() {}
 template <typename Scalar>
 void CostModelNumDiffTpl<Scalar>::calc(const boost::shared_ptr<CostDataAbstract>& data,
                                        const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
   data_nd->data_0->cost = 0.0;
   model_->calc(data_nd->data_0, x, u);
   data_nd->cost = data_nd->data_0->cost;
@@ -33,7 +33,7 @@ void CostModelNumDiffTpl<Scalar>::calc(const boost::shared_ptr<CostDataAbstract>
 template <typename Scalar>
 void CostModelNumDiffTpl<Scalar>::calcDiff(const boost::shared_ptr<CostDataAbstract>& data,
                                            const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
 
   const Scalar& c0 = data_nd->cost;
   const VectorXs& r0 = data_nd->r;
@@ -103,6 +103,41 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelNumDiffTpl<Scalar>::cre
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelNumDiffTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelNumDiffTpl> model =
+      boost::allocate_shared<CostModelNumDiffTpl>(Eigen::aligned_allocator<CostModelNumDiffTpl>(), *this);
+  model->model_ = model_->clone();
+  model->activation_ = model->model_->get_activation();
+  return model;
+}
+
+template <typename Scalar>
+void CostModelNumDiffTpl<Scalar>::copyNodeParameters(const boost::shared_ptr<CostDataAbstract>& from,
+                                                     const boost::shared_ptr<CostDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  model_->copyNodeParameters(d_from->data_0, d_to->data_0);
+  for (std::size_t i = 0; i < d_to->data_x.size(); ++i) {
+    model_->copyNodeParameters(d_from->data_0, d_to->data_x[i]);
+  }
+  for (std::size_t i = 0; i < d_to->data_u.size(); ++i) {
+    model_->copyNodeParameters(d_from->data_0, d_to->data_u[i]);
+  }
+}
+
+template <typename Scalar>
+void CostModelNumDiffTpl<Scalar>::resetNodeParameters(const boost::shared_ptr<CostDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  model_->resetNodeParameters(d->data_0);
+  for (std::size_t i = 0; i < d->data_x.size(); ++i) {
+    model_->resetNodeParameters(d->data_x[i]);
+  }
+  for (std::size_t i = 0; i < d->data_u.size(); ++i) {
+    model_->resetNodeParameters(d->data_u[i]);
+  }
+}
+
 template <typename Scalar>
 const boost::shared_ptr<CostModelAbstractTpl<Scalar> >& CostModelNumDiffTpl<Scalar>::get_model() const {
   return model_;
@@ -38,6 +38,10 @@ class DifferentialActionModelNumDiffTpl : public DifferentialActionModelAbstract
   virtual void calcDiff(const boost::shared_ptr<DifferentialActionDataAbstract>& data,
                         const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u);
   virtual boost::shared_ptr<DifferentialActionDataAbstract> createData();
+  virtual void copyNodeParameters(const boost::shared_ptr<DifferentialActionDataAbstract>& from,
+                                  const boost::shared_ptr<DifferentialActionDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<DifferentialActionDataAbstract>& data) const;
+  virtual boost::shared_ptr<Base> clone() const;
 
   const boost::shared_ptr<Base>& get_model() const;
   const Scalar& get_disturbance() const;
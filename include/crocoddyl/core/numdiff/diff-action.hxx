@@ -54,7 +54,7 @@ void DifferentialActionModelNumDiffTpl<Scalar>::calcDiff(const boost::shared_ptr
     throw_pretty("Invalid argument: "
                  << "u has wrong dimension (it should be " + std::to_string(nu_) + ")");
   }
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
 
   const VectorXs& xn0 = data_nd->data_0->xout;
   const Scalar& c0 = data_nd->data_0->cost;
@@ -106,6 +106,44 @@ boost::shared_ptr<DifferentialActionDataAbstractTpl<Scalar> > DifferentialAction
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
 }
 
+template <typename Scalar>
+boost::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> > DifferentialActionModelNumDiffTpl<Scalar>::clone()
+    const {
+  boost::shared_ptr<DifferentialActionModelNumDiffTpl> model =
+      boost::allocate_shared<DifferentialActionModelNumDiffTpl>(
+          Eigen::aligned_allocator<DifferentialActionModelNumDiffTpl>(), *this);
+  model->model_ = model_->clone();
+  return model;
+}
+
+template <typename Scalar>
+void DifferentialActionModelNumDiffTpl<Scalar>::copyNodeParameters(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& from,
+    const boost::shared_ptr<DifferentialActionDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  model_->copyNodeParameters(d_from->data_0, d_to->data_0);
+  for (std::size_t i = 0; i < d_to->data_x.size(); ++i) {
+    model_->copyNodeParameters(d_from->data_0, d_to->data_x[i]);
+  }
+  for (std::size_t i = 0; i < d_to->data_u.size(); ++i) {
+    model_->copyNodeParameters(d_from->data_0, d_to->data_u[i]);
+  }
+}
+
+template <typename Scalar>
+void DifferentialActionModelNumDiffTpl<Scalar>::resetNodeParameters(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  model_->resetNodeParameters(d->data_0);
+  for (std::size_t i = 0; i < d->data_x.size(); ++i) {
+    model_->resetNodeParameters(d->data_x[i]);
+  }
+  for (std::size_t i = 0; i < d->data_u.size(); ++i) {
+    model_->resetNodeParameters(d->data_u[i]);
+  }
+}
+
 template <typename Scalar>
 const boost::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> >&
 DifferentialActionModelNumDiffTpl<Scalar>::get_model() const {
@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_OPTCTRL_HORIZON_HPP_
+#define CROCODDYL_CORE_OPTCTRL_HORIZON_HPP_
+
+#include <vector>
+#include "crocoddyl/core/fwd.hpp"
+#include "crocoddyl/core/optctrl/shooting.hpp"
+#include "crocoddyl/core/integ-action-base.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Compute a geometrically growing sequence of time steps
+ *
+ * It returns \f$\delta t_k = \delta t_0\,r^k\f$ for \f$k=0,\cdots,N-1\f$. With \f$r>1\f$, the first nodes keep the
+ * resolution of \f$\delta t_0\f$ while the last ones cover a longer lookahead at the same number of nodes.
+ *
+ * @param[in] dt0    Time step of the first node
+ * @param[in] ratio  Growth ratio between consecutive time steps
+ * @param[in] N      Number of time steps
+ * @return the sequence of time steps
+ */
+template <typename Scalar>
+typename MathBaseTpl<Scalar>::VectorXs computeGeometricTimeSteps(const Scalar& dt0, const Scalar& ratio,
+                                                                 const std::size_t& N);
+
+/**
+ * @brief Rebuild a shooting problem on a different time grid
+ *
+ * The new problem has one running node per element of `dts`. Each node is created through
+ * `IntegratedActionModelAbstractTpl::createWithTimeStep()` from the source integrated node that covers its starting
+ * time, so it shares the differential action model (and therefore costs and contacts) of that node. Beyond the
+ * source horizon, the last integrated node is held. Non-integrated nodes of zero duration (e.g. impulse or transition
+ * models) are events, and they are inserted once the new grid reaches their time.
+ *
+ * The warm start is carried across by interpolating the source trajectory onto the new grid, i.e.
+ * \f$\mathbf{x}(\tau) = \mathbf{x}_k\oplus\alpha(\mathbf{x}_{k+1}\ominus\mathbf{x}_k)\f$ with
+ * \f$\alpha=(\tau-t_k)/\delta t_k\f$, while the control is held constant over each source node.
+ *
+ * @param[in]  problem  Source shooting problem
+ * @param[in]  dts      Time step of each new running node
+ * @param[in]  xs       Source state trajectory (size \f$T+1\f$)
+ * @param[in]  us       Source control sequence (size \f$T\f$)
+ * @param[out] xs_out   Interpolated state trajectory of the new problem
+ * @param[out] us_out   Interpolated control sequence of the new problem
+ * @return the shooting problem defined on the new time grid
+ */
+template <typename Scalar>
+boost::shared_ptr<ShootingProblemTpl<Scalar> > compressHorizon(
+    const ShootingProblemTpl<Scalar>& problem, const typename MathBaseTpl<Scalar>::VectorXs& dts,
+    const std::vector<typename MathBaseTpl<Scalar>::VectorXs>& xs,
+    const std::vector<typename MathBaseTpl<Scalar>::VectorXs>& us,
+    std::vector<typename MathBaseTpl<Scalar>::VectorXs>& xs_out,
+    std::vector<typename MathBaseTpl<Scalar>::VectorXs>& us_out);
+
+}  // namespace crocoddyl
+
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+#include "crocoddyl/core/optctrl/horizon.hxx"
+
+#endif  // CROCODDYL_CORE_OPTCTRL_HORIZON_HPP_
@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include "crocoddyl/core/utils/exception.hpp"
+#include "crocoddyl/core/optctrl/horizon.hpp"
+
+namespace crocoddyl {
+
+template <typename Scalar>
+typename MathBaseTpl<Scalar>::VectorXs computeGeometricTimeSteps(const Scalar& dt0, const Scalar& ratio,
+                                                                 const std::size_t& N) {
+  if (dt0 <= Scalar(0.)) {
+    throw_pretty("Invalid argument: "
+                 << "dt0 should be positive");
+  }
+  if (ratio <= Scalar(0.)) {
+    throw_pretty("Invalid argument: "
+                 << "ratio should be positive");
+  }
+  typename MathBaseTpl<Scalar>::VectorXs dts(N);
+  Scalar dt = dt0;
+  for (std::size_t k = 0; k < N; ++k) {
+    dts[k] = dt;
+    dt *= ratio;
+  }
+  return dts;
+}
+
+template <typename Scalar>
+boost::shared_ptr<ShootingProblemTpl<Scalar> > compressHorizon(
+    const ShootingProblemTpl<Scalar>& problem, const typename MathBaseTpl<Scalar>::VectorXs& dts,
+    const std::vector<typename MathBaseTpl<Scalar>::VectorXs>& xs,
+    const std::vector<typename MathBaseTpl<Scalar>::VectorXs>& us,
+    std::vector<typename MathBaseTpl<Scalar>::VectorXs>& xs_out,
+    std::vector<typename MathBaseTpl<Scalar>::VectorXs>& us_out) {
+  typedef typename MathBaseTpl<Scalar>::VectorXs VectorXs;
+  typedef ActionModelAbstractTpl<Scalar> ActionModelAbstract;
+  typedef IntegratedActionModelAbstractTpl<Scalar> IntegratedActionModelAbstract;
+
+  const std::size_t& T = problem.get_T();
+  const std::size_t N = static_cast<std::size_t>(dts.size());
+  const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem.get_runningModels();
+  if (xs.size() != T + 1) {
+    throw_pretty("Invalid argument: "
+                 << "xs has wrong dimension (it should be " + std::to_string(T + 1) + ")");
+  }
+  if (us.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "us has wrong dimension (it should be " + std::to_string(T) + ")");
+  }
+  for (std::size_t j = 0; j < N; ++j) {
+    if (dts[j] <= Scalar(0.)) {
+      throw_pretty("Invalid argument: "
+                   << "dts should be positive");
+    }
+  }
+
+  // Classifying the source nodes into integrated ones and zero-duration events
+  const VectorXs time_grid = problem.get_timeGrid();
+  std::vector<boost::shared_ptr<IntegratedActionModelAbstract> > integrated(T);
+  std::vector<bool> is_event(T);
+  for (std::size_t i = 0; i < T; ++i) {
+    integrated[i] = boost::dynamic_pointer_cast<IntegratedActionModelAbstract>(models[i]);
+    is_event[i] = time_grid[i + 1] == time_grid[i];
+    if (integrated[i] == NULL && !is_event[i]) {
+      throw_pretty("Invalid argument: "
+                   << "running node " + std::to_string(i) + " is neither integrated nor of zero duration");
+    }
+  }
+
+  std::vector<boost::shared_ptr<ActionModelAbstract> > running_models;
+  running_models.reserve(N);
+  xs_out.clear();
+  us_out.clear();
+
+  std::size_t k = 0;                  // cursor on the source nodes
+  std::size_t m = T;                  // source integrated node that covers the current time
+  bool has_event_after_node = false;  // indicates if an event was inserted after the last new integrated node
+  Scalar tau = Scalar(0.);
+  for (std::size_t j = 0; j <= N; ++j) {
+    // Passing the source nodes that finish before the current time and inserting the events
+    while (k < T) {
+      if (is_event[k] && time_grid[k] <= tau) {
+        running_models.push_back(models[k]);
+        xs_out.push_back(xs[k]);
+        us_out.push_back(us[k].head(models[k]->get_nu()));
+        has_event_after_node = true;
+        ++k;
+      } else if (!is_event[k] && time_grid[k + 1] <= tau) {
+        m = k;
+        ++k;
+      } else {
+        break;
+      }
+    }
+    if (k < T && !is_event[k]) {
+      m = k;
+    }
+    if (m == T || (j == N && has_event_after_node)) {
+      if (j < N) {
+        throw_pretty("Invalid argument: "
+                     << "the problem has no node of positive duration");
+      }
+      // The terminal state is the state after the last event
+      xs_out.push_back(xs[k]);
+      break;
+    }
+
+    // Interpolating the warm start from the source node that covers the current time
+    const boost::shared_ptr<StateAbstractTpl<Scalar> >& state = models[m]->get_state();
+    const Scalar alpha = std::min(std::max((tau - time_grid[m]) / integrated[m]->get_dt(), Scalar(0.)), Scalar(1.));
+    VectorXs dx = VectorXs::Zero(state->get_ndx());
+    VectorXs x = VectorXs::Zero(state->get_nx());
+    state->diff(xs[m], xs[m + 1], dx);
+    state->integrate(xs[m], alpha * dx, x);
+    xs_out.push_back(x);
+    if (j == N) {
+      break;
+    }
+    running_models.push_back(integrated[m]->createWithTimeStep(dts[j]));
+    us_out.push_back(us[m].head(models[m]->get_nu()));
+    has_event_after_node = false;
+    tau += dts[j];
+  }
+  return boost::allocate_shared<ShootingProblemTpl<Scalar> >(Eigen::aligned_allocator<ShootingProblemTpl<Scalar> >(),
+                                                             problem.get_x0(), running_models,
+                                                             problem.get_terminalModel());
+}
+
+}  // namespace crocoddyl
@@ -11,9 +11,12 @@
 
 #include <stdexcept>
 #include <vector>
+#include <map>
+#include <boost/weak_ptr.hpp>
 #include "crocoddyl/core/fwd.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "crocoddyl/core/action-base.hpp"
+#include "crocoddyl/core/integ-action-base.hpp"
 #include "crocoddyl/core/utils/to-string.hpp"
 
 namespace crocoddyl {
@@ -26,6 +29,15 @@ namespace crocoddyl {
  * `calcDiff` and `rollout`. The first computes the set of next states and cost values per each node \f$k\f$. Instead,
  * `calcDiff` updates the derivatives of all action models. Finally, `rollout` integrates the system dynamics. This
  * class is used to decouple problem formulation and resolution.
+ *
+ * The nodes do not need to share the same state. Each running node only has to produce a next state (and dynamics
+ * Jacobian) whose dimension matches the state of the following node. This allows us to chain, for instance, a
+ * whole-body phase, a transition action model and a reduced-order (e.g. centroidal) phase in the same problem.
+ *
+ * The datas removed from the horizon (e.g. by `circularAppend()` or `updateModel()`) are kept in a per-model pool and
+ * handed back when a node with the same model is added again. A model keeps its pool while it is out of the horizon,
+ * and the pool holds as many datas as the model had in use at once (nodes and solver trials). In receding-horizon
+ * loops, where a few models are cyclically appended, the problem stops allocating datas once the pool is warmed up.
  */
 template <typename _Scalar>
 class ShootingProblemTpl {
@@ -35,6 +47,7 @@ class ShootingProblemTpl {
   typedef _Scalar Scalar;
   typedef ActionModelAbstractTpl<Scalar> ActionModelAbstract;
   typedef ActionDataAbstractTpl<Scalar> ActionDataAbstract;
+  typedef StateAbstractTpl<Scalar> StateAbstract;
   typedef MathBaseTpl<Scalar> MathBase;
   typedef typename MathBase::VectorXs VectorXs;
 
@@ -67,6 +80,24 @@ class ShootingProblemTpl {
   ShootingProblemTpl(const ShootingProblemTpl<Scalar>& problem);
   ~ShootingProblemTpl();
 
+  /**
+   * @brief Clone the shooting problem
+   *
+   * Contrary to the copy constructor, which shares the models and datas, the cloned problem owns a clone of each
+   * action model (see `ActionModelAbstractTpl::clone()`) and allocates its own data. Nodes that shared the same model
+   * instance still share the same cloned instance. Therefore, the cloned problem can be modified, or solved in
+   * another thread, without affecting this problem.
+   *
+   * Note that the sharing is preserved only for the action models. Each cloned action model duplicates its own
+   * children, so action models that shared a differential, cost or contact model own separate clones of it (e.g.
+   * the nodes built by `IntegratedActionModelAbstractTpl::createWithTimeStep()`, or the contact phases of
+   * `SimpleQuadrupedGaitProblem`). Changing one of these shared children in the source problem changes all the nodes
+   * that use it, while in the cloned problem it changes only one node.
+   *
+   * @return the cloned shooting problem
+   */
+  boost::shared_ptr<ShootingProblemTpl<Scalar> > clone() const;
+
   /**
    * @brief Compute the cost and the next states
    *
@@ -112,6 +143,10 @@ class ShootingProblemTpl {
   /**
    * @brief Compute the quasic static commands given a state trajectory
    *
+   * The nodes are evaluated in parallel when multithreading is enabled. A node that shares the action model, the
+   * state and the initial command of its previous node reuses its quasi-static command; note that the data of the
+   * reused node is not updated.
+   *
    * @param[out] us  time-discrete control sequence \f$\mathbf{u_{s}}\f$ (size \f$T\f$)
    * @param[in]  xs  time-discrete state trajectory \f$\mathbf{x_{s}}\f$ (size \f$T+1\f$)
    */
@@ -139,7 +174,7 @@ class ShootingProblemTpl {
    * @copybrief circularAppend
    *
    * Once we update the end running node, the first running mode is removed as in a circular buffer.
-   * Note that this method allocates new data for the end running node.
+   * Note that the data of the end running node is taken from the data pool (see `acquireData()`).
    *
    * @param[in] model  action model
    */
@@ -156,13 +191,74 @@ class ShootingProblemTpl {
                   boost::shared_ptr<ActionDataAbstract> data);
 
   /**
-   * @brief Update a model and allocated new data for a specific node
+   * @brief Update a model for a specific node and take its data from the data pool
    *
    * @param[in] i      node index \f$(0\leq i \lt T+1)\f$
    * @param[in] model  action model
    */
   void updateModel(std::size_t i, boost::shared_ptr<ActionModelAbstract> model);
 
+  /**
+   * @brief Return a data of the given model, recycled from the data pool if possible
+   *
+   * A new data is created by the model only if the pool has no data of this model. The recycled data keeps the
+   * values of its previous node, but not its node parameters, i.e. it uses the references and weights of the model
+   * (see `ActionModelAbstractTpl::resetNodeParameters()`).
+   *
+   * @param[in] model  action model
+   * @return the action data
+   */
+  boost::shared_ptr<ActionDataAbstract> acquireData(const boost::shared_ptr<ActionModelAbstract>& model);
+
+  /**
+   * @brief Return a data, created by the given model, to the data pool
+   *
+   * The data must not be used anymore by any node, and its node parameters are reset. The datas in the pool and in
+   * use never exceed the highest number of datas of this model that were used at once (see `acquireData()`), so the
+   * extra datas (e.g. handed over by the user) are dropped. It also keeps only a weak reference to the models, and it
+   * drops the datas of the models that have been destroyed.
+   *
+   * @param[in] model  action model that created the data
+   * @param[in] data   action data
+   */
+  void releaseData(const boost::shared_ptr<ActionModelAbstract>& model,
+                   const boost::shared_ptr<ActionDataAbstract>& data);
+
+  /**
+   * @brief Remove all the datas of the data pool
+   *
+   * The count of datas in use is kept, so the pool is refilled by the next released datas.
+   */
+  void clearDataPool();
+
+  /**
+   * @brief Swap the running and terminal datas with the given ones
+   *
+   * The swap exchanges pointers only, so it runs in O(1). Solvers use it to double buffer the node datas, i.e. to
+   * run the line-search trials on their own datas and hand them over to the problem once a step is accepted. The
+   * given datas have to be created by the current action models.
+   *
+   * @param[in,out] running_datas  running datas (size \f$T\f$)
+   * @param[in,out] terminal_data  terminal data
+   */
+  void swapDatas(std::vector<boost::shared_ptr<ActionDataAbstract> >& running_datas,
+                 boost::shared_ptr<ActionDataAbstract>& terminal_data);
+
+  /**
+   * @brief Update the total cost from the cost of each node data
+   *
+   * Solvers that evaluate the nodes on their own (e.g. a linearization pipelined with the backward pass) use it to
+   * keep the total cost consistent with the node datas, as `calc()` and `calcDiff()` do.
+   *
+   * @return The total cost value
+   */
+  Scalar updateCost();
+
+  /**
+   * @brief Return the total cost computed by the last `calc()`, `calcDiff()` or `updateCost()`
+   */
+  const Scalar& get_cost() const;
+
   /**
    * @brief Return the number of running nodes
    */
@@ -199,22 +295,24 @@ class ShootingProblemTpl {
   void set_x0(const VectorXs& x0_in);
 
   /**
-   * @brief Modify the running models and allocate new data
+   * @brief Modify the running models and take their data from the data pool
    */
   void set_runningModels(const std::vector<boost::shared_ptr<ActionModelAbstract> >& models);
 
   /**
-   * @brief Modify the terminal model and allocate new data
+   * @brief Modify the terminal model and take its data from the data pool
    */
   void set_terminalModel(boost::shared_ptr<ActionModelAbstract> model);
 
   /**
-   * @brief Return the dimension of the state tuple
+   * @brief Return the dimension of the initial state tuple
+   *
+   * Note that the state dimension of each node is given by its action model.
    */
   const std::size_t& get_nx() const;
 
   /**
-   * @brief Return the dimension of the tangent space of the state manifold
+   * @brief Return the dimension of the tangent space of the initial state manifold
    */
   const std::size_t& get_ndx() const;
 
@@ -223,6 +321,23 @@ class ShootingProblemTpl {
    */
   const std::size_t& get_nu_max() const;
 
+  /**
+   * @brief Return the state shared by all the nodes
+   *
+   * It returns a null pointer if the nodes do not share the same state instance. The common state allows solvers
+   * to apply the trajectory-level state operations (e.g. `StateAbstractTpl::diffTrajectory()`) in a single call.
+   */
+  boost::shared_ptr<StateAbstract> get_commonState() const;
+
+  /**
+   * @brief Return the starting time of each node
+   *
+   * The vector has \f$T+1\f$ elements, where the last one is the time of the terminal node. The duration of each
+   * running node is the time step of its integrated action model (see `IntegratedActionModelAbstractTpl`). Nodes that
+   * are not integrated (e.g. impulse or transition models) have zero duration.
+   */
+  VectorXs get_timeGrid() const;
+
  protected:
   Scalar cost_;                                                          //!< Total cost
   std::size_t T_;                                                        //!< number of running nodes
@@ -231,12 +346,31 @@ class ShootingProblemTpl {
   boost::shared_ptr<ActionDataAbstract> terminal_data_;                  //!< Terminal action data
   std::vector<boost::shared_ptr<ActionModelAbstract> > running_models_;  //!< Running action model
   std::vector<boost::shared_ptr<ActionDataAbstract> > running_datas_;    //!< Running action data
-  std::size_t nx_;                                                       //!< State dimension
-  std::size_t ndx_;                                                      //!< State rate dimension
+  std::size_t nx_;                                                       //!< Initial state dimension
+  std::size_t ndx_;                                                      //!< Initial state rate dimension
   std::size_t nu_max_;                                                   //!< Maximum control dimension
 
+  /**
+   * @brief Datas of a model in the data pool
+   */
+  struct DataPoolEntry {
+    boost::weak_ptr<ActionModelAbstract> model;                 //!< Model that created the datas
+    std::vector<boost::shared_ptr<ActionDataAbstract> > datas;  //!< Datas that are not used by any node
+    std::size_t nused;                                          //!< Number of datas in use (nodes and solver trials)
+    std::size_t nmax;                                           //!< Highest number of datas in use at once
+  };
+  std::vector<DataPoolEntry> data_pool_;  //!< Datas removed from the horizon, grouped by the model that created them
+
  private:
   void allocateData();
+  DataPoolEntry& getDataPoolEntry(const boost::shared_ptr<ActionModelAbstract>& model);
+  void trackData(const boost::shared_ptr<ActionModelAbstract>& model);
+  void checkTransition(const std::size_t i, const boost::shared_ptr<ActionDataAbstract>& data,
+                       const boost::shared_ptr<ActionModelAbstract>& next_model) const;
+  void checkNodeUpdate(const std::size_t i, const boost::shared_ptr<ActionModelAbstract>& model,
+                       const boost::shared_ptr<ActionDataAbstract>& data) const;
+  void checkCircularAppend(const boost::shared_ptr<ActionModelAbstract>& model,
+                           const boost::shared_ptr<ActionDataAbstract>& data) const;
 };
 
 }  // namespace crocoddyl
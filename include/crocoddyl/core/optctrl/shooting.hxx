@@ -36,26 +36,10 @@ ShootingProblemTpl<Scalar>::ShootingProblemTpl(
     throw_pretty("Invalid argument: "
                  << "x0 has wrong dimension (it should be " + std::to_string(nx_) + ")");
   }
-  for (std::size_t i = 1; i < T_; ++i) {
-    const boost::shared_ptr<ActionModelAbstract>& model = running_models_[i];
-    if (model->get_state()->get_nx() != nx_) {
-      throw_pretty("Invalid argument: "
-                   << "nx in " << i << " node is not consistent with the other nodes")
-    }
-    if (model->get_state()->get_ndx() != ndx_) {
-      throw_pretty("Invalid argument: "
-                   << "ndx in " << i << " node is not consistent with the other nodes")
-    }
-  }
-  if (terminal_model_->get_state()->get_nx() != nx_) {
-    throw_pretty("Invalid argument: "
-                 << "nx in terminal node is not consistent with the other nodes")
-  }
-  if (terminal_model_->get_state()->get_ndx() != ndx_) {
-    throw_pretty("Invalid argument: "
-                 << "ndx in terminal node is not consistent with the other nodes")
-  }
   allocateData();
+  for (std::size_t i = 0; i < T_; ++i) {
+    checkTransition(i, running_datas_[i], i + 1 < T_ ? running_models_[i + 1] : terminal_model_);
+  }
 }
 
 template <typename Scalar>
@@ -94,23 +78,20 @@ ShootingProblemTpl<Scalar>::ShootingProblemTpl(
   for (std::size_t i = 0; i < T_; ++i) {
     const boost::shared_ptr<ActionModelAbstract>& model = running_models_[i];
     const boost::shared_ptr<ActionDataAbstract>& data = running_datas_[i];
-    if (model->get_state()->get_nx() != nx_) {
-      throw_pretty("Invalid argument: "
-                   << "nx in " << i << " node is not consistent with the other nodes")
-    }
-    if (model->get_state()->get_ndx() != ndx_) {
-      throw_pretty("Invalid argument: "
-                   << "ndx in " << i << " node is not consistent with the other nodes")
-    }
     if (!model->checkData(data)) {
       throw_pretty("Invalid argument: "
                    << "action data in " << i << " node is not consistent with the action model")
     }
+    checkTransition(i, data, i + 1 < T_ ? running_models_[i + 1] : terminal_model_);
   }
   if (!terminal_model->checkData(terminal_data)) {
     throw_pretty("Invalid argument: "
                  << "terminal action data is not consistent with the terminal action model")
   }
+  for (std::size_t i = 0; i < T_; ++i) {
+    trackData(running_models_[i]);
+  }
+  trackData(terminal_model_);
 }
 
 template <typename Scalar>
@@ -124,11 +105,42 @@ ShootingProblemTpl<Scalar>::ShootingProblemTpl(const ShootingProblemTpl<Scalar>&
       running_datas_(problem.get_runningDatas()),
       nx_(problem.get_nx()),
       ndx_(problem.get_ndx()),
-      nu_max_(problem.get_nu_max()) {}
+      nu_max_(problem.get_nu_max()) {
+  for (std::size_t i = 0; i < T_; ++i) {
+    trackData(running_models_[i]);
+  }
+  trackData(terminal_model_);
+}
 
 template <typename Scalar>
 ShootingProblemTpl<Scalar>::~ShootingProblemTpl() {}
 
+template <typename Scalar>
+boost::shared_ptr<ShootingProblemTpl<Scalar> > ShootingProblemTpl<Scalar>::clone() const {
+  std::map<const ActionModelAbstract*, boost::shared_ptr<ActionModelAbstract> > clones;
+  std::vector<boost::shared_ptr<ActionModelAbstract> > running_models;
+  running_models.reserve(T_);
+  for (std::size_t i = 0; i < T_; ++i) {
+    boost::shared_ptr<ActionModelAbstract>& model = clones[running_models_[i].get()];
+    if (!model) {
+      model = running_models_[i]->clone();
+    }
+    running_models.push_back(model);
+  }
+  boost::shared_ptr<ActionModelAbstract>& terminal_model = clones[terminal_model_.get()];
+  if (!terminal_model) {
+    terminal_model = terminal_model_->clone();
+  }
+  boost::shared_ptr<ShootingProblemTpl<Scalar> > problem = boost::allocate_shared<ShootingProblemTpl<Scalar> >(
+      Eigen::aligned_allocator<ShootingProblemTpl<Scalar> >(), x0_, running_models, terminal_model);
+  // The clone has its own datas, so we copy the node parameters (e.g. per-node references) into them
+  for (std::size_t i = 0; i < T_; ++i) {
+    running_models[i]->copyNodeParameters(running_datas_[i], problem->running_datas_[i]);
+  }
+  terminal_model->copyNodeParameters(terminal_data_, problem->terminal_data_);
+  return problem;
+}
+
 template <typename Scalar>
 Scalar ShootingProblemTpl<Scalar>::calc(const std::vector<VectorXs>& xs, const std::vector<VectorXs>& us) {
   if (xs.size() != T_ + 1) {
@@ -242,12 +254,39 @@ void ShootingProblemTpl<Scalar>::quasiStatic(std::vector<VectorXs>& us, const st
                  << "us has wrong dimension (it should be " + std::to_string(T_) + ")");
   }
 
+  // Consecutive nodes with the same model, state and initial command share their quasi-static command. Note that we
+  // check the dimensions here, as exceptions cannot be thrown inside the parallel region.
+  std::vector<char> is_reused(T_, false);
+  for (std::size_t i = 0; i < T_; ++i) {
+    const boost::shared_ptr<ActionModelAbstract>& model = running_models_[i];
+    const std::size_t& nu = model->get_nu();
+    if (static_cast<std::size_t>(xs[i].size()) != model->get_state()->get_nx()) {
+      throw_pretty("Invalid argument: "
+                   << "xs[" + std::to_string(i) + "] has wrong dimension (it should be " +
+                          std::to_string(model->get_state()->get_nx()) + ")");
+    }
+    if (static_cast<std::size_t>(us[i].size()) < nu) {
+      throw_pretty("Invalid argument: "
+                   << "us[" + std::to_string(i) + "] has wrong dimension (it should be " + std::to_string(nu) + ")");
+    }
+    is_reused[i] = i > 0 && model == running_models_[i - 1] && xs[i] == xs[i - 1] &&
+                   us[i].head(nu) == us[i - 1].head(nu);
+  }
+
 #ifdef CROCODDYL_WITH_MULTITHREADING
 #pragma omp parallel for
 #endif
   for (std::size_t i = 0; i < T_; ++i) {
-    const std::size_t& nu = running_models_[i]->get_nu();
-    running_models_[i]->quasiStatic(running_datas_[i], us[i].head(nu), xs[i]);
+    if (!is_reused[i]) {
+      const std::size_t& nu = running_models_[i]->get_nu();
+      running_models_[i]->quasiStatic(running_datas_[i], us[i].head(nu), xs[i]);
+    }
+  }
+  for (std::size_t i = 1; i < T_; ++i) {
+    if (is_reused[i]) {
+      const std::size_t& nu = running_models_[i]->get_nu();
+      us[i].head(nu) = us[i - 1].head(nu);
+    }
   }
 }
 
@@ -270,19 +309,16 @@ void ShootingProblemTpl<Scalar>::circularAppend(boost::shared_ptr<ActionModelAbs
     throw_pretty("Invalid argument: "
                  << "action data is not consistent with the action model")
   }
-  if (model->get_state()->get_nx() != nx_) {
-    throw_pretty("Invalid argument: "
-                 << "nx is not consistent with the other nodes")
-  }
-  if (model->get_state()->get_ndx() != ndx_) {
-    throw_pretty("Invalid argument: "
-                 << "ndx node is not consistent with the other nodes")
-  }
   if (model->get_nu() > nu_max_) {
     throw_pretty("Invalid argument: "
                  << "nu node is greater than the maximum nu")
   }
+  checkCircularAppend(model, data);
 
+  if (running_datas_[0] != data) {
+    releaseData(running_models_[0], running_datas_[0]);
+    trackData(model);
+  }
   for (std::size_t i = 0; i < T_ - 1; ++i) {
     running_models_[i] = running_models_[i + 1];
     running_datas_[i] = running_datas_[i + 1];
@@ -293,25 +329,25 @@ void ShootingProblemTpl<Scalar>::circularAppend(boost::shared_ptr<ActionModelAbs
 
 template <typename Scalar>
 void ShootingProblemTpl<Scalar>::circularAppend(boost::shared_ptr<ActionModelAbstract> model) {
-  if (model->get_state()->get_nx() != nx_) {
-    throw_pretty("Invalid argument: "
-                 << "nx is not consistent with the other nodes")
-  }
-  if (model->get_state()->get_ndx() != ndx_) {
-    throw_pretty("Invalid argument: "
-                 << "ndx node is not consistent with the other nodes")
-  }
   if (model->get_nu() > nu_max_) {
     throw_pretty("Invalid argument: "
                  << "nu node is greater than the maximum nu")
   }
+  boost::shared_ptr<ActionDataAbstract> data = acquireData(model);
+  try {
+    checkCircularAppend(model, data);
+  } catch (...) {
+    releaseData(model, data);
+    throw;
+  }
 
+  releaseData(running_models_[0], running_datas_[0]);
   for (std::size_t i = 0; i < T_ - 1; ++i) {
     running_models_[i] = running_models_[i + 1];
     running_datas_[i] = running_datas_[i + 1];
   }
   running_models_.back() = model;
-  running_datas_.back() = model->createData();
+  running_datas_.back() = data;
 }
 
 template <typename Scalar>
@@ -326,23 +362,24 @@ void ShootingProblemTpl<Scalar>::updateNode(std::size_t i, boost::shared_ptr<Act
     throw_pretty("Invalid argument: "
                  << "action data is not consistent with the action model")
   }
-  if (model->get_state()->get_nx() != nx_) {
-    throw_pretty("Invalid argument: "
-                 << "nx is not consistent with the other nodes")
-  }
-  if (model->get_state()->get_ndx() != ndx_) {
-    throw_pretty("Invalid argument: "
-                 << "ndx node is not consistent with the other nodes")
-  }
   if (model->get_nu() > nu_max_) {
     throw_pretty("Invalid argument: "
                  << "nu node is greater than the maximum nu")
   }
+  checkNodeUpdate(i, model, data);
 
   if (i == T_) {
+    if (terminal_data_ != data) {
+      releaseData(terminal_model_, terminal_data_);
+      trackData(model);
+    }
     terminal_model_ = model;
     terminal_data_ = data;
   } else {
+    if (running_datas_[i] != data) {
+      releaseData(running_models_[i], running_datas_[i]);
+      trackData(model);
+    }
     running_models_[i] = model;
     running_datas_[i] = data;
   }
@@ -354,28 +391,131 @@ void ShootingProblemTpl<Scalar>::updateModel(std::size_t i, boost::shared_ptr<Ac
     throw_pretty("Invalid argument: "
                  << "i is bigger than the allocated horizon (it should be lower than " + std::to_string(T_ + 1) + ")");
   }
-  if (model->get_state()->get_nx() != nx_) {
-    throw_pretty("Invalid argument: "
-                 << "nx is not consistent with the other nodes")
-  }
-  if (model->get_state()->get_ndx() != ndx_) {
-    throw_pretty("Invalid argument: "
-                 << "ndx is not consistent with the other nodes")
-  }
   if (model->get_nu() > nu_max_) {
     throw_pretty("Invalid argument: "
                  << "nu node is greater than the maximum nu")
   }
+  boost::shared_ptr<ActionDataAbstract> data = acquireData(model);
+  try {
+    checkNodeUpdate(i, model, data);
+  } catch (...) {
+    releaseData(model, data);
+    throw;
+  }
 
   if (i == T_) {
+    releaseData(terminal_model_, terminal_data_);
     terminal_model_ = model;
-    terminal_data_ = terminal_model_->createData();
+    terminal_data_ = data;
   } else {
+    releaseData(running_models_[i], running_datas_[i]);
     running_models_[i] = model;
-    running_datas_[i] = model->createData();
+    running_datas_[i] = data;
+  }
+}
+
+template <typename Scalar>
+boost::shared_ptr<ActionDataAbstractTpl<Scalar> > ShootingProblemTpl<Scalar>::acquireData(
+    const boost::shared_ptr<ActionModelAbstract>& model) {
+  DataPoolEntry& entry = getDataPoolEntry(model);
+  ++entry.nused;
+  if (entry.nmax < entry.nused) {
+    entry.nmax = entry.nused;
+  }
+  if (entry.datas.empty()) {
+    return model->createData();
+  }
+  boost::shared_ptr<ActionDataAbstract> data = entry.datas.back();
+  entry.datas.pop_back();
+  return data;
+}
+
+template <typename Scalar>
+void ShootingProblemTpl<Scalar>::releaseData(const boost::shared_ptr<ActionModelAbstract>& model,
+                                             const boost::shared_ptr<ActionDataAbstract>& data) {
+  if (!data) {
+    return;
+  }
+  DataPoolEntry& entry = getDataPoolEntry(model);
+  if (entry.nused > 0) {
+    --entry.nused;
+  }
+  // The pool is bounded by the highest number of datas in use, so a phase that leaves the horizon keeps all its datas,
+  // while the datas handed over by the user (e.g. in circularAppend(model, data)) do not pile up
+  if (entry.datas.size() + entry.nused < entry.nmax) {
+    model->resetNodeParameters(data);
+    entry.datas.push_back(data);
   }
 }
 
+template <typename Scalar>
+void ShootingProblemTpl<Scalar>::clearDataPool() {
+  for (std::size_t i = 0; i < data_pool_.size(); ++i) {
+    data_pool_[i].datas.clear();
+  }
+}
+
+template <typename Scalar>
+typename ShootingProblemTpl<Scalar>::DataPoolEntry& ShootingProblemTpl<Scalar>::getDataPoolEntry(
+    const boost::shared_ptr<ActionModelAbstract>& model) {
+  // The entries of destroyed models are dropped, as no node can be created with them anymore
+  std::size_t entry = data_pool_.size();
+  std::size_t i = 0;
+  while (i < data_pool_.size()) {
+    if (data_pool_[i].model.expired()) {
+      std::swap(data_pool_[i], data_pool_.back());
+      data_pool_.pop_back();
+      continue;
+    }
+    if (data_pool_[i].model.lock() == model) {
+      entry = i;
+    }
+    ++i;
+  }
+  if (entry == data_pool_.size()) {
+    data_pool_.push_back(DataPoolEntry());
+    data_pool_.back().model = model;
+    data_pool_.back().nused = 0;
+    data_pool_.back().nmax = 0;
+  }
+  return data_pool_[entry];
+}
+
+template <typename Scalar>
+void ShootingProblemTpl<Scalar>::trackData(const boost::shared_ptr<ActionModelAbstract>& model) {
+  DataPoolEntry& entry = getDataPoolEntry(model);
+  ++entry.nused;
+  if (entry.nmax < entry.nused) {
+    entry.nmax = entry.nused;
+  }
+}
+
+template <typename Scalar>
+void ShootingProblemTpl<Scalar>::swapDatas(std::vector<boost::shared_ptr<ActionDataAbstract> >& running_datas,
+                                           boost::shared_ptr<ActionDataAbstract>& terminal_data) {
+  if (running_datas.size() != T_) {
+    throw_pretty("Invalid argument: "
+                 << "running_datas has wrong dimension (it should be " + std::to_string(T_) + ")");
+  }
+  running_datas_.swap(running_datas);
+  terminal_data_.swap(terminal_data);
+}
+
+template <typename Scalar>
+Scalar ShootingProblemTpl<Scalar>::updateCost() {
+  cost_ = Scalar(0.);
+  for (std::size_t i = 0; i < T_; ++i) {
+    cost_ += running_datas_[i]->cost;
+  }
+  cost_ += terminal_data_->cost;
+  return cost_;
+}
+
+template <typename Scalar>
+const Scalar& ShootingProblemTpl<Scalar>::get_cost() const {
+  return cost_;
+}
+
 template <typename Scalar>
 const std::size_t& ShootingProblemTpl<Scalar>::get_T() const {
   return T_;
@@ -389,10 +529,56 @@ const typename MathBaseTpl<Scalar>::VectorXs& ShootingProblemTpl<Scalar>::get_x0
 template <typename Scalar>
 void ShootingProblemTpl<Scalar>::allocateData() {
   for (std::size_t i = 0; i < T_; ++i) {
-    const boost::shared_ptr<ActionModelAbstract>& model = running_models_[i];
-    running_datas_.push_back(model->createData());
+    running_datas_.push_back(acquireData(running_models_[i]));
+  }
+  terminal_data_ = acquireData(terminal_model_);
+}
+
+template <typename Scalar>
+void ShootingProblemTpl<Scalar>::checkTransition(const std::size_t i,
+                                                 const boost::shared_ptr<ActionDataAbstract>& data,
+                                                 const boost::shared_ptr<ActionModelAbstract>& next_model) const {
+  if (static_cast<std::size_t>(data->xnext.size()) != next_model->get_state()->get_nx()) {
+    throw_pretty("Invalid argument: "
+                 << "nx in " << i + 1 << " node is not consistent with the next state of the " << i
+                 << " node (it should be " << data->xnext.size() << ")")
+  }
+  if (static_cast<std::size_t>(data->Fx.rows()) != next_model->get_state()->get_ndx()) {
+    throw_pretty("Invalid argument: "
+                 << "ndx in " << i + 1 << " node is not consistent with the dynamics of the " << i
+                 << " node (it should be " << data->Fx.rows() << ")")
+  }
+}
+
+template <typename Scalar>
+void ShootingProblemTpl<Scalar>::checkNodeUpdate(const std::size_t i,
+                                                 const boost::shared_ptr<ActionModelAbstract>& model,
+                                                 const boost::shared_ptr<ActionDataAbstract>& data) const {
+  if (i == 0 && model->get_state()->get_nx() != nx_) {
+    throw_pretty("Invalid argument: "
+                 << "nx is not consistent with the initial state (it should be " + std::to_string(nx_) + ")")
+  }
+  if (i > 0) {
+    checkTransition(i - 1, running_datas_[i - 1], model);
+  }
+  if (i < T_) {
+    checkTransition(i, data, i + 1 < T_ ? running_models_[i + 1] : terminal_model_);
+  }
+}
+
+template <typename Scalar>
+void ShootingProblemTpl<Scalar>::checkCircularAppend(const boost::shared_ptr<ActionModelAbstract>& model,
+                                                     const boost::shared_ptr<ActionDataAbstract>& data) const {
+  const boost::shared_ptr<ActionModelAbstract>& first_model = T_ > 1 ? running_models_[1] : model;
+  if (first_model->get_state()->get_nx() != nx_) {
+    throw_pretty("Invalid argument: "
+                 << "nx in the new first node is not consistent with the initial state (it should be " +
+                        std::to_string(nx_) + ")")
   }
-  terminal_data_ = terminal_model_->createData();
+  if (T_ > 1) {
+    checkTransition(T_ - 1, running_datas_.back(), model);
+  }
+  checkTransition(T_ - 1, data, terminal_model_);
 }
 
 template <typename Scalar>
@@ -431,43 +617,50 @@ void ShootingProblemTpl<Scalar>::set_x0(const VectorXs& x0_in) {
 template <typename Scalar>
 void ShootingProblemTpl<Scalar>::set_runningModels(
     const std::vector<boost::shared_ptr<ActionModelAbstract> >& models) {
-  for (std::size_t i = 0; i < T_; ++i) {
-    const boost::shared_ptr<ActionModelAbstract>& model = running_models_[i];
-    if (model->get_state()->get_nx() != nx_) {
+  const std::size_t T = models.size();
+  for (std::size_t i = 0; i < T; ++i) {
+    if (models[i]->get_nu() > nu_max_) {
       throw_pretty("Invalid argument: "
-                   << "nx in " << i << " node is not consistent with the other nodes")
+                   << "nu node is greater than the maximum nu")
     }
-    if (model->get_state()->get_ndx() != ndx_) {
-      throw_pretty("Invalid argument: "
-                   << "ndx in " << i << " node is not consistent with the other nodes")
+  }
+  if (T > 0 && models[0]->get_state()->get_nx() != nx_) {
+    throw_pretty("Invalid argument: "
+                 << "nx in 0 node is not consistent with the initial state (it should be " + std::to_string(nx_) + ")")
+  }
+  std::vector<boost::shared_ptr<ActionDataAbstract> > datas;
+  datas.reserve(T);
+  for (std::size_t i = 0; i < T; ++i) {
+    datas.push_back(acquireData(models[i]));
+  }
+  // The transitions are checked against the dimension of the datas, so the datas go back to the pool if they fail
+  try {
+    for (std::size_t i = 0; i < T; ++i) {
+      checkTransition(i, datas[i], i + 1 < T ? models[i + 1] : terminal_model_);
     }
-    if (model->get_nu() > nu_max_) {
-      throw_pretty("Invalid argument: "
-                   << "nu node is greater than the maximum nu")
+  } catch (...) {
+    for (std::size_t i = 0; i < T; ++i) {
+      releaseData(models[i], datas[i]);
     }
+    throw;
   }
 
-  T_ = models.size();
-  running_models_.clear();
-  running_datas_.clear();
   for (std::size_t i = 0; i < T_; ++i) {
-    const boost::shared_ptr<ActionModelAbstract>& model = running_models_[i];
-    running_datas_.push_back(model->createData());
+    releaseData(running_models_[i], running_datas_[i]);
   }
+  T_ = T;
+  running_models_ = models;
+  running_datas_ = datas;
 }
 
 template <typename Scalar>
 void ShootingProblemTpl<Scalar>::set_terminalModel(boost::shared_ptr<ActionModelAbstract> model) {
-  if (model->get_state()->get_nx() != nx_) {
-    throw_pretty("Invalid argument: "
-                 << "nx is not consistent with the other nodes")
-  }
-  if (model->get_state()->get_ndx() != ndx_) {
-    throw_pretty("Invalid argument: "
-                 << "ndx is not consistent with the other nodes")
+  if (T_ > 0) {
+    checkTransition(T_ - 1, running_datas_.back(), model);
   }
+  releaseData(terminal_model_, terminal_data_);
   terminal_model_ = model;
-  terminal_data_ = terminal_model_->createData();
+  terminal_data_ = acquireData(model);
 }
 
 template <typename Scalar>
@@ -480,9 +673,34 @@ const std::size_t& ShootingProblemTpl<Scalar>::get_ndx() const {
   return ndx_;
 }
 
+template <typename Scalar>
+boost::shared_ptr<StateAbstractTpl<Scalar> > ShootingProblemTpl<Scalar>::get_commonState() const {
+  const boost::shared_ptr<StateAbstract>& state = terminal_model_->get_state();
+  for (std::size_t i = 0; i < T_; ++i) {
+    if (running_models_[i]->get_state() != state) {
+      return boost::shared_ptr<StateAbstract>();
+    }
+  }
+  return state;
+}
+
 template <typename Scalar>
 const std::size_t& ShootingProblemTpl<Scalar>::get_nu_max() const {
   return nu_max_;
 }
 
+template <typename Scalar>
+typename MathBaseTpl<Scalar>::VectorXs ShootingProblemTpl<Scalar>::get_timeGrid() const {
+  VectorXs time_grid = VectorXs::Zero(T_ + 1);
+  for (std::size_t i = 0; i < T_; ++i) {
+    boost::shared_ptr<IntegratedActionModelAbstractTpl<Scalar> > model =
+        boost::dynamic_pointer_cast<IntegratedActionModelAbstractTpl<Scalar> >(running_models_[i]);
+    time_grid[i + 1] = time_grid[i];
+    if (model != NULL) {
+      time_grid[i + 1] += model->get_dt();
+    }
+  }
+  return time_grid;
+}
+
 }  // namespace crocoddyl
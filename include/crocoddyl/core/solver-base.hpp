@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "crocoddyl/core/optctrl/shooting.hpp"
+#include "crocoddyl/core/utils/cancellation.hpp"
 
 namespace crocoddyl {
 
@@ -127,7 +128,8 @@ class SolverAbstract {
    *
    * The solver candidates are defined as a state and control trajectories \f$(\mathbf{x}_s,\mathbf{u}_s)\f$ of
    * \f$T+1\f$ and \f$T\f$ elements, respectively. Additionally, we need to define is \f$(\mathbf{x}_s,\mathbf{u}_s)\f$
-   * pair is feasible, this means that the dynamics rollout give us produces \f$\mathbf{x}_s\f$.
+   * pair is feasible, this means that the dynamics rollout give us produces \f$\mathbf{x}_s\f$. The controls can be
+   * shorter than the maximum control dimension of the problem, and they are padded with zeros.
    *
    * @param[in]  xs          state trajectory of \f$T+1\f$ elements (default [])
    * @param[in]  us          control trajectory of \f$T\f$ elements (default [])
@@ -151,6 +153,19 @@ class SolverAbstract {
    */
   const std::vector<boost::shared_ptr<CallbackAbstract> >& getCallbacks() const;
 
+  /**
+   * @brief Return the cancellation token checked by `solve()`
+   */
+  const boost::shared_ptr<CancellationToken>& get_cancellation_token() const;
+
+  /**
+   * @brief Modify the cancellation token checked by `solve()`
+   *
+   * The solvers check the token between iterations and between line-search trials. Once it is cancelled, `solve()`
+   * returns false and the solver keeps its last accepted iterate. A null token disables the checks.
+   */
+  void set_cancellation_token(boost::shared_ptr<CancellationToken> token);
+
   /**
    * @brief Return the shooting problem
    */
@@ -257,6 +272,11 @@ class SolverAbstract {
   void set_th_stop(const double& th_stop);
 
  protected:
+  /**
+   * @brief Return true if the cancellation of the running solve was requested
+   */
+  inline bool isCancelled() const { return cancellation_token_ && cancellation_token_->is_cancelled(); }
+
   boost::shared_ptr<ShootingProblem> problem_;                   //!< optimal control problem
   std::vector<Eigen::VectorXd> xs_;                              //!< State trajectory
   std::vector<Eigen::VectorXd> us_;                              //!< Control trajectory
@@ -273,6 +293,7 @@ class SolverAbstract {
   double th_acceptstep_;                                         //!< Threshold used for accepting step
   double th_stop_;                                               //!< Tolerance for stopping the algorithm
   std::size_t iter_;                                             //!< Number of iteration performed by the solver
+  boost::shared_ptr<CancellationToken> cancellation_token_;      //!< Token checked for cancelling the solve
 };
 
 /**
@@ -25,6 +25,7 @@ namespace crocoddyl {
  *  - the optimal decision vector
  *  - the indexes for the free space
  *  - the indexes for the clamped (constrained) space
+ *  - the label that indicates if the free space Hessian was factorized
  */
 struct BoxQPSolution {
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -32,7 +33,7 @@ struct BoxQPSolution {
   /**
    * @brief Initialize the QP solution structure
    */
-  BoxQPSolution() {}
+  BoxQPSolution() : success(false) {}
 
   /**
    * @brief Initialize the QP solution structure
@@ -44,12 +45,13 @@ struct BoxQPSolution {
    */
   BoxQPSolution(const Eigen::MatrixXd& Hff_inv, const Eigen::VectorXd& x, const std::vector<size_t>& free_idx,
                 const std::vector<size_t>& clamped_idx)
-      : Hff_inv(Hff_inv), x(x), free_idx(free_idx), clamped_idx(clamped_idx) {}
+      : Hff_inv(Hff_inv), x(x), free_idx(free_idx), clamped_idx(clamped_idx), success(true) {}
 
   Eigen::MatrixXd Hff_inv;          //!< Inverse of the free space Hessian
   Eigen::VectorXd x;                //!< Decision vector
   std::vector<size_t> free_idx;     //!< Free space indexes
   std::vector<size_t> clamped_idx;  //!< Clamped space indexes
+  bool success;                     //!< False if the free space Hessian is not positive definite
 };
 
 /**
@@ -104,7 +106,8 @@ class BoxQP {
    * @param[in] lb     Lower bound (dimension nx)
    * @param[in] ub     Upper bound (dimension nx)
    * @param[in] xinit  Initial guess (dimension nx)
-   * @return The solution of the problem
+   * @return The solution of the problem. Its `success` label is false when the Hessian of the free space is not
+   * positive definite, and then the decision vector is the last iterate
    */
   const BoxQPSolution& solve(const Eigen::MatrixXd& H, const Eigen::VectorXd& q, const Eigen::VectorXd& lb,
                              const Eigen::VectorXd& ub, const Eigen::VectorXd& xinit);
@@ -10,12 +10,21 @@
 #define CROCODDYL_CORE_SOLVERS_DDP_HPP_
 
 #include <Eigen/Cholesky>
+#include <Eigen/QR>
 #include <vector>
 
 #include "crocoddyl/core/solver-base.hpp"
 
 namespace crocoddyl {
 
+/**
+ * @brief Outcome of the last backward or forward pass
+ *
+ * The passes report a failure (non positive-definite \f$\mathbf{Q}_{\mathbf{uu}}\f$ or NaN values) through this
+ * status instead of raising an exception, so that `solve()` can increase the regularization with a simple branch.
+ */
+enum PassStatus { PassSuccess = 0, BackwardError, ForwardError };
+
 /**
  * @brief Differential Dynamic Programming (DDP) solver
  *
@@ -43,6 +52,11 @@ namespace crocoddyl {
  *   \mathbf{\hat{x}}_{k+1} &=& \mathbf{f}_k(\mathbf{\hat{x}}_k,\mathbf{\hat{u}}_k).
  * \f}
  *
+ * An iteration of `solve()` runs `computeDirectionStep()` and `tryStepLength()`, which report the failures with a
+ * `PassStatus` instead of raising an exception. They are the extension points of a derived solver, together with the
+ * per-node hooks of the pipelined backward pass (`linearizeNode()`, `computeTerminalValue()` and
+ * `computeRiccatiStep()`).
+ *
  * \sa `backwardPass()` and `forwardPass()`
  */
 class SolverDDP : public SolverAbstract {
@@ -75,6 +89,28 @@ class SolverDDP : public SolverAbstract {
    */
   virtual double calcDiff();
 
+  /**
+   * @brief Compute the gaps of the dynamics and update the feasibility of the guess
+   *
+   * The gaps only depend on the rollout of the guess (i.e. `ShootingProblem::calc()`), not on its derivatives.
+   */
+  void computeGaps();
+
+  /**
+   * @brief Update the derivatives of the optimal control problem and run the backward pass
+   *
+   * It is equivalent to run `calcDiff()` followed by `backwardPass()`. With multithreading support, both are pipelined
+   * through OpenMP tasks: the nodes are linearized in reverse time order, and the Riccati step of a node starts as soon
+   * as its derivatives and the Value function of the next node are ready. It overlaps the serial backward pass with
+   * the parallel linearization. If the accepted step was already linearized during its rollout (speculative forward
+   * pass), then it only computes the gaps before the backward pass. Note that the pipeline runs the per-node hooks
+   * instead of `calcDiff()` and `backwardPass()`, so a derived solver that overrides them also overrides
+   * `computeDirectionStep()`.
+   *
+   * @return  The total cost around the guess trajectory
+   */
+  double calcDiffAndBackwardPass();
+
   /**
    * @brief Run the backward pass (Riccati sweep)
    *
@@ -101,9 +137,66 @@ class SolverDDP : public SolverAbstract {
    * Hessians of the cost function, \f$V_{\mathbf{x}_{k+1}}\f$ and \f$V_{\mathbf{xx}_{k+1}}\f$ defines the
    * linear-quadratic approximation of the Value function, and \f$\mathbf{\bar{f}}_{k+1}\f$ describes the gaps of the
    * dynamics.
+   *
+   * A failure is reported through `get_pass_status()` rather than raising an exception.
    */
   virtual void backwardPass();
 
+  /**
+   * @brief Compute the Hessians of the Hamiltonian from the factor of the next Value function
+   *
+   * It is the first half of the square-root Riccati step (see `set_square_root()`). The stage Hessian
+   * \f$\mathbf{H}_k\f$ of \f$(\mathbf{u},\mathbf{x})\f$ (with the regularization) is factorized as
+   * \f$\mathbf{F}^\top_k\mathbf{F}_k\f$, and the upper-triangular factor \f$\mathbf{R}_k\f$ of the Hamiltonian
+   * Hessian is obtained from the QR decomposition of
+   * \f$\begin{bmatrix}\mathbf{F}_k \\ \mathbf{S}_{k+1}[\mathbf{f}_{\mathbf{u}_k}\;\mathbf{f}_{\mathbf{x}_k}]
+   * \end{bmatrix}\f$. A non positive-semidefinite stage Hessian is reported through `get_pass_status()`.
+   *
+   * @param[in] t  node index
+   */
+  void computeSquareRootHamiltonian(const std::size_t& t);
+
+  /**
+   * @brief Compute the feedforward and feedback terms from the factor of the Hamiltonian Hessian
+   *
+   * As \f$\mathbf{Q}_{\mathbf{uu}_k}=\mathbf{R}^\top_{\mathbf{uu}_k}\mathbf{R}_{\mathbf{uu}_k}\f$ and
+   * \f$\mathbf{Q}_{\mathbf{ux}_k}=\mathbf{R}^\top_{\mathbf{uu}_k}\mathbf{R}_{\mathbf{ux}_k}\f$, it computes
+   * \f$\mathbf{K}_k=\mathbf{R}^{-1}_{\mathbf{uu}_k}\mathbf{R}_{\mathbf{ux}_k}\f$ and
+   * \f$\mathbf{k}_k=\mathbf{R}^{-1}_{\mathbf{uu}_k}\mathbf{R}^{-\top}_{\mathbf{uu}_k}\mathbf{Q}_{\mathbf{u}_k}\f$
+   * with triangular solves, i.e. without factorizing \f$\mathbf{Q}_{\mathbf{uu}_k}\f$ again. A singular
+   * \f$\mathbf{R}_{\mathbf{uu}_k}\f$ is reported through `get_pass_status()`.
+   *
+   * @param[in] t  node index
+   */
+  void computeSquareRootGains(const std::size_t& t);
+
+  /**
+   * @brief Compute the factor of the Value function, i.e. the second half of the square-root Riccati step
+   *
+   * The factor \f$\mathbf{S}_k\f$ is the state block of \f$\mathbf{R}_k\f$ updated, through Givens rotations,
+   * with the rows of \f$\mathbf{R}_{\mathbf{ux}_k}-\mathbf{R}_{\mathbf{uu}_k}\mathbf{K}_k\f$.
+   *
+   * @param[in] t  node index
+   */
+  void computeSquareRootValue(const std::size_t& t);
+
+  /**
+   * @brief Factorize a positive semi-definite matrix as \f$\mathbf{A}=\mathbf{F}^\top\mathbf{F}\f$
+   *
+   * @param[in] A   symmetric matrix
+   * @param[out] F  factor of A
+   * @return  false if A is indefinite
+   */
+  bool factorizeSemidefinite(const Eigen::MatrixXd& A, Eigen::MatrixXd& F);
+
+  /**
+   * @brief Rank-one update of a triangular factor, i.e. \f$\mathbf{R}^\top\mathbf{R}+\mathbf{w}\mathbf{w}^\top\f$
+   *
+   * @param[in,out] R  upper-triangular factor
+   * @param[in,out] w  update vector (it is overwritten)
+   */
+  static void choleskyUpdate(Eigen::MatrixXd& R, Eigen::VectorXd& w);
+
   /**
    * @brief Run the forward pass or rollout
    *
@@ -116,6 +209,8 @@ class SolverDDP : public SolverAbstract {
    * \f}
    * We can define different step lengths \f$\alpha\f$.
    *
+   * A NaN in the rollout is reported through `get_pass_status()` rather than raising an exception.
+   *
    * @param  stepLength  applied step length (\f$0\leq\alpha\leq1\f$)
    */
   virtual void forwardPass(const double& stepLength);
@@ -130,8 +225,10 @@ class SolverDDP : public SolverAbstract {
    * \mathbf{K}_k &=& \mathbf{Q}_{\mathbf{uu}_k}^{-1}\mathbf{Q}_{\mathbf{ux}}.
    * \f}
    *
-   * Note that if the Cholesky decomposition fails, then we re-start the backward pass and increase the
-   * state and control regularization values.
+   * Note that if the Cholesky decomposition fails, then it sets the `BackwardError` status, and the solver re-starts
+   * the backward pass with increased state and control regularization values. In the square-root backward pass, it
+   * solves with the factor of the Hamiltonian instead (see `computeSquareRootGains()`). A derived solver that
+   * overrides this function (e.g. the box solvers) uses the \f$\mathbf{Q}_{\mathbf{uu}_k}\f$ rebuilt from it.
    */
   virtual void computeGains(const std::size_t& t);
 
@@ -145,11 +242,41 @@ class SolverDDP : public SolverAbstract {
    */
   void decreaseRegularization();
 
+  /**
+   * @brief Accept the trial step computed by the line-search procedure
+   *
+   * It swaps the accepted and trial trajectories, and hands over the trial node datas to the problem. All these
+   * swaps run in O(1). As the line-search trials run on their own datas, a rejected trial never overwrites the node
+   * datas of the accepted trajectory.
+   *
+   * @param[in] is_feasible  true if the trial trajectory is dynamically feasible
+   */
+  void acceptStep(const bool& is_feasible);
+
+  /**
+   * @brief Keep the trial node datas consistent with the action models of the problem
+   *
+   * It creates new trial datas only for the nodes whose action model has changed, e.g. after
+   * `ShootingProblem::circularAppend()` or `ShootingProblem::updateModel()`. It also copies the node parameters of
+   * the problem datas into the trial datas (see `ActionModelAbstract::copyNodeParameters()`). It is called once at the
+   * beginning of `solve()` and of `computeDirection()`, not in each line-search trial.
+   */
+  void updateTrialDatas();
+
   /**
    * @brief Allocate all the internal data needed for the solver
    */
   virtual void allocateData();
 
+  /**
+   * @brief Reallocate the buffers of the nodes whose dimension has changed
+   *
+   * A node update (e.g. `ShootingProblem::circularAppend()` or `ShootingProblem::updateModel()`) can move a node
+   * whose state dimension differs from the one it replaces. It is called at the beginning of `solve()` and of
+   * `computeDirection()`.
+   */
+  void resizeData();
+
   /**
    * @brief Return the regularization factor used to decrease / increase it
    */
@@ -190,11 +317,27 @@ class SolverDDP : public SolverAbstract {
    */
   const double& get_th_gaptol() const;
 
+  /**
+   * @brief Return the status of the last backward or forward pass
+   */
+  PassStatus get_pass_status() const;
+
+  /**
+   * @brief Return true if the backward pass propagates the factors of the Value function
+   */
+  bool get_square_root() const;
+
   /**
    * @brief Return the Hessian of the Value function \f$V_{\mathbf{xx}_s}\f$
    */
   const std::vector<Eigen::MatrixXd>& get_Vxx() const;
 
+  /**
+   * @brief Return the factors \f$\mathbf{S}_s\f$ of the Hessian of the Value function, i.e.
+   * \f$V_{\mathbf{xx}}=\mathbf{S}^\top\mathbf{S}\f$ (only updated by the square-root backward pass)
+   */
+  const std::vector<Eigen::MatrixXd>& get_Sxx() const;
+
   /**
    * @brief Return the Hessian of the Value function \f$V_{\mathbf{x}_s}\f$
    */
@@ -280,7 +423,64 @@ class SolverDDP : public SolverAbstract {
    */
   void set_th_gaptol(const double& th_gaptol);
 
+  /**
+   * @brief Enable or disable the square-root backward pass
+   *
+   * Instead of \f$V_{\mathbf{xx}}\f$, the square-root Riccati recursion propagates a factor \f$\mathbf{S}\f$ with
+   * \f$V_{\mathbf{xx}}=\mathbf{S}^\top\mathbf{S}\f$ through QR decompositions and rank-one updates. The Hessians
+   * of the Value function and Hamiltonian are then positive semi-definite by construction, which avoids the
+   * regularization increases caused by round-off errors in ill-conditioned problems. It requires convex stage costs
+   * (e.g. Gauss-Newton approximations), otherwise the regularization is increased until they are.
+   */
+  void set_square_root(const bool& square_root);
+
  protected:
+  /**
+   * @brief Compute the search direction of an iteration of `solve()`
+   *
+   * By default, it runs `calcDiffAndBackwardPass()` or `backwardPass()`. `computeDirection()` runs it too, and turns
+   * a failure into an exception.
+   *
+   * @param[in] recalcDiff  true if the derivatives of the problem have to be updated
+   * @return the status of the backward pass
+   */
+  virtual PassStatus computeDirectionStep(const bool& recalcDiff);
+
+  /**
+   * @brief Try a step length of the line search of `solve()`
+   *
+   * By default, it runs `forwardPass()` and, on success, it updates the cost reduction. `tryStep()` runs it too, and
+   * turns a failure into an exception.
+   *
+   * @param[in] steplength  applied step length (\f$0\leq\alpha\leq1\f$)
+   * @return the status of the forward pass
+   */
+  virtual PassStatus tryStepLength(const double& steplength);
+
+  /**
+   * @brief Compute the derivatives of a node around the guess, i.e. a task of the pipelined backward pass
+   *
+   * The nodes are linearized concurrently, so an overridden hook only writes in the data of its node.
+   *
+   * @param[in] t  node index (the terminal node is \f$T\f$)
+   */
+  virtual void linearizeNode(const std::size_t& t);
+
+  /**
+   * @brief Initialize the Value function with the terminal node, i.e. the first step of the backward pass
+   */
+  virtual void computeTerminalValue();
+
+  /**
+   * @brief Run the Riccati step of the backward pass for a running node
+   *
+   * It computes the Hamiltonian, the gains (`computeGains()`) and the Value function of the node \f$t\f$ from the
+   * Value function of the node \f$t+1\f$. A failure is reported through `get_pass_status()`.
+   *
+   * @param[in] t  node index
+   */
+  virtual void computeRiccatiStep(const std::size_t& t);
+
   double regfactor_;  //!< Regularization factor used to decrease / increase it
   double regmin_;     //!< Minimum allowed regularization value
   double regmax_;     //!< Maximum allowed regularization value
@@ -289,9 +489,15 @@ class SolverDDP : public SolverAbstract {
   std::vector<Eigen::VectorXd> xs_try_;  //!< State trajectory computed by line-search procedure
   std::vector<Eigen::VectorXd> us_try_;  //!< Control trajectory computed by line-search procedure
   std::vector<Eigen::VectorXd> dx_;
+  std::vector<boost::shared_ptr<ActionModelAbstract> > running_models_try_;  //!< Action models of the trial datas
+  std::vector<boost::shared_ptr<ActionDataAbstract> > running_datas_try_;    //!< Running datas of the trials
+  boost::shared_ptr<ActionModelAbstract> terminal_model_try_;                //!< Action model of the terminal trial
+  boost::shared_ptr<ActionDataAbstract> terminal_data_try_;                  //!< Terminal data of the trials
+  std::vector<char> node_deps_;  //!< Dependency tokens of the pipelined linearization and backward pass
 
   // allocate data
   std::vector<Eigen::MatrixXd> Vxx_;  //!< Hessian of the Value function
+  std::vector<Eigen::MatrixXd> Sxx_;  //!< Factor of the Hessian of the Value function
   std::vector<Eigen::VectorXd> Vx_;   //!< Gradient of the Value function
   std::vector<Eigen::MatrixXd> Qxx_;  //!< Hessian of the Hamiltonian
   std::vector<Eigen::MatrixXd> Qxu_;  //!< Hessian of the Hamiltonian
@@ -309,11 +515,23 @@ class SolverDDP : public SolverAbstract {
   std::vector<Eigen::LLT<Eigen::MatrixXd> > Quu_llt_;  //!< Cholesky LLT solver
   std::vector<Eigen::VectorXd> Quuk_;                  //!< Quuk term
   std::vector<double> alphas_;                         //!< Set of step lengths using by the line-search procedure
-  double th_grad_;     //!< Tolerance of the expected gradient used for testing the step
-  double th_gaptol_;   //!< Threshold limit to check non-zero gaps
-  double th_stepdec_;  //!< Step-length threshold used to decrease regularization
-  double th_stepinc_;  //!< Step-length threshold used to increase regularization
-  bool was_feasible_;  //!< Label that indicates in the previous iterate was feasible
+  Eigen::MatrixXd sqrt_H_;                             //!< Stage Hessian of the square-root Riccati step
+  Eigen::MatrixXd sqrt_F_;                             //!< Factor of the stage Hessian
+  Eigen::MatrixXd sqrt_M_;                             //!< Stacked factors of the Hamiltonian Hessian
+  Eigen::MatrixXd sqrt_R_;                             //!< Triangular factor of the Hamiltonian Hessian
+  Eigen::MatrixXd sqrt_D_;                             //!< Rank-one updates of the Value function factor
+  Eigen::VectorXd sqrt_w_;                             //!< Rank-one update vector
+  Eigen::LDLT<Eigen::MatrixXd> sqrt_ldlt_;             //!< LDLT solver of the square-root Riccati step
+  Eigen::HouseholderQR<Eigen::MatrixXd> sqrt_qr_;      //!< QR solver of the square-root Riccati step
+  double th_grad_;          //!< Tolerance of the expected gradient used for testing the step
+  double th_gaptol_;        //!< Threshold limit to check non-zero gaps
+  double th_stepdec_;       //!< Step-length threshold used to decrease regularization
+  double th_stepinc_;       //!< Step-length threshold used to increase regularization
+  bool was_feasible_;       //!< Label that indicates in the previous iterate was feasible
+  PassStatus pass_status_;  //!< Status of the last backward or forward pass
+  bool trial_linearized_;   //!< Label that indicates that the trial datas were linearized during the rollout
+  bool datas_linearized_;   //!< Label that indicates that the problem datas were linearized by an accepted trial
+  bool square_root_;        //!< Label that indicates if the backward pass propagates the Value function factors
 };
 
 }  // namespace crocoddyl
@@ -77,8 +77,21 @@ class SolverFDDP : public SolverDDP {
 
   /**
    * @brief Update internal values for computing the expected improvement
+   *
+   * It also caches the state shared by all the nodes, so `expectedImprovement()` can compute the trajectory
+   * difference with a single batched call in each trial of the line search.
    */
   void updateExpectedImprovement();
+
+  /**
+   * @copybrief SolverDDP::forwardPass
+   *
+   * If the speculative rollout is enabled, a full step (\f$\alpha=1\f$) linearizes each node as soon as its rollout
+   * is done. With multithreading support, these derivatives are computed by OpenMP tasks while the rollout continues.
+   * If the step is accepted, then `calcDiffAndBackwardPass()` reuses them; otherwise they are discarded.
+   *
+   * @param[in] stepLength  applied step length (\f$0\leq\alpha\leq1\f$)
+   */
   virtual void forwardPass(const double& stepLength);
 
   /**
@@ -91,13 +104,37 @@ class SolverFDDP : public SolverDDP {
    */
   void set_th_acceptnegstep(const double& th_acceptnegstep);
 
+  /**
+   * @brief Return true if the full-step rollouts are speculatively linearized
+   */
+  bool get_speculative() const;
+
+  /**
+   * @brief Enable or disable the speculative linearization of the full-step rollouts
+   *
+   * It pays off when most of the iterations accept a full step. The trial nodes are linearized through
+   * `linearizeTrialNode()`. Note that `SolverBoxFDDP` does not speculate, as it runs its own rollout.
+   */
+  void set_speculative(const bool& speculative);
+
  protected:
-  double dg_;  //!< Internal data for computing the expected improvement
-  double dq_;  //!< Internal data for computing the expected improvement
-  double dv_;  //!< Internal data for computing the expected improvement
+  /**
+   * @brief Compute the derivatives of a trial node around its rollout, i.e. a task of the speculative rollout
+   *
+   * The nodes are linearized concurrently, so an overridden hook only writes in the data of its node.
+   *
+   * @param[in] t  node index (the terminal node is \f$T\f$)
+   */
+  virtual void linearizeTrialNode(const std::size_t& t);
+
+  double dg_;                                      //!< Internal data for computing the expected improvement
+  double dq_;                                      //!< Internal data for computing the expected improvement
+  double dv_;                                      //!< Internal data for computing the expected improvement
+  boost::shared_ptr<StateAbstract> common_state_;  //!< State shared by all the nodes (null if they differ)
 
  private:
   double th_acceptnegstep_;  //!< Threshold used for accepting step along ascent direction
+  bool speculative_;         //!< Label that indicates if the full-step rollouts are speculatively linearized
 };
 
 }  // namespace crocoddyl
@@ -196,6 +196,48 @@ class StateAbstractTpl {
   virtual void JintegrateTransport(const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& dx,
                                    Eigen::Ref<MatrixXs> Jin, const Jcomponent firstsecond) const = 0;
 
+  /**
+   * @brief Compute the state manifold differentiation along a trajectory
+   *
+   * It computes \f$\mathbf{x}_{1,k}\ominus\mathbf{x}_{0,k}\f$ for every node \f$k\f$ of the trajectory. The default
+   * implementation calls `diff()` node by node; derived states might override it in order to avoid the per-node
+   * dispatch or to process the nodes in parallel.
+   *
+   * @param[in]  x0s     Previous state points (size `T`, each of size `nx`)
+   * @param[in]  x1s     Current state points (size `T`, each of size `nx`)
+   * @param[out] dxouts  Differences between the current and previous state points (size `T`, each of size `ndx`)
+   */
+  virtual void diffTrajectory(const std::vector<VectorXs>& x0s, const std::vector<VectorXs>& x1s,
+                              std::vector<VectorXs>& dxouts) const;
+
+  /**
+   * @brief Compute the state manifold integration along a trajectory
+   *
+   * It computes \f$\mathbf{x}_{k}\oplus\delta\mathbf{x}_{k}\f$ for every node \f$k\f$ of the trajectory. The
+   * default implementation calls `integrate()` node by node.
+   *
+   * @param[in]  xs     State points (size `T`, each of size `nx`)
+   * @param[in]  dxs    Velocity vectors (size `T`, each of size `ndx`)
+   * @param[out] xouts  Next state points (size `T`, each of size `nx`)
+   */
+  virtual void integrateTrajectory(const std::vector<VectorXs>& xs, const std::vector<VectorXs>& dxs,
+                                   std::vector<VectorXs>& xouts) const;
+
+  /**
+   * @brief Parallel transport from x + dx to x along a trajectory
+   *
+   * It applies `JintegrateTransport()` to every node \f$k\f$ of the trajectory. The default implementation calls
+   * it node by node.
+   *
+   * @param[in]  xs          State points (size `T`, each of size `nx`)
+   * @param[in]  dxs         Velocity vectors (size `T`, each of size `ndx`)
+   * @param[out] Jins        Input matrices (size `T`, each with number of rows = `nv`)
+   * @param[in] firstsecond  Argument (either x or dx) with respect to which the differentiation of Jintegrate is
+   * performed.
+   */
+  virtual void JintegrateTransportTrajectory(const std::vector<VectorXs>& xs, const std::vector<VectorXs>& dxs,
+                                             std::vector<MatrixXs>& Jins, const Jcomponent firstsecond) const;
+
   /**
    * @copybrief diff()
    *
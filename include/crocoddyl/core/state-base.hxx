@@ -30,6 +30,59 @@ StateAbstractTpl<Scalar>::StateAbstractTpl()
 template <typename Scalar>
 StateAbstractTpl<Scalar>::~StateAbstractTpl() {}
 
+template <typename Scalar>
+void StateAbstractTpl<Scalar>::diffTrajectory(const std::vector<VectorXs>& x0s, const std::vector<VectorXs>& x1s,
+                                              std::vector<VectorXs>& dxouts) const {
+  const std::size_t T = x0s.size();
+  if (x1s.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "x1s has wrong dimension (it should be " + std::to_string(T) + ")");
+  }
+  if (dxouts.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "dxouts has wrong dimension (it should be " + std::to_string(T) + ")");
+  }
+  for (std::size_t i = 0; i < T; ++i) {
+    diff(x0s[i], x1s[i], dxouts[i]);
+  }
+}
+
+template <typename Scalar>
+void StateAbstractTpl<Scalar>::integrateTrajectory(const std::vector<VectorXs>& xs, const std::vector<VectorXs>& dxs,
+                                                   std::vector<VectorXs>& xouts) const {
+  const std::size_t T = xs.size();
+  if (dxs.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "dxs has wrong dimension (it should be " + std::to_string(T) + ")");
+  }
+  if (xouts.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "xouts has wrong dimension (it should be " + std::to_string(T) + ")");
+  }
+  for (std::size_t i = 0; i < T; ++i) {
+    integrate(xs[i], dxs[i], xouts[i]);
+  }
+}
+
+template <typename Scalar>
+void StateAbstractTpl<Scalar>::JintegrateTransportTrajectory(const std::vector<VectorXs>& xs,
+                                                             const std::vector<VectorXs>& dxs,
+                                                             std::vector<MatrixXs>& Jins,
+                                                             const Jcomponent firstsecond) const {
+  const std::size_t T = xs.size();
+  if (dxs.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "dxs has wrong dimension (it should be " + std::to_string(T) + ")");
+  }
+  if (Jins.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "Jins has wrong dimension (it should be " + std::to_string(T) + ")");
+  }
+  for (std::size_t i = 0; i < T; ++i) {
+    JintegrateTransport(xs[i], dxs[i], Jins[i], firstsecond);
+  }
+}
+
 template <typename Scalar>
 typename MathBaseTpl<Scalar>::VectorXs StateAbstractTpl<Scalar>::diff_dx(const Eigen::Ref<const VectorXs>& x0,
                                                                          const Eigen::Ref<const VectorXs>& x1) {
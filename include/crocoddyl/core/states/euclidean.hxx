@@ -145,4 +145,59 @@ void StateVectorTpl<Scalar>::JintegrateTransport(const Eigen::Ref<const VectorXs
   }
 }
 
+template <typename Scalar>
+void StateVectorTpl<Scalar>::diffTrajectory(const std::vector<VectorXs>& x0s, const std::vector<VectorXs>& x1s,
+                                            std::vector<VectorXs>& dxouts) const {
+  const std::size_t T = x0s.size();
+  if (x1s.size() != T || dxouts.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "x1s and dxouts have wrong dimension (they should be " + std::to_string(T) + ")");
+  }
+  for (std::size_t i = 0; i < T; ++i) {
+    if (static_cast<std::size_t>(x0s[i].size()) != nx_ || static_cast<std::size_t>(x1s[i].size()) != nx_ ||
+        static_cast<std::size_t>(dxouts[i].size()) != ndx_) {
+      throw_pretty("Invalid argument: "
+                   << "node " + std::to_string(i) + " has wrong dimension (it should be " + std::to_string(nx_) +
+                          ")");
+    }
+    dxouts[i].noalias() = x1s[i] - x0s[i];
+  }
+}
+
+template <typename Scalar>
+void StateVectorTpl<Scalar>::integrateTrajectory(const std::vector<VectorXs>& xs, const std::vector<VectorXs>& dxs,
+                                                 std::vector<VectorXs>& xouts) const {
+  const std::size_t T = xs.size();
+  if (dxs.size() != T || xouts.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "dxs and xouts have wrong dimension (they should be " + std::to_string(T) + ")");
+  }
+  for (std::size_t i = 0; i < T; ++i) {
+    if (static_cast<std::size_t>(xs[i].size()) != nx_ || static_cast<std::size_t>(dxs[i].size()) != ndx_ ||
+        static_cast<std::size_t>(xouts[i].size()) != nx_) {
+      throw_pretty("Invalid argument: "
+                   << "node " + std::to_string(i) + " has wrong dimension (it should be " + std::to_string(nx_) +
+                          ")");
+    }
+    xouts[i].noalias() = xs[i] + dxs[i];
+  }
+}
+
+template <typename Scalar>
+void StateVectorTpl<Scalar>::JintegrateTransportTrajectory(const std::vector<VectorXs>& xs,
+                                                           const std::vector<VectorXs>& dxs,
+                                                           std::vector<MatrixXs>& Jins,
+                                                           const Jcomponent firstsecond) const {
+  assert_pretty(is_a_Jcomponent(firstsecond), (""));
+  if (firstsecond != first && firstsecond != second) {
+    throw_pretty(
+        "Invalid argument: firstsecond must be either first or second. both not supported for this operation.");
+  }
+  if (dxs.size() != xs.size() || Jins.size() != xs.size()) {
+    throw_pretty("Invalid argument: "
+                 << "dxs and Jins have wrong dimension (they should be " + std::to_string(xs.size()) + ")");
+  }
+  // The parallel transport is the identity in the Euclidean space
+}
+
 }  // namespace crocoddyl
@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2020, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_UTILS_ASYNC_HPP_
+#define CROCODDYL_CORE_UTILS_ASYNC_HPP_
+
+#include <future>
+#include <boost/function.hpp>
+
+#include "crocoddyl/core/solver-base.hpp"
+#include "crocoddyl/core/utils/callbacks.hpp"
+#include "crocoddyl/core/utils/cancellation.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Executor that runs the asynchronous solves
+ *
+ * It receives the task of a solve and has to run it once, e.g. in a thread pool or in a dedicated thread.
+ */
+typedef boost::function<void(const boost::function<void()>&)> SolverExecutor;
+
+/**
+ * @brief Run a task in a new detached thread (default executor of `solveAsync()`)
+ *
+ * @param[in] task  task to run
+ */
+void runInNewThread(const boost::function<void()>& task);
+
+/**
+ * @brief Handle of an asynchronous solve
+ *
+ * It is a future-like handle returned by `solveAsync()`. It allows us to wait for the result, cancel the solve and
+ * read its progress (iteration, cost and stopping value) without locking. The solver must not be used by other
+ * threads until the solve has finished (see `is_ready()`).
+ */
+class SolveHandle {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /**
+   * @brief Initialize the handle of a solve
+   *
+   * @param[in] solver      solver to run
+   * @param[in] init_xs     initial guess for state trajectory
+   * @param[in] init_us     initial guess for control trajectory
+   * @param[in] maxiter     maximum allowed number of iterations
+   * @param[in] is_feasible true if the \p init_xs are obtained from integrating the \p init_us
+   * @param[in] reg_init    initial guess for the regularization value
+   */
+  SolveHandle(boost::shared_ptr<SolverAbstract> solver, const std::vector<Eigen::VectorXd>& init_xs,
+              const std::vector<Eigen::VectorXd>& init_us, const std::size_t& maxiter, const bool& is_feasible,
+              const double& reg_init);
+  ~SolveHandle();
+
+  /**
+   * @brief Run the solve in the calling thread
+   *
+   * The executor calls it once. The cancellation token and the progress callback are attached to the solver only
+   * during the solve.
+   */
+  void run();
+
+  /**
+   * @brief Request the cancellation of the solve
+   *
+   * The solver stops at the next iteration or line-search trial, and `get()` returns false.
+   */
+  void cancel();
+
+  /**
+   * @brief Return true if the solve has finished
+   */
+  bool is_ready() const;
+
+  /**
+   * @brief Wait until the solve has finished
+   */
+  void wait() const;
+
+  /**
+   * @brief Wait until the solve has finished or the timeout has expired
+   *
+   * @param[in] timeout  timeout in milliseconds
+   * @return true if the solve has finished
+   */
+  bool wait_for(const double& timeout) const;
+
+  /**
+   * @brief Wait and return the result of `SolverAbstract::solve()`, or rethrow its exception
+   */
+  bool get() const;
+
+  /**
+   * @brief Return true if the cancellation was requested
+   */
+  bool is_cancelled() const;
+
+  /**
+   * @brief Return the solver
+   */
+  const boost::shared_ptr<SolverAbstract>& get_solver() const;
+
+  /**
+   * @brief Return the progress of the solve, which can be read while it runs
+   */
+  const boost::shared_ptr<CallbackProgress>& get_progress() const;
+
+ private:
+  boost::shared_ptr<SolverAbstract> solver_;
+  std::vector<Eigen::VectorXd> init_xs_;
+  std::vector<Eigen::VectorXd> init_us_;
+  std::size_t maxiter_;
+  bool is_feasible_;
+  double reg_init_;
+  boost::shared_ptr<CancellationToken> token_;
+  boost::shared_ptr<CallbackProgress> progress_;
+  std::promise<bool> promise_;
+  std::shared_future<bool> result_;
+};
+
+/**
+ * @brief Run `SolverAbstract::solve()` in the given executor
+ *
+ * @param[in] solver      solver to run
+ * @param[in] init_xs     initial guess for state trajectory with \f$T+1\f$ elements (default [])
+ * @param[in] init_us     initial guess for control trajectory with \f$T\f$ elements (default [])
+ * @param[in] maxiter     maximum allowed number of iterations (default 100)
+ * @param[in] is_feasible true if the \p init_xs are obtained from integrating the \p init_us (default false)
+ * @param[in] reg_init    initial guess for the regularization value (default 1e-9)
+ * @param[in] executor    executor that runs the solve (default `runInNewThread()`)
+ * @return the handle of the solve
+ */
+boost::shared_ptr<SolveHandle> solveAsync(boost::shared_ptr<SolverAbstract> solver,
+                                          const std::vector<Eigen::VectorXd>& init_xs = DEFAULT_VECTOR,
+                                          const std::vector<Eigen::VectorXd>& init_us = DEFAULT_VECTOR,
+                                          const std::size_t& maxiter = 100, const bool& is_feasible = false,
+                                          const double& reg_init = 1e-9,
+                                          const SolverExecutor& executor = runInNewThread);
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_UTILS_ASYNC_HPP_
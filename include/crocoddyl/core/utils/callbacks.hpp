@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <atomic>
 
 #include "crocoddyl/core/solver-base.hpp"
 
@@ -28,6 +29,45 @@ class CallbackVerbose : public CallbackAbstract {
   VerboseLevel level;
 };
 
+/**
+ * @brief Callback that publishes the progress of the solver
+ *
+ * It stores the iteration, cost and stopping value of the last iteration in atomic variables. Therefore, another
+ * thread (e.g. a supervisor of an asynchronous solve) can read them while the solver runs, without locking.
+ */
+class CallbackProgress : public CallbackAbstract {
+ public:
+  CallbackProgress();
+  ~CallbackProgress();
+
+  virtual void operator()(SolverAbstract& solver);
+
+  /**
+   * @brief Clear the published progress
+   */
+  void reset();
+
+  /**
+   * @brief Return the number of completed iterations
+   */
+  std::size_t get_iter() const;
+
+  /**
+   * @brief Return the total cost of the last iteration
+   */
+  double get_cost() const;
+
+  /**
+   * @brief Return the stopping value of the last iteration
+   */
+  double get_stop() const;
+
+ private:
+  std::atomic<std::size_t> iter_;
+  std::atomic<double> cost_;
+  std::atomic<double> stop_;
+};
+
 }  // namespace crocoddyl
 
 #endif  // CROCODDYL_CORE_UTILS_CALLBACKS_HPP_
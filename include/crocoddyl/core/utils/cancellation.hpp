@@ -0,0 +1,48 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2020, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_UTILS_CANCELLATION_HPP_
+#define CROCODDYL_CORE_UTILS_CANCELLATION_HPP_
+
+#include <atomic>
+
+namespace crocoddyl {
+
+/**
+ * @brief Flag used to cooperatively cancel a running solve
+ *
+ * Any thread can request the cancellation, and the solvers check the flag between iterations and between
+ * line-search trials (see `SolverAbstract::set_cancellation_token()`). A cancelled solve returns false and keeps its
+ * last accepted iterate.
+ */
+class CancellationToken {
+ public:
+  CancellationToken() : cancelled_(false) {}
+
+  /**
+   * @brief Request the cancellation
+   */
+  inline void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+
+  /**
+   * @brief Clear a previous cancellation request
+   */
+  inline void reset() { cancelled_.store(false, std::memory_order_relaxed); }
+
+  /**
+   * @brief Return true if the cancellation was requested
+   */
+  inline bool is_cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<bool> cancelled_;
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_UTILS_CANCELLATION_HPP_
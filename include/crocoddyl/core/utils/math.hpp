@@ -53,4 +53,47 @@ MatrixLike pseudoInverse(const Eigen::MatrixBase<MatrixLike>& a,
   return pseudoInverseAlgo<MatrixLike>::run(a, epsilon);
 }
 
+template <typename MatrixLike, bool value = boost::is_floating_point<typename MatrixLike::Scalar>::value>
+struct minimumNormSolveAlgo {
+  typedef typename MatrixLike::RealScalar RealScalar;
+
+  template <typename RhsType, typename DstType>
+  static void run(const Eigen::MatrixBase<MatrixLike>& a, const Eigen::MatrixBase<RhsType>& b,
+                  const Eigen::MatrixBase<DstType>& x, const RealScalar& epsilon) {
+    using std::max;
+    Eigen::CompleteOrthogonalDecomposition<typename MatrixLike::PlainObject> cod(a.rows(), a.cols());
+    cod.setThreshold(epsilon * static_cast<RealScalar>(max(a.cols(), a.rows())));
+    cod.compute(a);
+    const_cast<Eigen::MatrixBase<DstType>&>(x) = cod.solve(b);
+  }
+};
+
+template <typename MatrixLike>
+struct minimumNormSolveAlgo<MatrixLike, false> {
+  typedef typename MatrixLike::RealScalar RealScalar;
+
+  template <typename RhsType, typename DstType>
+  static void run(const Eigen::MatrixBase<MatrixLike>&, const Eigen::MatrixBase<RhsType>&,
+                  const Eigen::MatrixBase<DstType>& x, const RealScalar&) {
+    const_cast<Eigen::MatrixBase<DstType>&>(x).setZero();
+  }
+};
+
+/**
+ * @brief Compute the minimum-norm least-squares solution of \f$\mathbf{A}\mathbf{x}=\mathbf{b}\f$
+ *
+ * It computes the solution of `pseudoInverse(a) * b` with a complete orthogonal decomposition instead of an SVD,
+ * and it does not form the pseudo-inverse matrix. The rank tolerance scales `epsilon` as in `pseudoInverse()`, but
+ * it is compared against the pivots of the column-pivoting QR, not against the singular values. Hence, it only
+ * approximates the rank decision of `pseudoInverse()`, and both solutions can differ for nearly rank-deficient
+ * matrices.
+ */
+template <typename MatrixLike, typename RhsType, typename DstType>
+void minimumNormSolve(const Eigen::MatrixBase<MatrixLike>& a, const Eigen::MatrixBase<RhsType>& b,
+                      const Eigen::MatrixBase<DstType>& x,
+                      const typename MatrixLike::RealScalar& epsilon =
+                          Eigen::NumTraits<typename MatrixLike::Scalar>::dummy_precision()) {
+  minimumNormSolveAlgo<MatrixLike>::run(a, b, x, epsilon);
+}
+
 #endif  // CROCODDYL_CORE_UTILS_MATH_HPP_
@@ -0,0 +1,189 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2020, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_UTILS_PORTFOLIO_HPP_
+#define CROCODDYL_CORE_UTILS_PORTFOLIO_HPP_
+
+#include <limits>
+#include <boost/function.hpp>
+#include <boost/make_shared.hpp>
+
+#include "crocoddyl/core/utils/async.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Factory of a portfolio solver given its (cloned) shooting problem
+ */
+typedef boost::function<boost::shared_ptr<SolverAbstract>(boost::shared_ptr<ShootingProblem>)> SolverFactory;
+
+/**
+ * @brief Warm start of a portfolio solver
+ *
+ * `WarmStartGuess` uses the guess passed to `SolverPortfolio::solve()`, `WarmStartPrevious` the best solution of the
+ * previous portfolio solve (or the guess in the first solve), `WarmStartQuasiStatic` the quasi-static controls of
+ * the guessed states, and `WarmStartRollout` the rollout of the guessed controls. Without guessed states,
+ * `WarmStartQuasiStatic` uses the initial state, or the zero state of the nodes whose state has another dimension.
+ */
+enum PortfolioWarmStart { WarmStartGuess = 0, WarmStartPrevious, WarmStartQuasiStatic, WarmStartRollout };
+
+/**
+ * @brief Portfolio of solvers racing on the same optimal control problem
+ *
+ * The best solver, regularization and warm start differ from instance to instance on hard problems. This front-end
+ * runs several configured solvers in parallel, each on its own clone of the problem (see
+ * `ShootingProblemTpl::clone()`). It returns as soon as one of them converges, or after the deadline, and cancels
+ * the rest (see `solveAsync()`). The solution of the converged solver, or otherwise the best one, is kept in
+ * `get_xs()` and `get_us()`.
+ *
+ * The clones copy the initial state of the problem at each solve. Any other change of the problem requires calling
+ * `updateProblems()`.
+ */
+class SolverPortfolio {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /**
+   * @brief Initialize the portfolio
+   *
+   * @param[in] problem   shooting problem
+   * @param[in] executor  executor that runs the solves (default `runInNewThread()`)
+   */
+  explicit SolverPortfolio(boost::shared_ptr<ShootingProblem> problem,
+                           const SolverExecutor& executor = runInNewThread);
+  ~SolverPortfolio();
+
+  /**
+   * @brief Add a solver to the portfolio
+   *
+   * The solver is created from a clone of the problem, and it can be further configured (e.g. its regularization
+   * bounds or thresholds) through `get_solvers()`.
+   *
+   * @param[in] factory    factory of the solver
+   * @param[in] warmstart  warm start of the solver (default `WarmStartGuess`)
+   * @param[in] reg_init   initial guess for the regularization value (default 1e-9)
+   * @return the index of the solver in the portfolio
+   */
+  std::size_t addSolver(const SolverFactory& factory, const PortfolioWarmStart warmstart = WarmStartGuess,
+                        const double& reg_init = 1e-9);
+
+  /**
+   * @copybrief addSolver
+   *
+   * @tparam Solver  solver type constructed from the cloned problem
+   */
+  template <typename Solver>
+  std::size_t addSolver(const PortfolioWarmStart warmstart = WarmStartGuess, const double& reg_init = 1e-9) {
+    return addSolver(&createSolver<Solver>, warmstart, reg_init);
+  }
+
+  /**
+   * @brief Clone the problem again and recreate the solvers
+   *
+   * The configuration done through `get_solvers()` is lost.
+   */
+  void updateProblems();
+
+  /**
+   * @brief Race the solvers of the portfolio
+   *
+   * @param[in] init_xs   guess of the state trajectory with \f$T+1\f$ elements (default [])
+   * @param[in] init_us   guess of the control trajectory with \f$T\f$ elements (default [])
+   * @param[in] maxiter   maximum allowed number of iterations of each solver (default 100)
+   * @param[in] deadline  maximum time in milliseconds before cancelling the solvers (default infinity)
+   * @return true if one of the solvers has converged
+   */
+  bool solve(const std::vector<Eigen::VectorXd>& init_xs = DEFAULT_VECTOR,
+             const std::vector<Eigen::VectorXd>& init_us = DEFAULT_VECTOR, const std::size_t& maxiter = 100,
+             const double& deadline = std::numeric_limits<double>::infinity());
+
+  /**
+   * @brief Return the shooting problem
+   */
+  const boost::shared_ptr<ShootingProblem>& get_problem() const;
+
+  /**
+   * @brief Return the solvers of the portfolio
+   */
+  const std::vector<boost::shared_ptr<SolverAbstract> >& get_solvers() const;
+
+  /**
+   * @brief Return the warm starts of the solvers
+   */
+  const std::vector<PortfolioWarmStart>& get_warmstarts() const;
+
+  /**
+   * @brief Return the handles of the last solve
+   */
+  const std::vector<boost::shared_ptr<SolveHandle> >& get_handles() const;
+
+  /**
+   * @brief Return the index of the converged (or best) solver of the last solve
+   */
+  std::size_t get_best() const;
+
+  /**
+   * @brief Return the converged (or best) solver of the last solve
+   */
+  const boost::shared_ptr<SolverAbstract>& get_best_solver() const;
+
+  /**
+   * @brief Return the state trajectory of the best solver
+   */
+  const std::vector<Eigen::VectorXd>& get_xs() const;
+
+  /**
+   * @brief Return the control trajectory of the best solver
+   */
+  const std::vector<Eigen::VectorXd>& get_us() const;
+
+  /**
+   * @brief Return the executor that runs the solves
+   */
+  const SolverExecutor& get_executor() const;
+
+  /**
+   * @brief Modify the executor that runs the solves
+   */
+  void set_executor(const SolverExecutor& executor);
+
+ private:
+  template <typename Solver>
+  static boost::shared_ptr<SolverAbstract> createSolver(boost::shared_ptr<ShootingProblem> problem) {
+    return boost::make_shared<Solver>(problem);
+  }
+
+  /**
+   * @brief Compute the warm start of a solver
+   *
+   * @param[in] i        index of the solver
+   * @param[in] init_xs  guess of the state trajectory
+   * @param[in] init_us  guess of the control trajectory
+   * @param[out] xs      warm-start state trajectory
+   * @param[out] us      warm-start control trajectory
+   * @return true if the warm start is feasible
+   */
+  bool computeWarmStart(const std::size_t& i, const std::vector<Eigen::VectorXd>& init_xs,
+                        const std::vector<Eigen::VectorXd>& init_us, std::vector<Eigen::VectorXd>& xs,
+                        std::vector<Eigen::VectorXd>& us);
+
+  boost::shared_ptr<ShootingProblem> problem_;                //!< Shooting problem
+  SolverExecutor executor_;                                   //!< Executor that runs the solves
+  std::vector<SolverFactory> factories_;                      //!< Factories of the solvers
+  std::vector<PortfolioWarmStart> warmstarts_;                //!< Warm starts of the solvers
+  std::vector<double> reg_inits_;                             //!< Initial regularization values of the solvers
+  std::vector<boost::shared_ptr<SolverAbstract> > solvers_;   //!< Solvers, each one with a clone of the problem
+  std::vector<boost::shared_ptr<SolveHandle> > handles_;      //!< Handles of the last solve
+  std::size_t best_;                                          //!< Index of the best solver of the last solve
+  std::vector<Eigen::VectorXd> xs_;                           //!< State trajectory of the best solver
+  std::vector<Eigen::VectorXd> us_;                           //!< Control trajectory of the best solver
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_UTILS_PORTFOLIO_HPP_
@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_MULTIBODY_ACTIONS_CENTROIDAL_FWDDYN_HPP_
+#define CROCODDYL_MULTIBODY_ACTIONS_CENTROIDAL_FWDDYN_HPP_
+
+#include "crocoddyl/multibody/fwd.hpp"
+#include "crocoddyl/core/diff-action-base.hpp"
+#include "crocoddyl/core/costs/cost-sum.hpp"
+#include "crocoddyl/core/data-collector-base.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Differential action model for the centroidal (single-rigid-body) dynamics
+ *
+ * This reduced-order model describes the motion of the center of mass (CoM) and of the aggregated orientation of a
+ * legged robot under the contact forces applied at a set of fixed contact points. The state is defined as
+ * \f$\mathbf{x}=(\mathbf{c},\boldsymbol{\theta},\dot{\mathbf{c}},\boldsymbol{\omega})\in\mathbb{R}^{12}\f$, and the
+ * control input stacks the 3d contact forces \f$\mathbf{u}=(\mathbf{f}_1,\cdots,\mathbf{f}_{nc})\f$. The dynamics
+ * \f{eqnarray*}
+ *   \ddot{\mathbf{c}} &=& \mathbf{g} + \frac{1}{m}\sum_{i=1}^{nc}\mathbf{f}_i,\\
+ *   \dot{\boldsymbol{\omega}} &=& \mathbf{I}^{-1}\sum_{i=1}^{nc}(\mathbf{p}_i-\mathbf{c})\times\mathbf{f}_i,
+ * \f}
+ * assume a constant centroidal inertia \f$\mathbf{I}\f$ expressed in the world frame and neglect the gyroscopic
+ * term, i.e. the rate of the angular momentum equals the contact torques about the CoM. Its cost and derivatives
+ * are analytical and require only a few 3x3 operations per contact, which makes it suitable for long-horizon
+ * planning. The contact positions \f$\mathbf{p}_i\f$ are parameters of each node, so a contact sequence is described
+ * with one model per contact phase.
+ *
+ * The cost functions are described by a `CostModelSumTpl`, e.g. with `CostModelCentroidalCoMPositionTpl`,
+ * `CostModelCentroidalContactForceTpl` and `CostModelCentroidalFrictionConeTpl`.
+ *
+ * \sa `DifferentialActionModelAbstractTpl`, `calc()`, `calcDiff()`, `createData()`
+ */
+template <typename _Scalar>
+class DifferentialActionModelCentroidalFwdDynamicsTpl : public DifferentialActionModelAbstractTpl<_Scalar> {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef DifferentialActionModelAbstractTpl<Scalar> Base;
+  typedef DifferentialActionDataCentroidalFwdDynamicsTpl<Scalar> Data;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef CostModelSumTpl<Scalar> CostModelSum;
+  typedef StateAbstractTpl<Scalar> StateAbstract;
+  typedef DifferentialActionDataAbstractTpl<Scalar> DifferentialActionDataAbstract;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXs MatrixXs;
+  typedef typename MathBase::Vector3s Vector3s;
+  typedef typename MathBase::Matrix3s Matrix3s;
+  typedef typename MathBase::Matrix3xs Matrix3xs;
+
+  /**
+   * @brief Initialize the centroidal forward-dynamics action model
+   *
+   * @param[in] state     State of the centroidal system (12-dimensional Euclidean state)
+   * @param[in] mass      Total mass of the robot
+   * @param[in] inertia   Centroidal inertia expressed in the world frame
+   * @param[in] contacts  Positions of the contact points (one column per contact)
+   * @param[in] costs     Stack of cost functions
+   */
+  DifferentialActionModelCentroidalFwdDynamicsTpl(boost::shared_ptr<StateAbstract> state, const Scalar& mass,
+                                                  const Matrix3s& inertia, const Matrix3xs& contacts,
+                                                  boost::shared_ptr<CostModelSum> costs);
+  virtual ~DifferentialActionModelCentroidalFwdDynamicsTpl();
+
+  virtual void calc(const boost::shared_ptr<DifferentialActionDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                    const Eigen::Ref<const VectorXs>& u);
+  virtual void calcDiff(const boost::shared_ptr<DifferentialActionDataAbstract>& data,
+                        const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u);
+  virtual boost::shared_ptr<DifferentialActionDataAbstract> createData();
+  virtual void copyNodeParameters(const boost::shared_ptr<DifferentialActionDataAbstract>& from,
+                                  const boost::shared_ptr<DifferentialActionDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<DifferentialActionDataAbstract>& data) const;
+  virtual bool checkData(const boost::shared_ptr<DifferentialActionDataAbstract>& data);
+  virtual boost::shared_ptr<Base> clone() const;
+
+  /**
+   * @brief Computes the contact forces that keep the CoM at rest with the minimum norm
+   */
+  virtual void quasiStatic(const boost::shared_ptr<DifferentialActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
+                           const Eigen::Ref<const VectorXs>& x, const std::size_t& maxiter = 100,
+                           const Scalar& tol = Scalar(1e-9));
+
+  const boost::shared_ptr<CostModelSum>& get_costs() const;
+  const Scalar& get_mass() const;
+  const Matrix3s& get_inertia() const;
+  const Vector3s& get_gravity() const;
+  const Matrix3xs& get_contacts() const;
+  std::size_t get_nc() const;
+
+  void set_gravity(const Vector3s& gravity);
+  void set_contacts(const Matrix3xs& contacts);
+
+ protected:
+  using Base::has_control_limits_;  //!< Indicates whether any of the control limits
+  using Base::nr_;                  //!< Dimension of the cost residual
+  using Base::nu_;                  //!< Control dimension
+  using Base::state_;               //!< Model of the state
+  using Base::u_lb_;                //!< Lower control limits
+  using Base::u_ub_;                //!< Upper control limits
+  using Base::unone_;               //!< Neutral state
+
+ private:
+  boost::shared_ptr<CostModelSum> costs_;
+  Scalar mass_;
+  Matrix3s inertia_;
+  Matrix3s inertia_inv_;
+  Vector3s gravity_;
+  Matrix3xs contacts_;
+};
+
+template <typename _Scalar>
+struct DifferentialActionDataCentroidalFwdDynamicsTpl : public DifferentialActionDataAbstractTpl<_Scalar> {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef DifferentialActionDataAbstractTpl<Scalar> Base;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXs MatrixXs;
+  typedef typename MathBase::Vector3s Vector3s;
+  typedef typename MathBase::Matrix3s Matrix3s;
+  typedef typename MathBase::Matrix3xs Matrix3xs;
+
+  template <template <typename Scalar> class Model>
+  explicit DifferentialActionDataCentroidalFwdDynamicsTpl(Model<Scalar>* const model)
+      : Base(model),
+        costs(model->get_costs()->createData(&shared)),
+        lever(3, model->get_nc()),
+        force(Vector3s::Zero()),
+        torque(Vector3s::Zero()),
+        Astatic(6, model->get_nu()),
+        bstatic(VectorXs::Zero(6)) {
+    costs->shareMemory(this);
+    lever.setZero();
+    Astatic.setZero();
+  }
+
+  DataCollectorAbstractTpl<Scalar> shared;
+  boost::shared_ptr<CostDataSumTpl<Scalar> > costs;
+  Matrix3xs lever;    //!< Contact positions with respect to the CoM
+  Vector3s force;     //!< Total contact force
+  Vector3s torque;    //!< Total contact torque about the CoM
+  MatrixXs Astatic;   //!< Centroidal wrench map used in the quasi-static computation
+  VectorXs bstatic;   //!< Centroidal wrench used in the quasi-static computation
+
+  using Base::cost;
+  using Base::Fu;
+  using Base::Fx;
+  using Base::Lu;
+  using Base::Luu;
+  using Base::Lx;
+  using Base::Lxu;
+  using Base::Lxx;
+  using Base::r;
+  using Base::xout;
+};
+
+}  // namespace crocoddyl
+
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+#include <crocoddyl/multibody/actions/centroidal-fwddyn.hxx>
+
+#endif  // CROCODDYL_MULTIBODY_ACTIONS_CENTROIDAL_FWDDYN_HPP_
@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/utils/exception.hpp"
+#include "crocoddyl/core/utils/math.hpp"
+#include "crocoddyl/multibody/actions/centroidal-fwddyn.hpp"
+
+namespace crocoddyl {
+
+template <typename Scalar>
+DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::DifferentialActionModelCentroidalFwdDynamicsTpl(
+    boost::shared_ptr<StateAbstract> state, const Scalar& mass, const Matrix3s& inertia, const Matrix3xs& contacts,
+    boost::shared_ptr<CostModelSum> costs)
+    : Base(state, 3 * contacts.cols(), costs->get_nr()),
+      costs_(costs),
+      mass_(mass),
+      inertia_(inertia),
+      inertia_inv_(inertia.inverse()),
+      gravity_(Scalar(0.), Scalar(0.), Scalar(-9.81)),
+      contacts_(contacts) {
+  if (state_->get_nx() != 12 || state_->get_ndx() != 12) {
+    throw_pretty("Invalid argument: "
+                 << "the state dimension should be 12 (CoM position, orientation and their velocities)");
+  }
+  if (mass_ <= Scalar(0.)) {
+    throw_pretty("Invalid argument: "
+                 << "the mass should be positive");
+  }
+  if (costs_->get_nu() != nu_) {
+    throw_pretty("Invalid argument: "
+                 << "Costs doesn't have the same control dimension (it should be " + std::to_string(nu_) + ")");
+  }
+}
+
+template <typename Scalar>
+DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::~DifferentialActionModelCentroidalFwdDynamicsTpl() {}
+
+template <typename Scalar>
+void DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::calc(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+    const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty("Invalid argument: "
+                 << "x has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty("Invalid argument: "
+                 << "u has wrong dimension (it should be " + std::to_string(nu_) + ")");
+  }
+
+  Data* d = static_cast<Data*>(data.get());
+  const std::size_t nc = get_nc();
+
+  // Computing the total contact wrench about the CoM
+  d->lever = contacts_.colwise() - x.template head<3>();
+  d->force.setZero();
+  d->torque.setZero();
+  for (std::size_t i = 0; i < nc; ++i) {
+    const Eigen::VectorBlock<const Eigen::Ref<const VectorXs>, 3> f = u.template segment<3>(3 * i);
+    d->force += f;
+    d->torque += d->lever.col(i).cross(f);
+  }
+
+  // Computing the centroidal dynamics
+  d->xout.template head<3>() = gravity_ + d->force / mass_;
+  d->xout.template tail<3>().noalias() = inertia_inv_ * d->torque;
+
+  // Computing the cost value and residuals
+  costs_->calc(d->costs, x, u);
+  d->cost = d->costs->cost;
+}
+
+template <typename Scalar>
+void DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::calcDiff(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+    const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty("Invalid argument: "
+                 << "x has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty("Invalid argument: "
+                 << "u has wrong dimension (it should be " + std::to_string(nu_) + ")");
+  }
+
+  Data* d = static_cast<Data*>(data.get());
+  const std::size_t nc = get_nc();
+
+  // Computing the dynamics derivatives. Only the angular acceleration depends on the CoM position, through the
+  // lever arms of the contact forces, i.e. d(sum_i (p_i - c) x f_i)/dc = [F]x
+  Matrix3s skew;
+  skew << Scalar(0.), -d->force(2), d->force(1), d->force(2), Scalar(0.), -d->force(0), -d->force(1), d->force(0),
+      Scalar(0.);
+  d->Fx.template block<3, 3>(3, 0).noalias() = inertia_inv_ * skew;
+  for (std::size_t i = 0; i < nc; ++i) {
+    const Vector3s& r = d->lever.col(i);
+    skew << Scalar(0.), -r(2), r(1), r(2), Scalar(0.), -r(0), -r(1), r(0), Scalar(0.);
+    d->Fu.template block<3, 3>(0, 3 * i).diagonal().setConstant(Scalar(1.) / mass_);
+    d->Fu.template block<3, 3>(3, 3 * i).noalias() = inertia_inv_ * skew;
+  }
+
+  // Computing the cost derivatives
+  costs_->calcDiff(d->costs, x, u);
+}
+
+template <typename Scalar>
+boost::shared_ptr<DifferentialActionDataAbstractTpl<Scalar> >
+DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::createData() {
+  return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
+}
+
+template <typename Scalar>
+void DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::copyNodeParameters(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& from,
+    const boost::shared_ptr<DifferentialActionDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  costs_->copyNodeParameters(d_from->costs, d_to->costs);
+}
+
+template <typename Scalar>
+void DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::resetNodeParameters(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  costs_->resetNodeParameters(d->costs);
+}
+
+template <typename Scalar>
+bool DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::checkData(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& data) {
+  boost::shared_ptr<Data> d = boost::dynamic_pointer_cast<Data>(data);
+  if (d != NULL) {
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <typename Scalar>
+boost::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> >
+DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::clone() const {
+  boost::shared_ptr<DifferentialActionModelCentroidalFwdDynamicsTpl> model =
+      boost::allocate_shared<DifferentialActionModelCentroidalFwdDynamicsTpl>(
+          Eigen::aligned_allocator<DifferentialActionModelCentroidalFwdDynamicsTpl>(), *this);
+  model->costs_ = costs_->clone();
+  return model;
+}
+
+template <typename Scalar>
+void DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::quasiStatic(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
+    const Eigen::Ref<const VectorXs>& x, const std::size_t&, const Scalar&) {
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty("Invalid argument: "
+                 << "u has wrong dimension (it should be " + std::to_string(nu_) + ")");
+  }
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty("Invalid argument: "
+                 << "x has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
+  }
+  // Static casting the data
+  Data* d = static_cast<Data*>(data.get());
+  const std::size_t nc = get_nc();
+
+  // Check the velocity input is zero
+  assert_pretty(x.tail(state_->get_nv()).isZero(), "The velocity input should be zero for quasi-static to work.");
+
+  // Minimum-norm contact forces that compensate the gravity without producing torque about the CoM
+  d->lever = contacts_.colwise() - x.template head<3>();
+  for (std::size_t i = 0; i < nc; ++i) {
+    const Vector3s& r = d->lever.col(i);
+    d->Astatic.template block<3, 3>(0, 3 * i).setIdentity();
+    d->Astatic.template block<3, 3>(3, 3 * i) << Scalar(0.), -r(2), r(1), r(2), Scalar(0.), -r(0), -r(1), r(0),
+        Scalar(0.);
+  }
+  d->bstatic.template head<3>() = -mass_ * gravity_;
+  minimumNormSolve(d->Astatic, d->bstatic, u);
+}
+
+template <typename Scalar>
+const boost::shared_ptr<CostModelSumTpl<Scalar> >& DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::get_costs()
+    const {
+  return costs_;
+}
+
+template <typename Scalar>
+const Scalar& DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::get_mass() const {
+  return mass_;
+}
+
+template <typename Scalar>
+const typename MathBaseTpl<Scalar>::Matrix3s& DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::get_inertia()
+    const {
+  return inertia_;
+}
+
+template <typename Scalar>
+const typename MathBaseTpl<Scalar>::Vector3s& DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::get_gravity()
+    const {
+  return gravity_;
+}
+
+template <typename Scalar>
+const typename MathBaseTpl<Scalar>::Matrix3xs& DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::get_contacts()
+    const {
+  return contacts_;
+}
+
+template <typename Scalar>
+std::size_t DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::get_nc() const {
+  return static_cast<std::size_t>(contacts_.cols());
+}
+
+template <typename Scalar>
+void DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::set_gravity(const Vector3s& gravity) {
+  gravity_ = gravity;
+}
+
+template <typename Scalar>
+void DifferentialActionModelCentroidalFwdDynamicsTpl<Scalar>::set_contacts(const Matrix3xs& contacts) {
+  if (contacts.cols() != contacts_.cols()) {
+    throw_pretty("Invalid argument: "
+                 << "the number of contacts is wrong (it should be " + std::to_string(get_nc()) + ")");
+  }
+  contacts_ = contacts;
+}
+
+}  // namespace crocoddyl
@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_MULTIBODY_ACTIONS_CENTROIDAL_TRANSITION_HPP_
+#define CROCODDYL_MULTIBODY_ACTIONS_CENTROIDAL_TRANSITION_HPP_
+
+#include <stdexcept>
+
+#include "crocoddyl/multibody/fwd.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+#include "crocoddyl/core/action-base.hpp"
+#include "crocoddyl/multibody/states/multibody.hpp"
+
+#include <pinocchio/multibody/data.hpp>
+#include <pinocchio/algorithm/center-of-mass.hpp>
+#include <pinocchio/algorithm/centroidal.hpp>
+#include <pinocchio/algorithm/centroidal-derivatives.hpp>
+
+namespace crocoddyl {
+
+/**
+ * @brief Transition from the whole-body state to the centroidal state
+ *
+ * This action model maps the whole-body state \f$\mathbf{x}=(\mathbf{q},\mathbf{v})\f$ of a multibody system onto
+ * the state of the centroidal model, i.e.
+ * \f{eqnarray*}
+ *   \mathbf{c} &=& \mathbf{c}(\mathbf{q}),\\
+ *   \boldsymbol{\theta} &=& \mathbf{0},\\
+ *   \dot{\mathbf{c}} &=& \frac{1}{m}\mathbf{h}_{lin}(\mathbf{q},\mathbf{v}),\\
+ *   \boldsymbol{\omega} &=& \mathbf{I}^{-1}\mathbf{h}_{ang}(\mathbf{q},\mathbf{v}),
+ * \f}
+ * where \f$\mathbf{h}=(\mathbf{h}_{lin},\mathbf{h}_{ang})\f$ is the centroidal momentum and \f$\mathbf{I}\f$ is the
+ * constant centroidal inertia used by the centroidal model. The aggregated orientation has no whole-body
+ * counterpart, so the centroidal phase starts with zero orientation deviation. The next state and its Jacobian
+ * \f$\mathbf{F_x}\in\mathbb{R}^{12\times ndx}\f$ have the dimension of the centroidal state, and this node has
+ * neither controls nor cost. It allows us to chain whole-body and centroidal phases in a single `ShootingProblemTpl`.
+ *
+ * \sa `DifferentialActionModelCentroidalFwdDynamicsTpl`, `calc()`, `calcDiff()`, `createData()`
+ */
+template <typename _Scalar>
+class ActionModelCentroidalTransitionTpl : public ActionModelAbstractTpl<_Scalar> {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef ActionModelAbstractTpl<Scalar> Base;
+  typedef ActionDataCentroidalTransitionTpl<Scalar> Data;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef StateMultibodyTpl<Scalar> StateMultibody;
+  typedef ActionDataAbstractTpl<Scalar> ActionDataAbstract;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXs MatrixXs;
+  typedef typename MathBase::Matrix3s Matrix3s;
+
+  /**
+   * @brief Initialize the whole-body to centroidal transition
+   *
+   * @param[in] state    State of the multibody system
+   * @param[in] inertia  Centroidal inertia of the centroidal model, expressed in the world frame
+   */
+  ActionModelCentroidalTransitionTpl(boost::shared_ptr<StateMultibody> state, const Matrix3s& inertia);
+  virtual ~ActionModelCentroidalTransitionTpl();
+
+  virtual void calc(const boost::shared_ptr<ActionDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                    const Eigen::Ref<const VectorXs>& u);
+  virtual void calcDiff(const boost::shared_ptr<ActionDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                        const Eigen::Ref<const VectorXs>& u);
+  virtual boost::shared_ptr<ActionDataAbstract> createData();
+  virtual bool checkData(const boost::shared_ptr<ActionDataAbstract>& data);
+  virtual boost::shared_ptr<Base> clone() const;
+
+  pinocchio::ModelTpl<Scalar>& get_pinocchio() const;
+  const Scalar& get_mass() const;
+  const Matrix3s& get_inertia() const;
+
+  void set_inertia(const Matrix3s& inertia);
+
+ protected:
+  using Base::has_control_limits_;  //!< Indicates whether any of the control limits
+  using Base::nr_;                  //!< Dimension of the cost residual
+  using Base::nu_;                  //!< Control dimension
+  using Base::state_;               //!< Model of the state
+  using Base::u_lb_;                //!< Lower control limits
+  using Base::u_ub_;                //!< Upper control limits
+  using Base::unone_;               //!< Neutral state
+
+ private:
+  pinocchio::ModelTpl<Scalar>& pinocchio_;
+  Scalar mass_;
+  Matrix3s inertia_;
+  Matrix3s inertia_inv_;
+};
+
+template <typename _Scalar>
+struct ActionDataCentroidalTransitionTpl : public ActionDataAbstractTpl<_Scalar> {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef ActionDataAbstractTpl<Scalar> Base;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXs MatrixXs;
+  typedef typename MathBase::Matrix6xs Matrix6xs;
+
+  template <template <typename Scalar> class Model>
+  explicit ActionDataCentroidalTransitionTpl(Model<Scalar>* const model)
+      : Base(model),
+        pinocchio(pinocchio::DataTpl<Scalar>(model->get_pinocchio())),
+        vnone(VectorXs::Zero(model->get_state()->get_nv())),
+        dh_dq(6, model->get_state()->get_nv()),
+        dhd_dq(6, model->get_state()->get_nv()),
+        dhd_dv(6, model->get_state()->get_nv()),
+        dh_dv(6, model->get_state()->get_nv()) {
+    // The next state lives in the centroidal state space
+    const std::size_t& ndx = model->get_state()->get_ndx();
+    xnext = VectorXs::Zero(12);
+    Fx = MatrixXs::Zero(12, ndx);
+    Fu = MatrixXs::Zero(12, model->get_nu());
+    dh_dq.setZero();
+    dhd_dq.setZero();
+    dhd_dv.setZero();
+    dh_dv.setZero();
+  }
+
+  pinocchio::DataTpl<Scalar> pinocchio;
+  VectorXs vnone;
+  Matrix6xs dh_dq;
+  Matrix6xs dhd_dq;
+  Matrix6xs dhd_dv;
+  Matrix6xs dh_dv;
+
+  using Base::Fu;
+  using Base::Fx;
+  using Base::xnext;
+};
+
+}  // namespace crocoddyl
+
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+#include <crocoddyl/multibody/actions/centroidal-transition.hxx>
+
+#endif  // CROCODDYL_MULTIBODY_ACTIONS_CENTROIDAL_TRANSITION_HPP_
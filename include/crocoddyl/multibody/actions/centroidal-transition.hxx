@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace crocoddyl {
+
+template <typename Scalar>
+ActionModelCentroidalTransitionTpl<Scalar>::ActionModelCentroidalTransitionTpl(
+    boost::shared_ptr<StateMultibody> state, const Matrix3s& inertia)
+    : Base(state, 0, 0),
+      pinocchio_(*state->get_pinocchio().get()),
+      mass_(pinocchio::computeTotalMass(*state->get_pinocchio().get())),
+      inertia_(inertia),
+      inertia_inv_(inertia.inverse()) {
+  if (mass_ <= Scalar(0.)) {
+    throw_pretty("Invalid argument: "
+                 << "the total mass of the multibody system should be positive");
+  }
+}
+
+template <typename Scalar>
+ActionModelCentroidalTransitionTpl<Scalar>::~ActionModelCentroidalTransitionTpl() {}
+
+template <typename Scalar>
+void ActionModelCentroidalTransitionTpl<Scalar>::calc(const boost::shared_ptr<ActionDataAbstract>& data,
+                                                      const Eigen::Ref<const VectorXs>& x,
+                                                      const Eigen::Ref<const VectorXs>&) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty("Invalid argument: "
+                 << "x has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
+  }
+
+  const std::size_t& nq = state_->get_nq();
+  const std::size_t& nv = state_->get_nv();
+  Data* d = static_cast<Data*>(data.get());
+  const Eigen::VectorBlock<const Eigen::Ref<const VectorXs>, Eigen::Dynamic> q = x.head(nq);
+  const Eigen::VectorBlock<const Eigen::Ref<const VectorXs>, Eigen::Dynamic> v = x.tail(nv);
+
+  // Computing the CoM and the centroidal momentum, which define the centroidal state
+  pinocchio::computeCentroidalMomentum(pinocchio_, d->pinocchio, q, v);
+  d->xnext.template head<3>() = d->pinocchio.com[0];
+  d->xnext.template segment<3>(3).setZero();
+  d->xnext.template segment<3>(6) = d->pinocchio.hg.linear() / mass_;
+  d->xnext.template tail<3>().noalias() = inertia_inv_ * d->pinocchio.hg.angular();
+  d->cost = Scalar(0.);
+}
+
+template <typename Scalar>
+void ActionModelCentroidalTransitionTpl<Scalar>::calcDiff(const boost::shared_ptr<ActionDataAbstract>& data,
+                                                          const Eigen::Ref<const VectorXs>& x,
+                                                          const Eigen::Ref<const VectorXs>&) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty("Invalid argument: "
+                 << "x has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
+  }
+
+  const std::size_t& nq = state_->get_nq();
+  const std::size_t& nv = state_->get_nv();
+  Data* d = static_cast<Data*>(data.get());
+  const Eigen::VectorBlock<const Eigen::Ref<const VectorXs>, Eigen::Dynamic> q = x.head(nq);
+  const Eigen::VectorBlock<const Eigen::Ref<const VectorXs>, Eigen::Dynamic> v = x.tail(nv);
+
+  // The momentum rate at zero acceleration is not needed, but its derivative with respect to the acceleration is
+  // the centroidal momentum matrix, i.e. the derivative of the momentum with respect to the velocity
+  pinocchio::computeCentroidalDynamicsDerivatives(pinocchio_, d->pinocchio, q, v, d->vnone, d->dh_dq, d->dhd_dq,
+                                                  d->dhd_dv, d->dh_dv);
+
+  // The derivative computation in pinocchio does not take the frame of reference into
+  // account. So we need to update the com frame as well.
+  const Scalar inv_mass = Scalar(1.) / mass_;
+  for (std::size_t i = 0; i < nv; ++i) {
+    d->dh_dq.template block<3, 1>(3, i) -=
+        inv_mass * d->dh_dv.template block<3, 1>(0, i).cross(d->pinocchio.hg.linear());
+  }
+
+  d->Fx.topLeftCorner(3, nv) = inv_mass * d->dh_dv.template topRows<3>();
+  d->Fx.block(6, 0, 3, nv) = inv_mass * d->dh_dq.template topRows<3>();
+  d->Fx.block(6, nv, 3, nv) = inv_mass * d->dh_dv.template topRows<3>();
+  d->Fx.block(9, 0, 3, nv).noalias() = inertia_inv_ * d->dh_dq.template bottomRows<3>();
+  d->Fx.block(9, nv, 3, nv).noalias() = inertia_inv_ * d->dh_dv.template bottomRows<3>();
+}
+
+template <typename Scalar>
+boost::shared_ptr<ActionDataAbstractTpl<Scalar> > ActionModelCentroidalTransitionTpl<Scalar>::createData() {
+  return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
+}
+
+template <typename Scalar>
+bool ActionModelCentroidalTransitionTpl<Scalar>::checkData(const boost::shared_ptr<ActionDataAbstract>& data) {
+  boost::shared_ptr<Data> d = boost::dynamic_pointer_cast<Data>(data);
+  if (d != NULL) {
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <typename Scalar>
+boost::shared_ptr<ActionModelAbstractTpl<Scalar> > ActionModelCentroidalTransitionTpl<Scalar>::clone() const {
+  return boost::allocate_shared<ActionModelCentroidalTransitionTpl>(
+      Eigen::aligned_allocator<ActionModelCentroidalTransitionTpl>(), *this);
+}
+
+template <typename Scalar>
+pinocchio::ModelTpl<Scalar>& ActionModelCentroidalTransitionTpl<Scalar>::get_pinocchio() const {
+  return pinocchio_;
+}
+
+template <typename Scalar>
+const Scalar& ActionModelCentroidalTransitionTpl<Scalar>::get_mass() const {
+  return mass_;
+}
+
+template <typename Scalar>
+const typename MathBaseTpl<Scalar>::Matrix3s& ActionModelCentroidalTransitionTpl<Scalar>::get_inertia() const {
+  return inertia_;
+}
+
+template <typename Scalar>
+void ActionModelCentroidalTransitionTpl<Scalar>::set_inertia(const Matrix3s& inertia) {
+  inertia_ = inertia;
+  inertia_inv_ = inertia.inverse();
+}
+
+}  // namespace crocoddyl
@@ -51,7 +51,11 @@ class DifferentialActionModelContactFwdDynamicsTpl : public DifferentialActionMo
   virtual void calcDiff(const boost::shared_ptr<DifferentialActionDataAbstract>& data,
                         const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u);
   virtual boost::shared_ptr<DifferentialActionDataAbstract> createData();
+  virtual void copyNodeParameters(const boost::shared_ptr<DifferentialActionDataAbstract>& from,
+                                  const boost::shared_ptr<DifferentialActionDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<DifferentialActionDataAbstract>& data) const;
   virtual bool checkData(const boost::shared_ptr<DifferentialActionDataAbstract>& data);
+  virtual boost::shared_ptr<Base> clone() const;
   virtual void quasiStatic(const boost::shared_ptr<DifferentialActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
                            const Eigen::Ref<const VectorXs>& x, const std::size_t& maxiter = 100,
                            const Scalar& tol = Scalar(1e-9));
@@ -106,13 +110,15 @@ struct DifferentialActionDataContactFwdDynamicsTpl : public DifferentialActionDa
         df_dx(model->get_contacts()->get_nc_total(), model->get_state()->get_ndx()),
         df_du(model->get_contacts()->get_nc_total(), model->get_nu()),
         tmp_xstatic(model->get_state()->get_nx()),
-        tmp_Jstatic(model->get_state()->get_nv(), model->get_nu() + model->get_contacts()->get_nc_total()) {
+        tmp_Jstatic(model->get_state()->get_nv(), model->get_nu() + model->get_contacts()->get_nc_total()),
+        tmp_ustatic(model->get_nu() + model->get_contacts()->get_nc_total()) {
     costs->shareMemory(this);
     Kinv.setZero();
     df_dx.setZero();
     df_du.setZero();
     tmp_xstatic.setZero();
     tmp_Jstatic.setZero();
+    tmp_ustatic.setZero();
     pinocchio.lambda_c.resize(model->get_contacts()->get_nc_total());
     pinocchio.lambda_c.setZero();
   }
@@ -125,6 +131,7 @@ struct DifferentialActionDataContactFwdDynamicsTpl : public DifferentialActionDa
   MatrixXs df_du;
   VectorXs tmp_xstatic;
   MatrixXs tmp_Jstatic;
+  VectorXs tmp_ustatic;
 
   using Base::cost;
   using Base::Fu;
@@ -142,7 +142,7 @@ void DifferentialActionModelContactFwdDynamicsTpl<Scalar>::calcDiff(
 
   d->Fx.leftCols(nv).noalias() = -a_partial_dtau * d->pinocchio.dtau_dq;
   d->Fx.rightCols(nv).noalias() = -a_partial_dtau * d->pinocchio.dtau_dv;
-  d->Fx.noalias() -= a_partial_da * d->multibody.contacts->da0_dx.topRows(nc);
+  contacts_->multiplyAccelerationDiff(d->multibody.contacts, a_partial_da, d->Fx, rmfrom);
   d->Fx.noalias() += a_partial_dtau * d->multibody.actuation->dtau_dx;
   d->Fu.noalias() = a_partial_dtau * d->multibody.actuation->dtau_du;
 
@@ -150,7 +150,7 @@ void DifferentialActionModelContactFwdDynamicsTpl<Scalar>::calcDiff(
   if (enable_force_) {
     d->df_dx.topLeftCorner(nc, nv).noalias() = f_partial_dtau * d->pinocchio.dtau_dq;
     d->df_dx.topRightCorner(nc, nv).noalias() = f_partial_dtau * d->pinocchio.dtau_dv;
-    d->df_dx.topRows(nc).noalias() += f_partial_da * d->multibody.contacts->da0_dx.topRows(nc);
+    contacts_->multiplyAccelerationDiff(d->multibody.contacts, f_partial_da, d->df_dx.topRows(nc), addto);
     d->df_dx.topRows(nc).noalias() -= f_partial_dtau * d->multibody.actuation->dtau_dx;
     d->df_du.topRows(nc).noalias() = -f_partial_dtau * d->multibody.actuation->dtau_du;
     contacts_->updateAccelerationDiff(d->multibody.contacts, d->Fx.bottomRows(nv));
@@ -165,6 +165,22 @@ DifferentialActionModelContactFwdDynamicsTpl<Scalar>::createData() {
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
 }
 
+template <typename Scalar>
+void DifferentialActionModelContactFwdDynamicsTpl<Scalar>::copyNodeParameters(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& from,
+    const boost::shared_ptr<DifferentialActionDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  costs_->copyNodeParameters(d_from->costs, d_to->costs);
+}
+
+template <typename Scalar>
+void DifferentialActionModelContactFwdDynamicsTpl<Scalar>::resetNodeParameters(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  costs_->resetNodeParameters(d->costs);
+}
+
 template <typename Scalar>
 void DifferentialActionModelContactFwdDynamicsTpl<Scalar>::quasiStatic(
     const boost::shared_ptr<DifferentialActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
@@ -197,8 +213,10 @@ void DifferentialActionModelContactFwdDynamicsTpl<Scalar>::quasiStatic(
   contacts_->calc(d->multibody.contacts, d->tmp_xstatic);
   // Allocates memory
   d->tmp_Jstatic.resize(nv, nu_ + nc);
+  d->tmp_ustatic.resize(nu_ + nc);
   d->tmp_Jstatic << d->multibody.actuation->dtau_du, d->multibody.contacts->Jc.topRows(nc).transpose();
-  u.noalias() = (pseudoInverse(d->tmp_Jstatic) * d->pinocchio.tau).head(nu_);
+  minimumNormSolve(d->tmp_Jstatic, d->pinocchio.tau, d->tmp_ustatic);
+  u = d->tmp_ustatic.head(nu_);
   d->pinocchio.tau.setZero();
 }
 
@@ -213,6 +231,18 @@ bool DifferentialActionModelContactFwdDynamicsTpl<Scalar>::checkData(
   }
 }
 
+template <typename Scalar>
+boost::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> >
+DifferentialActionModelContactFwdDynamicsTpl<Scalar>::clone() const {
+  boost::shared_ptr<DifferentialActionModelContactFwdDynamicsTpl> model =
+      boost::allocate_shared<DifferentialActionModelContactFwdDynamicsTpl>(
+          Eigen::aligned_allocator<DifferentialActionModelContactFwdDynamicsTpl>(), *this);
+  model->actuation_ = actuation_->clone();
+  model->contacts_ = contacts_->clone();
+  model->costs_ = costs_->clone();
+  return model;
+}
+
 template <typename Scalar>
 pinocchio::ModelTpl<Scalar>& DifferentialActionModelContactFwdDynamicsTpl<Scalar>::get_pinocchio() const {
   return pinocchio_;
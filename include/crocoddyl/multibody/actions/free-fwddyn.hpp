@@ -51,7 +51,11 @@ class DifferentialActionModelFreeFwdDynamicsTpl : public DifferentialActionModel
   virtual void calcDiff(const boost::shared_ptr<DifferentialActionDataAbstract>& data,
                         const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u);
   virtual boost::shared_ptr<DifferentialActionDataAbstract> createData();
+  virtual void copyNodeParameters(const boost::shared_ptr<DifferentialActionDataAbstract>& from,
+                                  const boost::shared_ptr<DifferentialActionDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<DifferentialActionDataAbstract>& data) const;
   virtual bool checkData(const boost::shared_ptr<DifferentialActionDataAbstract>& data);
+  virtual boost::shared_ptr<Base> clone() const;
 
   virtual void quasiStatic(const boost::shared_ptr<DifferentialActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
                            const Eigen::Ref<const VectorXs>& x, const std::size_t& maxiter = 100,
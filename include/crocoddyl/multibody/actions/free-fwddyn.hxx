@@ -125,6 +125,22 @@ DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::createData() {
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
 }
 
+template <typename Scalar>
+void DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::copyNodeParameters(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& from,
+    const boost::shared_ptr<DifferentialActionDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  costs_->copyNodeParameters(d_from->costs, d_to->costs);
+}
+
+template <typename Scalar>
+void DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::resetNodeParameters(
+    const boost::shared_ptr<DifferentialActionDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  costs_->resetNodeParameters(d->costs);
+}
+
 template <typename Scalar>
 bool DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::checkData(
     const boost::shared_ptr<DifferentialActionDataAbstract>& data) {
@@ -135,6 +151,17 @@ bool DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::checkData(
     return false;
   }
 }
+
+template <typename Scalar>
+boost::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> >
+DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::clone() const {
+  boost::shared_ptr<DifferentialActionModelFreeFwdDynamicsTpl> model =
+      boost::allocate_shared<DifferentialActionModelFreeFwdDynamicsTpl>(
+          Eigen::aligned_allocator<DifferentialActionModelFreeFwdDynamicsTpl>(), *this);
+  model->actuation_ = actuation_->clone();
+  model->costs_ = costs_->clone();
+  return model;
+}
 template <typename Scalar>
 void DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::quasiStatic(
     const boost::shared_ptr<DifferentialActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
@@ -161,7 +188,7 @@ void DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::quasiStatic(
   actuation_->calc(d->multibody.actuation, d->tmp_xstatic, VectorXs::Zero(nu_));
   actuation_->calcDiff(d->multibody.actuation, d->tmp_xstatic, VectorXs::Zero(nu_));
 
-  u.noalias() = pseudoInverse(d->multibody.actuation->dtau_du) * d->pinocchio.tau;
+  minimumNormSolve(d->multibody.actuation->dtau_du, d->pinocchio.tau, u);
   d->pinocchio.tau.setZero();
 }
 
@@ -142,6 +142,21 @@ boost::shared_ptr<ActionDataAbstractTpl<Scalar> > ActionModelImpulseFwdDynamicsT
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
 }
 
+template <typename Scalar>
+void ActionModelImpulseFwdDynamicsTpl<Scalar>::copyNodeParameters(
+    const boost::shared_ptr<ActionDataAbstract>& from, const boost::shared_ptr<ActionDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  costs_->copyNodeParameters(d_from->costs, d_to->costs);
+}
+
+template <typename Scalar>
+void ActionModelImpulseFwdDynamicsTpl<Scalar>::resetNodeParameters(
+    const boost::shared_ptr<ActionDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  costs_->resetNodeParameters(d->costs);
+}
+
 template <typename Scalar>
 bool ActionModelImpulseFwdDynamicsTpl<Scalar>::checkData(const boost::shared_ptr<ActionDataAbstract>& data) {
   boost::shared_ptr<Data> d = boost::dynamic_pointer_cast<Data>(data);
@@ -152,6 +167,16 @@ bool ActionModelImpulseFwdDynamicsTpl<Scalar>::checkData(const boost::shared_ptr
   }
 }
 
+template <typename Scalar>
+boost::shared_ptr<ActionModelAbstractTpl<Scalar> > ActionModelImpulseFwdDynamicsTpl<Scalar>::clone() const {
+  boost::shared_ptr<ActionModelImpulseFwdDynamicsTpl> model =
+      boost::allocate_shared<ActionModelImpulseFwdDynamicsTpl>(
+          Eigen::aligned_allocator<ActionModelImpulseFwdDynamicsTpl>(), *this);
+  model->impulses_ = impulses_->clone();
+  model->costs_ = costs_->clone();
+  return model;
+}
+
 template <typename Scalar>
 pinocchio::ModelTpl<Scalar>& ActionModelImpulseFwdDynamicsTpl<Scalar>::get_pinocchio() const {
   return pinocchio_;
@@ -61,6 +61,11 @@ class ActuationModelFloatingBaseTpl : public ActuationModelAbstractTpl<_Scalar>
     return data;
   };
 
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<ActuationModelFloatingBaseTpl>(
+        Eigen::aligned_allocator<ActuationModelFloatingBaseTpl>(), *this);
+  }
+
  protected:
   using Base::nu_;
   using Base::state_;
@@ -62,6 +62,10 @@ class ActuationModelFullTpl : public ActuationModelAbstractTpl<_Scalar> {
     return data;
   };
 
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<ActuationModelFullTpl>(Eigen::aligned_allocator<ActuationModelFullTpl>(), *this);
+  }
+
  protected:
   using Base::nu_;
   using Base::state_;
@@ -75,6 +75,11 @@ class ActuationModelMultiCopterBaseTpl : public ActuationModelAbstractTpl<_Scala
     return data;
   }
 
+  virtual boost::shared_ptr<Base> clone() const {
+    return boost::allocate_shared<ActuationModelMultiCopterBaseTpl>(
+        Eigen::aligned_allocator<ActuationModelMultiCopterBaseTpl>(), *this);
+  }
+
   const std::size_t& get_nrotors() const { return n_rotors_; };
   const MatrixXs& get_tauf() const { return tau_f_; };
   void set_tauf(const Eigen::Ref<const MatrixXs>& tau_f) { tau_f_ = tau_f; }
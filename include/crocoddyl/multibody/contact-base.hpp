@@ -17,6 +17,9 @@
 #include <pinocchio/multibody/data.hpp>
 #include <pinocchio/spatial/force.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace crocoddyl {
 
 template <typename _Scalar>
@@ -30,6 +33,7 @@ class ContactModelAbstractTpl {
   typedef StateMultibodyTpl<Scalar> StateMultibody;
   typedef typename MathBase::VectorXs VectorXs;
   typedef typename MathBase::MatrixXs MatrixXs;
+  typedef std::pair<std::size_t, std::size_t> DofBlock;
 
   ContactModelAbstractTpl(boost::shared_ptr<StateMultibody> state, const std::size_t& nc, const std::size_t& nu);
   ContactModelAbstractTpl(boost::shared_ptr<StateMultibody> state, const std::size_t& nc);
@@ -45,15 +49,23 @@ class ContactModelAbstractTpl {
   void setZeroForceDiff(const boost::shared_ptr<ContactDataAbstract>& data) const;
 
   virtual boost::shared_ptr<ContactDataAbstract> createData(pinocchio::DataTpl<Scalar>* const data);
+  virtual boost::shared_ptr<ContactModelAbstractTpl<Scalar> > clone() const;
 
   const boost::shared_ptr<StateMultibody>& get_state() const;
   const std::size_t& get_nc() const;
   const std::size_t& get_nu() const;
 
+  // Blocks (first column, number of columns) of velocity columns where Jc and da0_dx can be non-zero
+  const std::vector<DofBlock>& get_dof_blocks() const;
+
  protected:
+  // Restrict the dof blocks to the joints that support the given frame
+  void updateDofBlocks(const pinocchio::FrameIndex& frame);
+
   boost::shared_ptr<StateMultibody> state_;
   std::size_t nc_;
   std::size_t nu_;
+  std::vector<DofBlock> dof_blocks_;
 };
 
 template <typename _Scalar>
@@ -14,12 +14,12 @@ namespace crocoddyl {
 template <typename Scalar>
 ContactModelAbstractTpl<Scalar>::ContactModelAbstractTpl(boost::shared_ptr<StateMultibody> state,
                                                          const std::size_t& nc, const std::size_t& nu)
-    : state_(state), nc_(nc), nu_(nu) {}
+    : state_(state), nc_(nc), nu_(nu), dof_blocks_(1, DofBlock(0, state->get_nv())) {}
 
 template <typename Scalar>
 ContactModelAbstractTpl<Scalar>::ContactModelAbstractTpl(boost::shared_ptr<StateMultibody> state,
                                                          const std::size_t& nc)
-    : state_(state), nc_(nc), nu_(state->get_nv()) {}
+    : state_(state), nc_(nc), nu_(state->get_nv()), dof_blocks_(1, DofBlock(0, state->get_nv())) {}
 
 template <typename Scalar>
 ContactModelAbstractTpl<Scalar>::~ContactModelAbstractTpl() {}
@@ -54,6 +54,11 @@ boost::shared_ptr<ContactDataAbstractTpl<Scalar> > ContactModelAbstractTpl<Scala
   return boost::allocate_shared<ContactDataAbstract>(Eigen::aligned_allocator<ContactDataAbstract>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ContactModelAbstractTpl<Scalar> > ContactModelAbstractTpl<Scalar>::clone() const {
+  throw_pretty("It has not been implemented the clone() function");
+}
+
 template <typename Scalar>
 const boost::shared_ptr<StateMultibodyTpl<Scalar> >& ContactModelAbstractTpl<Scalar>::get_state() const {
   return state_;
@@ -69,4 +74,31 @@ const std::size_t& ContactModelAbstractTpl<Scalar>::get_nu() const {
   return nu_;
 }
 
+template <typename Scalar>
+const std::vector<typename ContactModelAbstractTpl<Scalar>::DofBlock>&
+ContactModelAbstractTpl<Scalar>::get_dof_blocks() const {
+  return dof_blocks_;
+}
+
+template <typename Scalar>
+void ContactModelAbstractTpl<Scalar>::updateDofBlocks(const pinocchio::FrameIndex& frame) {
+  const pinocchio::ModelTpl<Scalar>& model = *state_->get_pinocchio().get();
+  const pinocchio::JointIndex joint = model.frames[frame].parent;
+  // The first support is the universe joint, which has no dofs
+  const typename pinocchio::ModelTpl<Scalar>::IndexVector& supports = model.supports[joint];
+  dof_blocks_.clear();
+  for (std::size_t k = 1; k < supports.size(); ++k) {
+    const std::size_t idx_v = static_cast<std::size_t>(model.idx_vs[supports[k]]);
+    const std::size_t nv = static_cast<std::size_t>(model.nvs[supports[k]]);
+    if (nv == 0) {
+      continue;
+    }
+    if (!dof_blocks_.empty() && dof_blocks_.back().first + dof_blocks_.back().second == idx_v) {
+      dof_blocks_.back().second += nv;
+    } else {
+      dof_blocks_.push_back(DofBlock(idx_v, nv));
+    }
+  }
+}
+
 }  // namespace crocoddyl
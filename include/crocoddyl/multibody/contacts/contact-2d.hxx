@@ -11,12 +11,16 @@ namespace crocoddyl {
 template <typename Scalar>
 ContactModel2DTpl<Scalar>::ContactModel2DTpl(boost::shared_ptr<StateMultibody> state, const FrameTranslation& xref,
                                              const std::size_t& nu, const Vector2s& gains)
-    : Base(state, 2, nu), xref_(xref), gains_(gains) {}
+    : Base(state, 2, nu), xref_(xref), gains_(gains) {
+  Base::updateDofBlocks(xref_.id);
+}
 
 template <typename Scalar>
 ContactModel2DTpl<Scalar>::ContactModel2DTpl(boost::shared_ptr<StateMultibody> state, const FrameTranslation& xref,
                                              const Vector2s& gains)
-    : Base(state, 2), xref_(xref), gains_(gains) {}
+    : Base(state, 2), xref_(xref), gains_(gains) {
+  Base::updateDofBlocks(xref_.id);
+}
 
 template <typename Scalar>
 ContactModel2DTpl<Scalar>::~ContactModel2DTpl() {}
@@ -115,6 +119,11 @@ boost::shared_ptr<ContactDataAbstractTpl<Scalar> > ContactModel2DTpl<Scalar>::cr
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ContactModelAbstractTpl<Scalar> > ContactModel2DTpl<Scalar>::clone() const {
+  return boost::allocate_shared<ContactModel2DTpl>(Eigen::aligned_allocator<ContactModel2DTpl>(), *this);
+}
+
 template <typename Scalar>
 const FrameTranslationTpl<Scalar>& ContactModel2DTpl<Scalar>::get_xref() const {
   return xref_;
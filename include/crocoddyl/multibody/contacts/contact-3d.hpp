@@ -48,6 +48,7 @@ class ContactModel3DTpl : public ContactModelAbstractTpl<_Scalar> {
   virtual void calcDiff(const boost::shared_ptr<ContactDataAbstract>& data, const Eigen::Ref<const VectorXs>& x);
   virtual void updateForce(const boost::shared_ptr<ContactDataAbstract>& data, const VectorXs& force);
   virtual boost::shared_ptr<ContactDataAbstract> createData(pinocchio::DataTpl<Scalar>* const data);
+  virtual boost::shared_ptr<Base> clone() const;
 
   const FrameTranslation& get_xref() const;
   const Vector2s& get_gains() const;
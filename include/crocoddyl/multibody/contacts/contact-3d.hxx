@@ -11,12 +11,16 @@ namespace crocoddyl {
 template <typename Scalar>
 ContactModel3DTpl<Scalar>::ContactModel3DTpl(boost::shared_ptr<StateMultibody> state, const FrameTranslation& xref,
                                              const std::size_t& nu, const Vector2s& gains)
-    : Base(state, 3, nu), xref_(xref), gains_(gains) {}
+    : Base(state, 3, nu), xref_(xref), gains_(gains) {
+  Base::updateDofBlocks(xref_.id);
+}
 
 template <typename Scalar>
 ContactModel3DTpl<Scalar>::ContactModel3DTpl(boost::shared_ptr<StateMultibody> state, const FrameTranslation& xref,
                                              const Vector2s& gains)
-    : Base(state, 3), xref_(xref), gains_(gains) {}
+    : Base(state, 3), xref_(xref), gains_(gains) {
+  Base::updateDofBlocks(xref_.id);
+}
 
 template <typename Scalar>
 ContactModel3DTpl<Scalar>::~ContactModel3DTpl() {}
@@ -88,6 +92,11 @@ boost::shared_ptr<ContactDataAbstractTpl<Scalar> > ContactModel3DTpl<Scalar>::cr
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ContactModelAbstractTpl<Scalar> > ContactModel3DTpl<Scalar>::clone() const {
+  return boost::allocate_shared<ContactModel3DTpl>(Eigen::aligned_allocator<ContactModel3DTpl>(), *this);
+}
+
 template <typename Scalar>
 const FrameTranslationTpl<Scalar>& ContactModel3DTpl<Scalar>::get_xref() const {
   return xref_;
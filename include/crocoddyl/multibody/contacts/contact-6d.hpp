@@ -45,6 +45,7 @@ class ContactModel6DTpl : public ContactModelAbstractTpl<_Scalar> {
   virtual void calcDiff(const boost::shared_ptr<ContactDataAbstract>& data, const Eigen::Ref<const VectorXs>& x);
   virtual void updateForce(const boost::shared_ptr<ContactDataAbstract>& data, const VectorXs& force);
   virtual boost::shared_ptr<ContactDataAbstract> createData(pinocchio::DataTpl<Scalar>* const data);
+  virtual boost::shared_ptr<Base> clone() const;
 
   const FramePlacement& get_Mref() const;
   const Vector2s& get_gains() const;
@@ -18,12 +18,16 @@ namespace crocoddyl {
 template <typename Scalar>
 ContactModel6DTpl<Scalar>::ContactModel6DTpl(boost::shared_ptr<StateMultibody> state, const FramePlacement& Mref,
                                              const std::size_t& nu, const Vector2s& gains)
-    : Base(state, 6, nu), Mref_(Mref), gains_(gains) {}
+    : Base(state, 6, nu), Mref_(Mref), gains_(gains) {
+  Base::updateDofBlocks(Mref_.id);
+}
 
 template <typename Scalar>
 ContactModel6DTpl<Scalar>::ContactModel6DTpl(boost::shared_ptr<StateMultibody> state, const FramePlacement& Mref,
                                              const Vector2s& gains)
-    : Base(state, 6), Mref_(Mref), gains_(gains) {}
+    : Base(state, 6), Mref_(Mref), gains_(gains) {
+  Base::updateDofBlocks(Mref_.id);
+}
 
 template <typename Scalar>
 ContactModel6DTpl<Scalar>::~ContactModel6DTpl() {}
@@ -85,6 +89,11 @@ boost::shared_ptr<ContactDataAbstractTpl<Scalar> > ContactModel6DTpl<Scalar>::cr
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ContactModelAbstractTpl<Scalar> > ContactModel6DTpl<Scalar>::clone() const {
+  return boost::allocate_shared<ContactModel6DTpl>(Eigen::aligned_allocator<ContactModel6DTpl>(), *this);
+}
+
 template <typename Scalar>
 const FramePlacementTpl<Scalar>& ContactModel6DTpl<Scalar>::get_Mref() const {
   return Mref_;
@@ -161,6 +161,22 @@ class ContactModelMultipleTpl {
   void updateForceDiff(const boost::shared_ptr<ContactDataMultiple>& data, const MatrixXs& df_dx,
                        const MatrixXs& df_du) const;
 
+  /**
+   * @brief Compute the product of a matrix with the Jacobian of the contact acceleration drift
+   *
+   * It computes \f$\mathbf{A}\frac{\partial\mathbf{a}_0}{\partial\mathbf{x}}\f$, where the Jacobian is the
+   * stacked `da0_dx` of the active contacts. Each contact only touches the velocity columns of the joints that
+   * support it (see `ContactModelAbstractTpl::get_dof_blocks()`), so the product is assembled block by block.
+   *
+   * @param[in] data  Multi-contact data
+   * @param[in] A     Left-hand side matrix (number of columns = `nc`)
+   * @param[out] out  Product matrix (size `A.rows()`\f$\times\f$`ndx`)
+   * @param[in] op    Assignment operator which sets, adds, or removes the product
+   */
+  void multiplyAccelerationDiff(const boost::shared_ptr<ContactDataMultiple>& data,
+                                const Eigen::Ref<const MatrixXs>& A, Eigen::Ref<MatrixXs> out,
+                                const AssignmentOp op = setto) const;
+
   /**
    * @brief Create the multi-contact data
    *
@@ -169,6 +185,15 @@ class ContactModelMultipleTpl {
    */
   boost::shared_ptr<ContactDataMultiple> createData(pinocchio::DataTpl<Scalar>* const data);
 
+  /**
+   * @brief Clone the multi-contact model
+   *
+   * The cloned model has its own copy of each contact item, whose contact model is cloned as well.
+   *
+   * @return the cloned multi-contact model
+   */
+  boost::shared_ptr<ContactModelMultipleTpl<Scalar> > clone() const;
+
   /**
    * @brief Return the multibody state
    */
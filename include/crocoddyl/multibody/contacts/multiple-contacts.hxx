@@ -238,12 +238,66 @@ void ContactModelMultipleTpl<Scalar>::updateForceDiff(const boost::shared_ptr<Co
   }
 }
 
+template <typename Scalar>
+void ContactModelMultipleTpl<Scalar>::multiplyAccelerationDiff(const boost::shared_ptr<ContactDataMultiple>& data,
+                                                               const Eigen::Ref<const MatrixXs>& A,
+                                                               Eigen::Ref<MatrixXs> out, const AssignmentOp op) const {
+  assert_pretty(is_a_AssignmentOp(op), ("op must be one of the AssignmentOp {settop, addto, rmfrom}"));
+  const std::size_t& nv = state_->get_nv();
+  const std::size_t& ndx = state_->get_ndx();
+  if (static_cast<std::size_t>(A.cols()) != nc_) {
+    throw_pretty("Invalid argument: "
+                 << "A has wrong dimension (it should have " + std::to_string(nc_) + " columns)");
+  }
+  if (out.rows() != A.rows() || static_cast<std::size_t>(out.cols()) != ndx) {
+    throw_pretty("Invalid argument: "
+                 << "out has wrong dimension (it should be " + std::to_string(A.rows()) + "," + std::to_string(ndx) +
+                        ")");
+  }
+  if (op == setto) {
+    out.setZero();
+  }
+
+  std::size_t nc = 0;
+  typename ContactModelContainer::const_iterator it_m, end_m;
+  for (it_m = contacts_.begin(), end_m = contacts_.end(); it_m != end_m; ++it_m) {
+    const boost::shared_ptr<ContactItem>& m_i = it_m->second;
+    if (m_i->active) {
+      const std::size_t& nc_i = m_i->contact->get_nc();
+      const std::vector<typename ContactModelAbstract::DofBlock>& blocks = m_i->contact->get_dof_blocks();
+      for (std::size_t k = 0; k < blocks.size(); ++k) {
+        const std::size_t& j = blocks[k].first;
+        const std::size_t& n = blocks[k].second;
+        if (op == rmfrom) {
+          out.middleCols(j, n).noalias() -= A.middleCols(nc, nc_i) * data->da0_dx.block(nc, j, nc_i, n);
+          out.middleCols(nv + j, n).noalias() -= A.middleCols(nc, nc_i) * data->da0_dx.block(nc, nv + j, nc_i, n);
+        } else {
+          out.middleCols(j, n).noalias() += A.middleCols(nc, nc_i) * data->da0_dx.block(nc, j, nc_i, n);
+          out.middleCols(nv + j, n).noalias() += A.middleCols(nc, nc_i) * data->da0_dx.block(nc, nv + j, nc_i, n);
+        }
+      }
+      nc += nc_i;
+    }
+  }
+}
+
 template <typename Scalar>
 boost::shared_ptr<ContactDataMultipleTpl<Scalar> > ContactModelMultipleTpl<Scalar>::createData(
     pinocchio::DataTpl<Scalar>* const data) {
   return boost::allocate_shared<ContactDataMultiple>(Eigen::aligned_allocator<ContactDataMultiple>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ContactModelMultipleTpl<Scalar> > ContactModelMultipleTpl<Scalar>::clone() const {
+  boost::shared_ptr<ContactModelMultipleTpl> model =
+      boost::allocate_shared<ContactModelMultipleTpl>(Eigen::aligned_allocator<ContactModelMultipleTpl>(), *this);
+  for (typename ContactModelContainer::iterator it = model->contacts_.begin(); it != model->contacts_.end(); ++it) {
+    const ContactItem& item = *it->second;
+    it->second = boost::make_shared<ContactItem>(item.name, item.contact->clone(), item.active);
+  }
+  return model;
+}
+
 template <typename Scalar>
 const boost::shared_ptr<StateMultibodyTpl<Scalar> >& ContactModelMultipleTpl<Scalar>::get_state() const {
   return state_;
@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_MULTIBODY_COSTS_CENTROIDAL_COM_POSITION_HPP_
+#define CROCODDYL_MULTIBODY_COSTS_CENTROIDAL_COM_POSITION_HPP_
+
+#include "crocoddyl/multibody/fwd.hpp"
+#include "crocoddyl/core/cost-base.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief CoM position cost for the centroidal dynamics
+ *
+ * This cost function defines a residual vector as \f$\mathbf{r}=\mathbf{c}-\mathbf{c}^*\f$, where
+ * \f$\mathbf{c},\mathbf{c}^*\in~\mathbb{R}^{3}\f$ are the current and reference CoM position, respetively. The CoM
+ * position is read from the state of `DifferentialActionModelCentroidalFwdDynamicsTpl`, thus its residual Jacobian
+ * is constant and no multibody data is needed.
+ *
+ * \sa `CostModelAbstractTpl`, `DifferentialActionModelCentroidalFwdDynamicsTpl`, `calc()`, `calcDiff()`
+ */
+template <typename _Scalar>
+class CostModelCentroidalCoMPositionTpl : public CostModelAbstractTpl<_Scalar> {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef CostModelAbstractTpl<Scalar> Base;
+  typedef StateAbstractTpl<Scalar> StateAbstract;
+  typedef CostDataAbstractTpl<Scalar> CostDataAbstract;
+  typedef ActivationModelAbstractTpl<Scalar> ActivationModelAbstract;
+  typedef typename MathBase::Vector3s Vector3s;
+  typedef typename MathBase::VectorXs VectorXs;
+
+  /**
+   * @brief Initialize the centroidal CoM position cost model
+   *
+   * @param[in] state       State of the centroidal system
+   * @param[in] activation  Activation model
+   * @param[in] cref        Reference CoM position
+   * @param[in] nu          Dimension of the control vector
+   */
+  CostModelCentroidalCoMPositionTpl(boost::shared_ptr<StateAbstract> state,
+                                    boost::shared_ptr<ActivationModelAbstract> activation, const Vector3s& cref,
+                                    const std::size_t& nu);
+
+  /**
+   * @brief Initialize the centroidal CoM position cost model
+   *
+   * We use `ActivationModelQuadTpl` as a default activation model (i.e. \f$a=\frac{1}{2}\|\mathbf{r}\|^2\f$).
+   *
+   * @param[in] state  State of the centroidal system
+   * @param[in] cref   Reference CoM position
+   * @param[in] nu     Dimension of the control vector
+   */
+  CostModelCentroidalCoMPositionTpl(boost::shared_ptr<StateAbstract> state, const Vector3s& cref,
+                                    const std::size_t& nu);
+  virtual ~CostModelCentroidalCoMPositionTpl();
+
+  /**
+   * @brief Compute the centroidal CoM position cost
+   *
+   * @param[in] data  CoM position cost data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calc(const boost::shared_ptr<CostDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                    const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Compute the derivatives of the centroidal CoM position cost
+   *
+   * @param[in] data  CoM position cost data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calcDiff(const boost::shared_ptr<CostDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                        const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Clone the centroidal CoM position cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
+ protected:
+  /**
+   * @brief Modify the CoM position reference
+   */
+  virtual void set_referenceImpl(const std::type_info& ti, const void* pv);
+
+  /**
+   * @brief Return the CoM position reference
+   */
+  virtual void get_referenceImpl(const std::type_info& ti, void* pv) const;
+
+  using Base::activation_;
+  using Base::nu_;
+  using Base::state_;
+  using Base::unone_;
+
+ private:
+  Vector3s cref_;  //!< Reference CoM position
+};
+
+}  // namespace crocoddyl
+
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+#include "crocoddyl/multibody/costs/centroidal-com-position.hxx"
+
+#endif  // CROCODDYL_MULTIBODY_COSTS_CENTROIDAL_COM_POSITION_HPP_
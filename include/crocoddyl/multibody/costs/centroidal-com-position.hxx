@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/utils/exception.hpp"
+#include "crocoddyl/multibody/costs/centroidal-com-position.hpp"
+
+namespace crocoddyl {
+
+template <typename Scalar>
+CostModelCentroidalCoMPositionTpl<Scalar>::CostModelCentroidalCoMPositionTpl(
+    boost::shared_ptr<StateAbstract> state, boost::shared_ptr<ActivationModelAbstract> activation,
+    const Vector3s& cref, const std::size_t& nu)
+    : Base(state, activation, nu), cref_(cref) {
+  if (activation_->get_nr() != 3) {
+    throw_pretty("Invalid argument: "
+                 << "nr is equals to 3");
+  }
+}
+
+template <typename Scalar>
+CostModelCentroidalCoMPositionTpl<Scalar>::CostModelCentroidalCoMPositionTpl(boost::shared_ptr<StateAbstract> state,
+                                                                             const Vector3s& cref,
+                                                                             const std::size_t& nu)
+    : Base(state, 3, nu), cref_(cref) {}
+
+template <typename Scalar>
+CostModelCentroidalCoMPositionTpl<Scalar>::~CostModelCentroidalCoMPositionTpl() {}
+
+template <typename Scalar>
+void CostModelCentroidalCoMPositionTpl<Scalar>::calc(const boost::shared_ptr<CostDataAbstract>& data,
+                                                     const Eigen::Ref<const VectorXs>& x,
+                                                     const Eigen::Ref<const VectorXs>&) {
+  // Compute the cost residual give the reference CoM position
+  data->r = x.template head<3>() - cref_;
+
+  // Compute the cost
+  activation_->calc(data->activation, data->r);
+  data->cost = data->activation->a_value;
+}
+
+template <typename Scalar>
+void CostModelCentroidalCoMPositionTpl<Scalar>::calcDiff(const boost::shared_ptr<CostDataAbstract>& data,
+                                                         const Eigen::Ref<const VectorXs>&,
+                                                         const Eigen::Ref<const VectorXs>&) {
+  // The residual Jacobian is the selection of the CoM position
+  activation_->calcDiff(data->activation, data->r);
+  data->Rx.template leftCols<3>().setIdentity();
+  data->Lx.template head<3>() = data->activation->Ar;
+  data->Lxx.template topLeftCorner<3, 3>() = data->activation->Arr;
+}
+
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelCentroidalCoMPositionTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelCentroidalCoMPositionTpl> model =
+      boost::allocate_shared<CostModelCentroidalCoMPositionTpl>(
+          Eigen::aligned_allocator<CostModelCentroidalCoMPositionTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
+template <typename Scalar>
+void CostModelCentroidalCoMPositionTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
+  if (ti == typeid(Vector3s)) {
+    cref_ = *static_cast<const Vector3s*>(pv);
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be Vector3s)");
+  }
+}
+
+template <typename Scalar>
+void CostModelCentroidalCoMPositionTpl<Scalar>::get_referenceImpl(const std::type_info& ti, void* pv) const {
+  if (ti == typeid(Vector3s)) {
+    Eigen::Map<Vector3s> ref_map(static_cast<Vector3s*>(pv)->data());
+    ref_map[0] = cref_[0];
+    ref_map[1] = cref_[1];
+    ref_map[2] = cref_[2];
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be Vector3s)");
+  }
+}
+
+}  // namespace crocoddyl
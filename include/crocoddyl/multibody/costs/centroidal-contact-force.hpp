@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_MULTIBODY_COSTS_CENTROIDAL_CONTACT_FORCE_HPP_
+#define CROCODDYL_MULTIBODY_COSTS_CENTROIDAL_CONTACT_FORCE_HPP_
+
+#include "crocoddyl/multibody/fwd.hpp"
+#include "crocoddyl/core/cost-base.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Contact force cost for the centroidal dynamics
+ *
+ * This cost function defines a residual vector as \f$\mathbf{r}=\mathbf{f}_i-\mathbf{f}^*\f$, where
+ * \f$\mathbf{f}_i,\mathbf{f}^*\in~\mathbb{R}^{3}\f$ are the current and reference forces of the `i`-th contact. In
+ * `DifferentialActionModelCentroidalFwdDynamicsTpl` the contact forces are the control input, thus the residual only
+ * selects the `3` control entries of the contact.
+ *
+ * \sa `CostModelAbstractTpl`, `DifferentialActionModelCentroidalFwdDynamicsTpl`, `calc()`, `calcDiff()`
+ */
+template <typename _Scalar>
+class CostModelCentroidalContactForceTpl : public CostModelAbstractTpl<_Scalar> {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef CostModelAbstractTpl<Scalar> Base;
+  typedef StateAbstractTpl<Scalar> StateAbstract;
+  typedef CostDataAbstractTpl<Scalar> CostDataAbstract;
+  typedef ActivationModelAbstractTpl<Scalar> ActivationModelAbstract;
+  typedef typename MathBase::Vector3s Vector3s;
+  typedef typename MathBase::VectorXs VectorXs;
+
+  /**
+   * @brief Initialize the centroidal contact force cost model
+   *
+   * @param[in] state       State of the centroidal system
+   * @param[in] activation  Activation model
+   * @param[in] id          Index of the contact
+   * @param[in] fref        Reference contact force
+   * @param[in] nu          Dimension of the control vector
+   */
+  CostModelCentroidalContactForceTpl(boost::shared_ptr<StateAbstract> state,
+                                     boost::shared_ptr<ActivationModelAbstract> activation, const std::size_t& id,
+                                     const Vector3s& fref, const std::size_t& nu);
+
+  /**
+   * @brief Initialize the centroidal contact force cost model
+   *
+   * We use `ActivationModelQuadTpl` as a default activation model (i.e. \f$a=\frac{1}{2}\|\mathbf{r}\|^2\f$).
+   *
+   * @param[in] state  State of the centroidal system
+   * @param[in] id     Index of the contact
+   * @param[in] fref   Reference contact force
+   * @param[in] nu     Dimension of the control vector
+   */
+  CostModelCentroidalContactForceTpl(boost::shared_ptr<StateAbstract> state, const std::size_t& id,
+                                     const Vector3s& fref, const std::size_t& nu);
+  virtual ~CostModelCentroidalContactForceTpl();
+
+  /**
+   * @brief Compute the centroidal contact force cost
+   *
+   * @param[in] data  Contact force cost data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calc(const boost::shared_ptr<CostDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                    const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Compute the derivatives of the centroidal contact force cost
+   *
+   * @param[in] data  Contact force cost data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calcDiff(const boost::shared_ptr<CostDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                        const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Clone the centroidal contact force cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
+  /**
+   * @brief Return the contact index
+   */
+  const std::size_t& get_id() const;
+
+ protected:
+  /**
+   * @brief Modify the contact force reference
+   */
+  virtual void set_referenceImpl(const std::type_info& ti, const void* pv);
+
+  /**
+   * @brief Return the contact force reference
+   */
+  virtual void get_referenceImpl(const std::type_info& ti, void* pv) const;
+
+  using Base::activation_;
+  using Base::nu_;
+  using Base::state_;
+  using Base::unone_;
+
+ private:
+  std::size_t id_;  //!< Contact index
+  Vector3s fref_;   //!< Reference contact force
+};
+
+}  // namespace crocoddyl
+
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+#include "crocoddyl/multibody/costs/centroidal-contact-force.hxx"
+
+#endif  // CROCODDYL_MULTIBODY_COSTS_CENTROIDAL_CONTACT_FORCE_HPP_
@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/utils/exception.hpp"
+#include "crocoddyl/multibody/costs/centroidal-contact-force.hpp"
+
+namespace crocoddyl {
+
+template <typename Scalar>
+CostModelCentroidalContactForceTpl<Scalar>::CostModelCentroidalContactForceTpl(
+    boost::shared_ptr<StateAbstract> state, boost::shared_ptr<ActivationModelAbstract> activation,
+    const std::size_t& id, const Vector3s& fref, const std::size_t& nu)
+    : Base(state, activation, nu), id_(id), fref_(fref) {
+  if (activation_->get_nr() != 3) {
+    throw_pretty("Invalid argument: "
+                 << "nr is equals to 3");
+  }
+  if (3 * id_ + 3 > nu_) {
+    throw_pretty("Invalid argument: "
+                 << "the contact index is out of the control dimension");
+  }
+}
+
+template <typename Scalar>
+CostModelCentroidalContactForceTpl<Scalar>::CostModelCentroidalContactForceTpl(boost::shared_ptr<StateAbstract> state,
+                                                                               const std::size_t& id,
+                                                                               const Vector3s& fref,
+                                                                               const std::size_t& nu)
+    : Base(state, 3, nu), id_(id), fref_(fref) {
+  if (3 * id_ + 3 > nu_) {
+    throw_pretty("Invalid argument: "
+                 << "the contact index is out of the control dimension");
+  }
+}
+
+template <typename Scalar>
+CostModelCentroidalContactForceTpl<Scalar>::~CostModelCentroidalContactForceTpl() {}
+
+template <typename Scalar>
+void CostModelCentroidalContactForceTpl<Scalar>::calc(const boost::shared_ptr<CostDataAbstract>& data,
+                                                      const Eigen::Ref<const VectorXs>&,
+                                                      const Eigen::Ref<const VectorXs>& u) {
+  // Compute the cost residual give the reference contact force
+  data->r = u.template segment<3>(3 * id_) - fref_;
+
+  // Compute the cost
+  activation_->calc(data->activation, data->r);
+  data->cost = data->activation->a_value;
+}
+
+template <typename Scalar>
+void CostModelCentroidalContactForceTpl<Scalar>::calcDiff(const boost::shared_ptr<CostDataAbstract>& data,
+                                                          const Eigen::Ref<const VectorXs>&,
+                                                          const Eigen::Ref<const VectorXs>&) {
+  // The residual Jacobian is the selection of the contact force
+  const std::size_t i = 3 * id_;
+  activation_->calcDiff(data->activation, data->r);
+  data->Ru.template middleCols<3>(i).setIdentity();
+  data->Lu.template segment<3>(i) = data->activation->Ar;
+  data->Luu.template block<3, 3>(i, i) = data->activation->Arr;
+}
+
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelCentroidalContactForceTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelCentroidalContactForceTpl> model =
+      boost::allocate_shared<CostModelCentroidalContactForceTpl>(
+          Eigen::aligned_allocator<CostModelCentroidalContactForceTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
+template <typename Scalar>
+const std::size_t& CostModelCentroidalContactForceTpl<Scalar>::get_id() const {
+  return id_;
+}
+
+template <typename Scalar>
+void CostModelCentroidalContactForceTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
+  if (ti == typeid(Vector3s)) {
+    fref_ = *static_cast<const Vector3s*>(pv);
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be Vector3s)");
+  }
+}
+
+template <typename Scalar>
+void CostModelCentroidalContactForceTpl<Scalar>::get_referenceImpl(const std::type_info& ti, void* pv) const {
+  if (ti == typeid(Vector3s)) {
+    Eigen::Map<Vector3s> ref_map(static_cast<Vector3s*>(pv)->data());
+    ref_map[0] = fref_[0];
+    ref_map[1] = fref_[1];
+    ref_map[2] = fref_[2];
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be Vector3s)");
+  }
+}
+
+}  // namespace crocoddyl
@@ -0,0 +1,163 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_MULTIBODY_COSTS_CENTROIDAL_FRICTION_CONE_HPP_
+#define CROCODDYL_MULTIBODY_COSTS_CENTROIDAL_FRICTION_CONE_HPP_
+
+#include "crocoddyl/multibody/fwd.hpp"
+#include "crocoddyl/core/cost-base.hpp"
+#include "crocoddyl/multibody/friction-cone.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Friction cone cost for the centroidal dynamics
+ *
+ * This cost function defines a residual vector as \f$\mathbf{r}=\mathbf{A}\mathbf{f}_i\f$, where
+ * \f$\mathbf{A}\in~\mathbb{R}^{nr\times 3}\f$ describes the linearized friction cone and
+ * \f$\mathbf{f}_i\in~\mathbb{R}^{3}\f$ is the force of the `i`-th contact, expressed in the world frame. Since the
+ * contact forces are the control input of `DifferentialActionModelCentroidalFwdDynamicsTpl`, the residual is linear
+ * in the control. It is typically used with an `ActivationModelQuadraticBarrierTpl` defined by the cone bounds.
+ *
+ * \sa `CostModelAbstractTpl`, `DifferentialActionModelCentroidalFwdDynamicsTpl`, `calc()`, `calcDiff()`
+ */
+template <typename _Scalar>
+class CostModelCentroidalFrictionConeTpl : public CostModelAbstractTpl<_Scalar> {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef CostModelAbstractTpl<Scalar> Base;
+  typedef CostDataCentroidalFrictionConeTpl<Scalar> Data;
+  typedef StateAbstractTpl<Scalar> StateAbstract;
+  typedef CostDataAbstractTpl<Scalar> CostDataAbstract;
+  typedef ActivationModelAbstractTpl<Scalar> ActivationModelAbstract;
+  typedef DataCollectorAbstractTpl<Scalar> DataCollectorAbstract;
+  typedef FrictionConeTpl<Scalar> FrictionCone;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixX3s MatrixX3s;
+
+  /**
+   * @brief Initialize the centroidal friction cone cost model
+   *
+   * @param[in] state       State of the centroidal system
+   * @param[in] activation  Activation model
+   * @param[in] id          Index of the contact
+   * @param[in] cone        Friction cone
+   * @param[in] nu          Dimension of the control vector
+   */
+  CostModelCentroidalFrictionConeTpl(boost::shared_ptr<StateAbstract> state,
+                                     boost::shared_ptr<ActivationModelAbstract> activation, const std::size_t& id,
+                                     const FrictionCone& cone, const std::size_t& nu);
+
+  /**
+   * @brief Initialize the centroidal friction cone cost model
+   *
+   * We use `ActivationModelQuadTpl` as a default activation model (i.e. \f$a=\frac{1}{2}\|\mathbf{r}\|^2\f$).
+   *
+   * @param[in] state  State of the centroidal system
+   * @param[in] id     Index of the contact
+   * @param[in] cone   Friction cone
+   * @param[in] nu     Dimension of the control vector
+   */
+  CostModelCentroidalFrictionConeTpl(boost::shared_ptr<StateAbstract> state, const std::size_t& id,
+                                     const FrictionCone& cone, const std::size_t& nu);
+  virtual ~CostModelCentroidalFrictionConeTpl();
+
+  /**
+   * @brief Compute the centroidal friction cone cost
+   *
+   * @param[in] data  Friction cone cost data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calc(const boost::shared_ptr<CostDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                    const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Compute the derivatives of the centroidal friction cone cost
+   *
+   * @param[in] data  Friction cone cost data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calcDiff(const boost::shared_ptr<CostDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
+                        const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Create the centroidal friction cone cost data
+   */
+  virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
+
+  /**
+   * @brief Clone the centroidal friction cone cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
+  /**
+   * @brief Return the contact index
+   */
+  const std::size_t& get_id() const;
+
+ protected:
+  /**
+   * @brief Modify the friction cone reference
+   */
+  virtual void set_referenceImpl(const std::type_info& ti, const void* pv);
+
+  /**
+   * @brief Return the friction cone reference
+   */
+  virtual void get_referenceImpl(const std::type_info& ti, void* pv) const;
+
+  using Base::activation_;
+  using Base::nu_;
+  using Base::state_;
+  using Base::unone_;
+
+ private:
+  std::size_t id_;     //!< Contact index
+  FrictionCone cone_;  //!< Friction cone
+};
+
+template <typename _Scalar>
+struct CostDataCentroidalFrictionConeTpl : public CostDataAbstractTpl<_Scalar> {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef CostDataAbstractTpl<Scalar> Base;
+  typedef DataCollectorAbstractTpl<Scalar> DataCollectorAbstract;
+  typedef typename MathBase::MatrixX3s MatrixX3s;
+
+  template <template <typename Scalar> class Model>
+  CostDataCentroidalFrictionConeTpl(Model<Scalar>* const model, DataCollectorAbstract* const data)
+      : Base(model, data), Arr_A(model->get_activation()->get_nr(), 3) {
+    Arr_A.setZero();
+  }
+
+  MatrixX3s Arr_A;
+
+  using Base::activation;
+  using Base::cost;
+  using Base::Lu;
+  using Base::Luu;
+  using Base::r;
+  using Base::Ru;
+};
+
+}  // namespace crocoddyl
+
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+#include "crocoddyl/multibody/costs/centroidal-friction-cone.hxx"
+
+#endif  // CROCODDYL_MULTIBODY_COSTS_CENTROIDAL_FRICTION_CONE_HPP_
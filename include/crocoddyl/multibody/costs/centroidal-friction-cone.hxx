@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2019-2020, LAAS-CNRS, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/utils/exception.hpp"
+#include "crocoddyl/multibody/costs/centroidal-friction-cone.hpp"
+
+namespace crocoddyl {
+
+template <typename Scalar>
+CostModelCentroidalFrictionConeTpl<Scalar>::CostModelCentroidalFrictionConeTpl(
+    boost::shared_ptr<StateAbstract> state, boost::shared_ptr<ActivationModelAbstract> activation,
+    const std::size_t& id, const FrictionCone& cone, const std::size_t& nu)
+    : Base(state, activation, nu), id_(id), cone_(cone) {
+  if (activation_->get_nr() != cone_.get_nf() + 1) {
+    throw_pretty("Invalid argument: "
+                 << "nr is equals to " << cone_.get_nf() + 1);
+  }
+  if (3 * id_ + 3 > nu_) {
+    throw_pretty("Invalid argument: "
+                 << "the contact index is out of the control dimension");
+  }
+}
+
+template <typename Scalar>
+CostModelCentroidalFrictionConeTpl<Scalar>::CostModelCentroidalFrictionConeTpl(boost::shared_ptr<StateAbstract> state,
+                                                                               const std::size_t& id,
+                                                                               const FrictionCone& cone,
+                                                                               const std::size_t& nu)
+    : Base(state, cone.get_nf() + 1, nu), id_(id), cone_(cone) {
+  if (3 * id_ + 3 > nu_) {
+    throw_pretty("Invalid argument: "
+                 << "the contact index is out of the control dimension");
+  }
+}
+
+template <typename Scalar>
+CostModelCentroidalFrictionConeTpl<Scalar>::~CostModelCentroidalFrictionConeTpl() {}
+
+template <typename Scalar>
+void CostModelCentroidalFrictionConeTpl<Scalar>::calc(const boost::shared_ptr<CostDataAbstract>& data,
+                                                      const Eigen::Ref<const VectorXs>&,
+                                                      const Eigen::Ref<const VectorXs>& u) {
+  // Compute the residual of the friction cone
+  data->r.noalias() = cone_.get_A() * u.template segment<3>(3 * id_);
+
+  // Compute the cost
+  activation_->calc(data->activation, data->r);
+  data->cost = data->activation->a_value;
+}
+
+template <typename Scalar>
+void CostModelCentroidalFrictionConeTpl<Scalar>::calcDiff(const boost::shared_ptr<CostDataAbstract>& data,
+                                                          const Eigen::Ref<const VectorXs>&,
+                                                          const Eigen::Ref<const VectorXs>&) {
+  Data* d = static_cast<Data*>(data.get());
+
+  // The residual Jacobian is the cone matrix applied to the contact force
+  const std::size_t i = 3 * id_;
+  const MatrixX3s& A = cone_.get_A();
+  activation_->calcDiff(data->activation, data->r);
+  data->Ru.template middleCols<3>(i) = A;
+  data->Lu.template segment<3>(i).noalias() = A.transpose() * data->activation->Ar;
+  d->Arr_A.noalias() = data->activation->Arr * A;
+  data->Luu.template block<3, 3>(i, i).noalias() = A.transpose() * d->Arr_A;
+}
+
+template <typename Scalar>
+boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelCentroidalFrictionConeTpl<Scalar>::createData(
+    DataCollectorAbstract* const data) {
+  return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
+}
+
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelCentroidalFrictionConeTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelCentroidalFrictionConeTpl> model =
+      boost::allocate_shared<CostModelCentroidalFrictionConeTpl>(
+          Eigen::aligned_allocator<CostModelCentroidalFrictionConeTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
+template <typename Scalar>
+const std::size_t& CostModelCentroidalFrictionConeTpl<Scalar>::get_id() const {
+  return id_;
+}
+
+template <typename Scalar>
+void CostModelCentroidalFrictionConeTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
+  if (ti == typeid(FrictionCone)) {
+    cone_ = *static_cast<const FrictionCone*>(pv);
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be FrictionCone)");
+  }
+}
+
+template <typename Scalar>
+void CostModelCentroidalFrictionConeTpl<Scalar>::get_referenceImpl(const std::type_info& ti, void* pv) const {
+  if (ti == typeid(FrictionCone)) {
+    FrictionCone& ref_map = *static_cast<FrictionCone*>(pv);
+    ref_map = cone_;
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be FrictionCone)");
+  }
+}
+
+}  // namespace crocoddyl
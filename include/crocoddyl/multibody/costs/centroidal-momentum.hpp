@@ -123,6 +123,11 @@ class CostModelCentroidalMomentumTpl : public CostModelAbstractTpl<_Scalar> {
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
 
+  /**
+   * @brief Clone the centroidal momentum cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
   DEPRECATED("Use set_reference<MathBaseTpl<Scalar>::Vector6s>()", void set_href(const Vector6s& mref_in));
   DEPRECATED("Use get_reference<MathBaseTpl<Scalar>::Vector6s>()", const Vector6s& get_href() const);
 
@@ -140,6 +145,7 @@ class CostModelCentroidalMomentumTpl : public CostModelAbstractTpl<_Scalar> {
   using Base::activation_;
   using Base::nu_;
   using Base::state_;
+  using Base::u_dependent_;
   using Base::unone_;
 
  private:
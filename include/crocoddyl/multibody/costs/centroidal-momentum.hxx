@@ -18,6 +18,7 @@ CostModelCentroidalMomentumTpl<Scalar>::CostModelCentroidalMomentumTpl(
     boost::shared_ptr<StateMultibody> state, boost::shared_ptr<ActivationModelAbstract> activation,
     const Vector6s& href, const std::size_t& nu)
     : Base(state, activation, nu), href_(href), pin_model_(state->get_pinocchio()) {
+  u_dependent_ = false;
   if (activation_->get_nr() != 6) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 6");
@@ -29,6 +30,7 @@ CostModelCentroidalMomentumTpl<Scalar>::CostModelCentroidalMomentumTpl(
     boost::shared_ptr<StateMultibody> state, boost::shared_ptr<ActivationModelAbstract> activation,
     const Vector6s& href)
     : Base(state, activation), href_(href), pin_model_(state->get_pinocchio()) {
+  u_dependent_ = false;
   if (activation_->get_nr() != 6) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 6");
@@ -38,12 +40,16 @@ CostModelCentroidalMomentumTpl<Scalar>::CostModelCentroidalMomentumTpl(
 template <typename Scalar>
 CostModelCentroidalMomentumTpl<Scalar>::CostModelCentroidalMomentumTpl(boost::shared_ptr<StateMultibody> state,
                                                                        const Vector6s& href, const std::size_t& nu)
-    : Base(state, 6, nu), href_(href), pin_model_(state->get_pinocchio()) {}
+    : Base(state, 6, nu), href_(href), pin_model_(state->get_pinocchio()) {
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelCentroidalMomentumTpl<Scalar>::CostModelCentroidalMomentumTpl(boost::shared_ptr<StateMultibody> state,
                                                                        const Vector6s& href)
-    : Base(state, 6), href_(href), pin_model_(state->get_pinocchio()) {}
+    : Base(state, 6), href_(href), pin_model_(state->get_pinocchio()) {
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelCentroidalMomentumTpl<Scalar>::~CostModelCentroidalMomentumTpl() {}
@@ -89,6 +95,15 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelCentroidalMomentumTpl<S
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelCentroidalMomentumTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelCentroidalMomentumTpl> model =
+      boost::allocate_shared<CostModelCentroidalMomentumTpl>(
+          Eigen::aligned_allocator<CostModelCentroidalMomentumTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelCentroidalMomentumTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(Vector6s)) {
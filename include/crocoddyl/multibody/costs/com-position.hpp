@@ -117,6 +117,11 @@ class CostModelCoMPositionTpl : public CostModelAbstractTpl<_Scalar> {
   virtual void calcDiff(const boost::shared_ptr<CostDataAbstract>& data, const Eigen::Ref<const VectorXs>& x,
                         const Eigen::Ref<const VectorXs>& u);
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
+  virtual void copyNodeParameters(const boost::shared_ptr<CostDataAbstract>& from,
+                                  const boost::shared_ptr<CostDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<CostDataAbstract>& data) const;
+
+  virtual boost::shared_ptr<Base> clone() const;
 
   DEPRECATED("Use set_reference<MathBaseTpl<Scalar>::Vector3s>()", void set_cref(const Vector3s& cref_in));
   DEPRECATED("Use get_reference<MathBaseTpl<Scalar>::Vector3s>()", const Vector3s& get_cref() const);
@@ -132,10 +137,24 @@ class CostModelCoMPositionTpl : public CostModelAbstractTpl<_Scalar> {
    */
   virtual void get_referenceImpl(const std::type_info& ti, void* pv) const;
 
+  /**
+   * @brief Modify the CoM position reference of a given node
+   */
+  virtual void set_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data, const std::type_info& ti,
+                                     const void* pv);
+
+  /**
+   * @brief Return the CoM position reference used by a given node
+   */
+  virtual void get_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data, const std::type_info& ti,
+                                     void* pv) const;
+
   using Base::activation_;
   using Base::nu_;
   using Base::state_;
+  using Base::u_dependent_;
   using Base::unone_;
+  using Base::v_dependent_;
 
  private:
   Vector3s cref_;  //!< Reference CoM position
@@ -149,11 +168,12 @@ struct CostDataCoMPositionTpl : public CostDataAbstractTpl<_Scalar> {
   typedef MathBaseTpl<Scalar> MathBase;
   typedef CostDataAbstractTpl<Scalar> Base;
   typedef DataCollectorAbstractTpl<Scalar> DataCollectorAbstract;
+  typedef typename MathBase::Vector3s Vector3s;
   typedef typename MathBase::Matrix3xs Matrix3xs;
 
   template <template <typename Scalar> class Model>
   CostDataCoMPositionTpl(Model<Scalar>* const model, DataCollectorAbstract* const data)
-      : Base(model, data), Arr_Jcom(3, model->get_state()->get_nv()) {
+      : Base(model, data), Arr_Jcom(3, model->get_state()->get_nv()), cref(Vector3s::Zero()), has_reference(false) {
     Arr_Jcom.setZero();
     // Check that proper shared data has been passed
     DataCollectorMultibodyTpl<Scalar>* d = dynamic_cast<DataCollectorMultibodyTpl<Scalar>*>(shared);
@@ -167,6 +187,8 @@ struct CostDataCoMPositionTpl : public CostDataAbstractTpl<_Scalar> {
 
   pinocchio::DataTpl<Scalar>* pinocchio;
   Matrix3xs Arr_Jcom;
+  Vector3s cref;       //!< Reference CoM position of the node
+  bool has_reference;  //!< Indicates if the node uses its own reference
 
   using Base::activation;
   using Base::cost;
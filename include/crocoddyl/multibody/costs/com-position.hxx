@@ -16,6 +16,8 @@ CostModelCoMPositionTpl<Scalar>::CostModelCoMPositionTpl(boost::shared_ptr<State
                                                          boost::shared_ptr<ActivationModelAbstract> activation,
                                                          const Vector3s& cref, const std::size_t& nu)
     : Base(state, activation, nu), cref_(cref) {
+  v_dependent_ = false;
+  u_dependent_ = false;
   if (activation_->get_nr() != 3) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 3");
@@ -27,6 +29,8 @@ CostModelCoMPositionTpl<Scalar>::CostModelCoMPositionTpl(boost::shared_ptr<State
                                                          boost::shared_ptr<ActivationModelAbstract> activation,
                                                          const Vector3s& cref)
     : Base(state, activation), cref_(cref) {
+  v_dependent_ = false;
+  u_dependent_ = false;
   if (activation_->get_nr() != 3) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 3");
@@ -36,11 +40,17 @@ CostModelCoMPositionTpl<Scalar>::CostModelCoMPositionTpl(boost::shared_ptr<State
 template <typename Scalar>
 CostModelCoMPositionTpl<Scalar>::CostModelCoMPositionTpl(boost::shared_ptr<StateMultibody> state, const Vector3s& cref,
                                                          const std::size_t& nu)
-    : Base(state, 3, nu), cref_(cref) {}
+    : Base(state, 3, nu), cref_(cref) {
+  v_dependent_ = false;
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelCoMPositionTpl<Scalar>::CostModelCoMPositionTpl(boost::shared_ptr<StateMultibody> state, const Vector3s& cref)
-    : Base(state, 3), cref_(cref) {}
+    : Base(state, 3), cref_(cref) {
+  v_dependent_ = false;
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelCoMPositionTpl<Scalar>::~CostModelCoMPositionTpl() {}
@@ -50,7 +60,7 @@ void CostModelCoMPositionTpl<Scalar>::calc(const boost::shared_ptr<CostDataAbstr
                                            const Eigen::Ref<const VectorXs>&, const Eigen::Ref<const VectorXs>&) {
   // Compute the cost residual give the reference CoMPosition position
   Data* d = static_cast<Data*>(data.get());
-  data->r = d->pinocchio->com[0] - cref_;
+  data->r = d->pinocchio->com[0] - (d->has_reference ? d->cref : cref_);
 
   // Compute the cost
   activation_->calc(data->activation, data->r);
@@ -77,6 +87,29 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelCoMPositionTpl<Scalar>:
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelCoMPositionTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelCoMPositionTpl> model =
+      boost::allocate_shared<CostModelCoMPositionTpl>(Eigen::aligned_allocator<CostModelCoMPositionTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
+template <typename Scalar>
+void CostModelCoMPositionTpl<Scalar>::copyNodeParameters(const boost::shared_ptr<CostDataAbstract>& from,
+                                                         const boost::shared_ptr<CostDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  d_to->cref = d_from->cref;
+  d_to->has_reference = d_from->has_reference;
+}
+
+template <typename Scalar>
+void CostModelCoMPositionTpl<Scalar>::resetNodeParameters(const boost::shared_ptr<CostDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  d->has_reference = false;
+}
+
 template <typename Scalar>
 void CostModelCoMPositionTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(Vector3s)) {
@@ -98,6 +131,33 @@ void CostModelCoMPositionTpl<Scalar>::get_referenceImpl(const std::type_info& ti
   }
 }
 
+template <typename Scalar>
+void CostModelCoMPositionTpl<Scalar>::set_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data,
+                                                            const std::type_info& ti, const void* pv) {
+  if (ti == typeid(Vector3s)) {
+    Data* d = static_cast<Data*>(data.get());
+    d->cref = *static_cast<const Vector3s*>(pv);
+    d->has_reference = true;
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be Vector3s)");
+  }
+}
+
+template <typename Scalar>
+void CostModelCoMPositionTpl<Scalar>::get_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data,
+                                                            const std::type_info& ti, void* pv) const {
+  if (ti == typeid(Vector3s)) {
+    Data* d = static_cast<Data*>(data.get());
+    const Vector3s& cref = d->has_reference ? d->cref : cref_;
+    Eigen::Map<Vector3s> ref_map(static_cast<Vector3s*>(pv)->data());
+    ref_map[0] = cref[0];
+    ref_map[1] = cref[1];
+    ref_map[2] = cref[2];
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be Vector3s)");
+  }
+}
+
 template <typename Scalar>
 const typename MathBaseTpl<Scalar>::Vector3s& CostModelCoMPositionTpl<Scalar>::get_cref() const {
   return cref_;
@@ -163,6 +163,11 @@ class CostModelContactCoPPositionTpl : public CostModelAbstractTpl<_Scalar> {
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
 
+  /**
+   * @brief Clone the contact CoP cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
  protected:
   /**
    * @brief Return the frame CoP support
@@ -93,6 +93,15 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelContactCoPPositionTpl<S
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelContactCoPPositionTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelContactCoPPositionTpl> model =
+      boost::allocate_shared<CostModelContactCoPPositionTpl>(
+          Eigen::aligned_allocator<CostModelContactCoPPositionTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelContactCoPPositionTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FrameCoPSupport)) {
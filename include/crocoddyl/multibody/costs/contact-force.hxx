@@ -122,6 +122,14 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelContactForceTpl<Scalar>
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelContactForceTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelContactForceTpl> model =
+      boost::allocate_shared<CostModelContactForceTpl>(Eigen::aligned_allocator<CostModelContactForceTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelContactForceTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FrameForce)) {
@@ -137,6 +137,11 @@ class CostModelContactFrictionConeTpl : public CostModelAbstractTpl<_Scalar> {
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
 
+  /**
+   * @brief Clone the contact friction cone cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
  protected:
   /**
    * @brief Modify the contact friction cone reference
@@ -96,6 +96,15 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelContactFrictionConeTpl<
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelContactFrictionConeTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelContactFrictionConeTpl> model =
+      boost::allocate_shared<CostModelContactFrictionConeTpl>(
+          Eigen::aligned_allocator<CostModelContactFrictionConeTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelContactFrictionConeTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FrameFrictionCone)) {
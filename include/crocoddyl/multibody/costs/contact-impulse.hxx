@@ -92,6 +92,14 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelContactImpulseTpl<Scala
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelContactImpulseTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelContactImpulseTpl> model =
+      boost::allocate_shared<CostModelContactImpulseTpl>(Eigen::aligned_allocator<CostModelContactImpulseTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelContactImpulseTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FrameForce)) {
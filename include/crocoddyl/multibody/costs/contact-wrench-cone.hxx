@@ -94,6 +94,15 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelContactWrenchConeTpl<Sc
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelContactWrenchConeTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelContactWrenchConeTpl> model =
+      boost::allocate_shared<CostModelContactWrenchConeTpl>(
+          Eigen::aligned_allocator<CostModelContactWrenchConeTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelContactWrenchConeTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FrameWrenchCone)) {
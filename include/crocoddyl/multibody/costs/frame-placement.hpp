@@ -124,6 +124,14 @@ class CostModelFramePlacementTpl : public CostModelAbstractTpl<_Scalar> {
    * @brief Create the frame placement cost data
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
+  virtual void copyNodeParameters(const boost::shared_ptr<CostDataAbstract>& from,
+                                  const boost::shared_ptr<CostDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<CostDataAbstract>& data) const;
+
+  /**
+   * @brief Clone the frame placement cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
 
   DEPRECATED("Use set_reference<FramePlacementTpl<Scalar> >()", void set_Mref(const FramePlacement& Mref_in));
   DEPRECATED("Use get_reference<FramePlacementTpl<Scalar> >()", const FramePlacement& get_Mref() const);
@@ -139,10 +147,24 @@ class CostModelFramePlacementTpl : public CostModelAbstractTpl<_Scalar> {
    */
   virtual void get_referenceImpl(const std::type_info& ti, void* pv) const;
 
+  /**
+   * @brief Modify the frame placement reference of a given node
+   */
+  virtual void set_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data, const std::type_info& ti,
+                                     const void* pv);
+
+  /**
+   * @brief Return the frame placement reference used by a given node
+   */
+  virtual void get_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data, const std::type_info& ti,
+                                     void* pv) const;
+
   using Base::activation_;
   using Base::nu_;
   using Base::state_;
+  using Base::u_dependent_;
   using Base::unone_;
+  using Base::v_dependent_;
 
  private:
   FramePlacement Mref_;                                                   //!< Reference frame placement
@@ -168,7 +190,9 @@ struct CostDataFramePlacementTpl : public CostDataAbstractTpl<_Scalar> {
         J(6, model->get_state()->get_nv()),
         rJf(6, 6),
         fJf(6, model->get_state()->get_nv()),
-        Arr_J(6, model->get_state()->get_nv()) {
+        Arr_J(6, model->get_state()->get_nv()),
+        oMf_inv(pinocchio::SE3Tpl<Scalar>::Identity()),
+        has_reference(false) {
     r.setZero();
     J.setZero();
     rJf.setZero();
@@ -191,6 +215,9 @@ struct CostDataFramePlacementTpl : public CostDataAbstractTpl<_Scalar> {
   Matrix6s rJf;
   Matrix6xs fJf;
   Matrix6xs Arr_J;
+  FramePlacementTpl<Scalar> Mref;      //!< Reference frame placement of the node
+  pinocchio::SE3Tpl<Scalar> oMf_inv;  //!< Inverse of the reference placement of the node
+  bool has_reference;                  //!< Indicates if the node uses its own reference
 
   using Base::activation;
   using Base::cost;
@@ -21,6 +21,8 @@ CostModelFramePlacementTpl<Scalar>::CostModelFramePlacementTpl(boost::shared_ptr
       Mref_(Mref),
       oMf_inv_(Mref.placement.inverse()),
       pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
   if (activation_->get_nr() != 6) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 6");
@@ -32,6 +34,8 @@ CostModelFramePlacementTpl<Scalar>::CostModelFramePlacementTpl(boost::shared_ptr
                                                                boost::shared_ptr<ActivationModelAbstract> activation,
                                                                const FramePlacement& Mref)
     : Base(state, activation), Mref_(Mref), oMf_inv_(Mref.placement.inverse()), pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
   if (activation_->get_nr() != 6) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 6");
@@ -41,12 +45,18 @@ CostModelFramePlacementTpl<Scalar>::CostModelFramePlacementTpl(boost::shared_ptr
 template <typename Scalar>
 CostModelFramePlacementTpl<Scalar>::CostModelFramePlacementTpl(boost::shared_ptr<StateMultibody> state,
                                                                const FramePlacement& Mref, const std::size_t& nu)
-    : Base(state, 6, nu), Mref_(Mref), oMf_inv_(Mref.placement.inverse()), pin_model_(state->get_pinocchio()) {}
+    : Base(state, 6, nu), Mref_(Mref), oMf_inv_(Mref.placement.inverse()), pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelFramePlacementTpl<Scalar>::CostModelFramePlacementTpl(boost::shared_ptr<StateMultibody> state,
                                                                const FramePlacement& Mref)
-    : Base(state, 6), Mref_(Mref), oMf_inv_(Mref.placement.inverse()), pin_model_(state->get_pinocchio()) {}
+    : Base(state, 6), Mref_(Mref), oMf_inv_(Mref.placement.inverse()), pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelFramePlacementTpl<Scalar>::~CostModelFramePlacementTpl() {}
@@ -57,8 +67,13 @@ void CostModelFramePlacementTpl<Scalar>::calc(const boost::shared_ptr<CostDataAb
   Data* d = static_cast<Data*>(data.get());
 
   // Compute the frame placement w.r.t. the reference frame
-  pinocchio::updateFramePlacement(*pin_model_.get(), *d->pinocchio, Mref_.id);
-  d->rMf = oMf_inv_ * d->pinocchio->oMf[Mref_.id];
+  if (d->has_reference) {
+    pinocchio::updateFramePlacement(*pin_model_.get(), *d->pinocchio, d->Mref.id);
+    d->rMf = d->oMf_inv * d->pinocchio->oMf[d->Mref.id];
+  } else {
+    pinocchio::updateFramePlacement(*pin_model_.get(), *d->pinocchio, Mref_.id);
+    d->rMf = oMf_inv_ * d->pinocchio->oMf[Mref_.id];
+  }
   d->r = pinocchio::log6(d->rMf);
   data->r = d->r;  // this is needed because we overwrite it
 
@@ -76,7 +91,8 @@ void CostModelFramePlacementTpl<Scalar>::calcDiff(const boost::shared_ptr<CostDa
 
   // Compute the frame Jacobian at the error point
   pinocchio::Jlog6(d->rMf, d->rJf);
-  pinocchio::getFrameJacobian(*pin_model_.get(), *d->pinocchio, Mref_.id, pinocchio::LOCAL, d->fJf);
+  const FrameIndex id = d->has_reference ? d->Mref.id : Mref_.id;
+  pinocchio::getFrameJacobian(*pin_model_.get(), *d->pinocchio, id, pinocchio::LOCAL, d->fJf);
   d->J.noalias() = d->rJf * d->fJf;
 
   // Compute the derivatives of the frame placement
@@ -94,6 +110,30 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelFramePlacementTpl<Scala
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelFramePlacementTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelFramePlacementTpl> model =
+      boost::allocate_shared<CostModelFramePlacementTpl>(Eigen::aligned_allocator<CostModelFramePlacementTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
+template <typename Scalar>
+void CostModelFramePlacementTpl<Scalar>::copyNodeParameters(const boost::shared_ptr<CostDataAbstract>& from,
+                                                            const boost::shared_ptr<CostDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  d_to->Mref = d_from->Mref;
+  d_to->oMf_inv = d_from->oMf_inv;
+  d_to->has_reference = d_from->has_reference;
+}
+
+template <typename Scalar>
+void CostModelFramePlacementTpl<Scalar>::resetNodeParameters(const boost::shared_ptr<CostDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  d->has_reference = false;
+}
+
 template <typename Scalar>
 void CostModelFramePlacementTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FramePlacement)) {
@@ -114,6 +154,31 @@ void CostModelFramePlacementTpl<Scalar>::get_referenceImpl(const std::type_info&
   }
 }
 
+template <typename Scalar>
+void CostModelFramePlacementTpl<Scalar>::set_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data,
+                                                               const std::type_info& ti, const void* pv) {
+  if (ti == typeid(FramePlacement)) {
+    Data* d = static_cast<Data*>(data.get());
+    d->Mref = *static_cast<const FramePlacement*>(pv);
+    d->oMf_inv = d->Mref.placement.inverse();
+    d->has_reference = true;
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be FramePlacement)");
+  }
+}
+
+template <typename Scalar>
+void CostModelFramePlacementTpl<Scalar>::get_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data,
+                                                               const std::type_info& ti, void* pv) const {
+  if (ti == typeid(FramePlacement)) {
+    Data* d = static_cast<Data*>(data.get());
+    FramePlacement& ref_map = *static_cast<FramePlacement*>(pv);
+    ref_map = d->has_reference ? d->Mref : Mref_;
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be FramePlacement)");
+  }
+}
+
 template <typename Scalar>
 const FramePlacementTpl<Scalar>& CostModelFramePlacementTpl<Scalar>::get_Mref() const {
   return Mref_;
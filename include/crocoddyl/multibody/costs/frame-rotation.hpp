@@ -128,6 +128,11 @@ class CostModelFrameRotationTpl : public CostModelAbstractTpl<_Scalar> {
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
 
+  /**
+   * @brief Clone the frame rotation cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
   DEPRECATED("Use set_reference<FrameRotationTpl<Scalar> >()", void set_Rref(const FrameRotation& Rref_in));
   DEPRECATED("Use get_reference<FrameRotationTpl<Scalar> >()", const FrameRotation& get_Rref() const);
 
@@ -145,7 +150,9 @@ class CostModelFrameRotationTpl : public CostModelAbstractTpl<_Scalar> {
   using Base::activation_;
   using Base::nu_;
   using Base::state_;
+  using Base::u_dependent_;
   using Base::unone_;
+  using Base::v_dependent_;
 
  private:
   FrameRotation Rref_;                                                    //!< Reference frame rotation
@@ -21,6 +21,8 @@ CostModelFrameRotationTpl<Scalar>::CostModelFrameRotationTpl(boost::shared_ptr<S
       Rref_(Rref),
       oRf_inv_(Rref.rotation.transpose()),
       pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
   if (activation_->get_nr() != 3) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 3");
@@ -32,6 +34,8 @@ CostModelFrameRotationTpl<Scalar>::CostModelFrameRotationTpl(boost::shared_ptr<S
                                                              boost::shared_ptr<ActivationModelAbstract> activation,
                                                              const FrameRotation& Rref)
     : Base(state, activation), Rref_(Rref), oRf_inv_(Rref.rotation.transpose()), pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
   if (activation_->get_nr() != 3) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 3");
@@ -41,12 +45,18 @@ CostModelFrameRotationTpl<Scalar>::CostModelFrameRotationTpl(boost::shared_ptr<S
 template <typename Scalar>
 CostModelFrameRotationTpl<Scalar>::CostModelFrameRotationTpl(boost::shared_ptr<StateMultibody> state,
                                                              const FrameRotation& Rref, const std::size_t& nu)
-    : Base(state, 3, nu), Rref_(Rref), oRf_inv_(Rref.rotation.transpose()), pin_model_(state->get_pinocchio()) {}
+    : Base(state, 3, nu), Rref_(Rref), oRf_inv_(Rref.rotation.transpose()), pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelFrameRotationTpl<Scalar>::CostModelFrameRotationTpl(boost::shared_ptr<StateMultibody> state,
                                                              const FrameRotation& Rref)
-    : Base(state, 3), Rref_(Rref), oRf_inv_(Rref.rotation.transpose()), pin_model_(state->get_pinocchio()) {}
+    : Base(state, 3), Rref_(Rref), oRf_inv_(Rref.rotation.transpose()), pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelFrameRotationTpl<Scalar>::~CostModelFrameRotationTpl() {}
@@ -94,6 +104,14 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelFrameRotationTpl<Scalar
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelFrameRotationTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelFrameRotationTpl> model =
+      boost::allocate_shared<CostModelFrameRotationTpl>(Eigen::aligned_allocator<CostModelFrameRotationTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelFrameRotationTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FrameRotation)) {
@@ -124,6 +124,14 @@ class CostModelFrameTranslationTpl : public CostModelAbstractTpl<_Scalar> {
    * @brief Create the frame translation cost data
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
+  virtual void copyNodeParameters(const boost::shared_ptr<CostDataAbstract>& from,
+                                  const boost::shared_ptr<CostDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<CostDataAbstract>& data) const;
+
+  /**
+   * @brief Clone the frame translation cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
 
   DEPRECATED("Use set_reference<FrameTranslation<Scalar> >()", void set_xref(const FrameTranslation& xref_in));
   DEPRECATED("Use get_reference<FrameTranslation<Scalar> >()", const FrameTranslation& get_xref() const);
@@ -139,10 +147,24 @@ class CostModelFrameTranslationTpl : public CostModelAbstractTpl<_Scalar> {
    */
   virtual void get_referenceImpl(const std::type_info& ti, void* pv) const;
 
+  /**
+   * @brief Modify the frame translation reference of a given node
+   */
+  virtual void set_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data, const std::type_info& ti,
+                                     const void* pv);
+
+  /**
+   * @brief Return the frame translation reference used by a given node
+   */
+  virtual void get_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data, const std::type_info& ti,
+                                     void* pv) const;
+
   using Base::activation_;
   using Base::nu_;
   using Base::state_;
+  using Base::u_dependent_;
   using Base::unone_;
+  using Base::v_dependent_;
 
  private:
   FrameTranslation xref_;                                                 //!< Reference frame translation
@@ -162,7 +184,10 @@ struct CostDataFrameTranslationTpl : public CostDataAbstractTpl<_Scalar> {
 
   template <template <typename Scalar> class Model>
   CostDataFrameTranslationTpl(Model<Scalar>* const model, DataCollectorAbstract* const data)
-      : Base(model, data), J(3, model->get_state()->get_nv()), fJf(6, model->get_state()->get_nv()) {
+      : Base(model, data),
+        J(3, model->get_state()->get_nv()),
+        fJf(6, model->get_state()->get_nv()),
+        has_reference(false) {
     J.setZero();
     fJf.setZero();
     // Check that proper shared data has been passed
@@ -178,6 +203,8 @@ struct CostDataFrameTranslationTpl : public CostDataAbstractTpl<_Scalar> {
   pinocchio::DataTpl<Scalar>* pinocchio;
   Matrix3xs J;
   Matrix6xs fJf;
+  FrameTranslationTpl<Scalar> xref;  //!< Reference frame translation of the node
+  bool has_reference;                //!< Indicates if the node uses its own reference
 
   using Base::activation;
   using Base::cost;
@@ -18,6 +18,8 @@ CostModelFrameTranslationTpl<Scalar>::CostModelFrameTranslationTpl(
     boost::shared_ptr<StateMultibody> state, boost::shared_ptr<ActivationModelAbstract> activation,
     const FrameTranslation& xref, const std::size_t& nu)
     : Base(state, activation, nu), xref_(xref), pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
   if (activation_->get_nr() != 3) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 3");
@@ -29,6 +31,8 @@ CostModelFrameTranslationTpl<Scalar>::CostModelFrameTranslationTpl(
     boost::shared_ptr<StateMultibody> state, boost::shared_ptr<ActivationModelAbstract> activation,
     const FrameTranslation& xref)
     : Base(state, activation), xref_(xref), pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
   if (activation_->get_nr() != 3) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 3");
@@ -38,12 +42,18 @@ CostModelFrameTranslationTpl<Scalar>::CostModelFrameTranslationTpl(
 template <typename Scalar>
 CostModelFrameTranslationTpl<Scalar>::CostModelFrameTranslationTpl(boost::shared_ptr<StateMultibody> state,
                                                                    const FrameTranslation& xref, const std::size_t& nu)
-    : Base(state, 3, nu), xref_(xref), pin_model_(state->get_pinocchio()) {}
+    : Base(state, 3, nu), xref_(xref), pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelFrameTranslationTpl<Scalar>::CostModelFrameTranslationTpl(boost::shared_ptr<StateMultibody> state,
                                                                    const FrameTranslation& xref)
-    : Base(state, 3), xref_(xref), pin_model_(state->get_pinocchio()) {}
+    : Base(state, 3), xref_(xref), pin_model_(state->get_pinocchio()) {
+  v_dependent_ = false;
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelFrameTranslationTpl<Scalar>::~CostModelFrameTranslationTpl() {}
@@ -53,8 +63,9 @@ void CostModelFrameTranslationTpl<Scalar>::calc(const boost::shared_ptr<CostData
                                                 const Eigen::Ref<const VectorXs>&, const Eigen::Ref<const VectorXs>&) {
   // Compute the frame translation w.r.t. the reference frame
   Data* d = static_cast<Data*>(data.get());
-  pinocchio::updateFramePlacement(*pin_model_.get(), *d->pinocchio, xref_.id);
-  data->r = d->pinocchio->oMf[xref_.id].translation() - xref_.translation;
+  const FrameTranslation& xref = d->has_reference ? d->xref : xref_;
+  pinocchio::updateFramePlacement(*pin_model_.get(), *d->pinocchio, xref.id);
+  data->r = d->pinocchio->oMf[xref.id].translation() - xref.translation;
 
   // Compute the cost
   activation_->calc(data->activation, data->r);
@@ -69,8 +80,9 @@ void CostModelFrameTranslationTpl<Scalar>::calcDiff(const boost::shared_ptr<Cost
   Data* d = static_cast<Data*>(data.get());
 
   // Compute the frame Jacobian at the error point
-  pinocchio::getFrameJacobian(*pin_model_.get(), *d->pinocchio, xref_.id, pinocchio::LOCAL, d->fJf);
-  d->J = d->pinocchio->oMf[xref_.id].rotation() * d->fJf.template topRows<3>();
+  const FrameIndex id = d->has_reference ? d->xref.id : xref_.id;
+  pinocchio::getFrameJacobian(*pin_model_.get(), *d->pinocchio, id, pinocchio::LOCAL, d->fJf);
+  d->J = d->pinocchio->oMf[id].rotation() * d->fJf.template topRows<3>();
 
   // Compute the derivatives of the frame placement
   const std::size_t& nv = state_->get_nv();
@@ -86,6 +98,30 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelFrameTranslationTpl<Sca
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelFrameTranslationTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelFrameTranslationTpl> model =
+      boost::allocate_shared<CostModelFrameTranslationTpl>(
+          Eigen::aligned_allocator<CostModelFrameTranslationTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
+template <typename Scalar>
+void CostModelFrameTranslationTpl<Scalar>::copyNodeParameters(const boost::shared_ptr<CostDataAbstract>& from,
+                                                              const boost::shared_ptr<CostDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  d_to->xref = d_from->xref;
+  d_to->has_reference = d_from->has_reference;
+}
+
+template <typename Scalar>
+void CostModelFrameTranslationTpl<Scalar>::resetNodeParameters(const boost::shared_ptr<CostDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  d->has_reference = false;
+}
+
 template <typename Scalar>
 void CostModelFrameTranslationTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FrameTranslation)) {
@@ -105,6 +141,30 @@ void CostModelFrameTranslationTpl<Scalar>::get_referenceImpl(const std::type_inf
   }
 }
 
+template <typename Scalar>
+void CostModelFrameTranslationTpl<Scalar>::set_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data,
+                                                                 const std::type_info& ti, const void* pv) {
+  if (ti == typeid(FrameTranslation)) {
+    Data* d = static_cast<Data*>(data.get());
+    d->xref = *static_cast<const FrameTranslation*>(pv);
+    d->has_reference = true;
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be FrameTranslation)");
+  }
+}
+
+template <typename Scalar>
+void CostModelFrameTranslationTpl<Scalar>::get_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data,
+                                                                 const std::type_info& ti, void* pv) const {
+  if (ti == typeid(FrameTranslation)) {
+    Data* d = static_cast<Data*>(data.get());
+    FrameTranslation& ref_map = *static_cast<FrameTranslation*>(pv);
+    ref_map = d->has_reference ? d->xref : xref_;
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be FrameTranslation)");
+  }
+}
+
 template <typename Scalar>
 const FrameTranslationTpl<Scalar>& CostModelFrameTranslationTpl<Scalar>::get_xref() const {
   return xref_;
@@ -124,6 +124,11 @@ class CostModelFrameVelocityTpl : public CostModelAbstractTpl<_Scalar> {
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
 
+  /**
+   * @brief Clone the frame velocity cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
   DEPRECATED("Use set_reference<FrameMotionTpl<Scalar> >()", void set_vref(const FrameMotion& vref_in));
   DEPRECATED("Use get_reference<FrameMotionTpl<Scalar> >()", const FrameMotion& get_vref() const);
 
@@ -141,6 +146,7 @@ class CostModelFrameVelocityTpl : public CostModelAbstractTpl<_Scalar> {
   using Base::activation_;
   using Base::nu_;
   using Base::state_;
+  using Base::u_dependent_;
   using Base::unone_;
 
  private:
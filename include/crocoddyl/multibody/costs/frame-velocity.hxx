@@ -20,6 +20,7 @@ CostModelFrameVelocityTpl<Scalar>::CostModelFrameVelocityTpl(boost::shared_ptr<S
                                                              boost::shared_ptr<ActivationModelAbstract> activation,
                                                              const FrameMotion& vref, const std::size_t& nu)
     : Base(state, activation, nu), vref_(vref), pin_model_(state->get_pinocchio()) {
+  u_dependent_ = false;
   if (activation_->get_nr() != 6) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 6");
@@ -31,6 +32,7 @@ CostModelFrameVelocityTpl<Scalar>::CostModelFrameVelocityTpl(boost::shared_ptr<S
                                                              boost::shared_ptr<ActivationModelAbstract> activation,
                                                              const FrameMotion& vref)
     : Base(state, activation), vref_(vref), pin_model_(state->get_pinocchio()) {
+  u_dependent_ = false;
   if (activation_->get_nr() != 6) {
     throw_pretty("Invalid argument: "
                  << "nr is equals to 6");
@@ -40,12 +42,16 @@ CostModelFrameVelocityTpl<Scalar>::CostModelFrameVelocityTpl(boost::shared_ptr<S
 template <typename Scalar>
 CostModelFrameVelocityTpl<Scalar>::CostModelFrameVelocityTpl(boost::shared_ptr<StateMultibody> state,
                                                              const FrameMotion& vref, const std::size_t& nu)
-    : Base(state, 6, nu), vref_(vref), pin_model_(state->get_pinocchio()) {}
+    : Base(state, 6, nu), vref_(vref), pin_model_(state->get_pinocchio()) {
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelFrameVelocityTpl<Scalar>::CostModelFrameVelocityTpl(boost::shared_ptr<StateMultibody> state,
                                                              const FrameMotion& vref)
-    : Base(state, 6), vref_(vref), pin_model_(state->get_pinocchio()) {}
+    : Base(state, 6), vref_(vref), pin_model_(state->get_pinocchio()) {
+  u_dependent_ = false;
+}
 
 template <typename Scalar>
 CostModelFrameVelocityTpl<Scalar>::~CostModelFrameVelocityTpl() {}
@@ -87,6 +93,14 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelFrameVelocityTpl<Scalar
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelFrameVelocityTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelFrameVelocityTpl> model =
+      boost::allocate_shared<CostModelFrameVelocityTpl>(Eigen::aligned_allocator<CostModelFrameVelocityTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelFrameVelocityTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FrameMotion)) {
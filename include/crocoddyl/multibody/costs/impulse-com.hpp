@@ -96,6 +96,11 @@ class CostModelImpulseCoMTpl : public CostModelAbstractTpl<_Scalar> {
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
 
+  /**
+   * @brief Clone the impulse CoM cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
  protected:
   using Base::activation_;
   using Base::nu_;
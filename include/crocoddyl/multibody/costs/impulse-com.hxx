@@ -78,4 +78,12 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelImpulseCoMTpl<Scalar>::
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelImpulseCoMTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelImpulseCoMTpl> model =
+      boost::allocate_shared<CostModelImpulseCoMTpl>(Eigen::aligned_allocator<CostModelImpulseCoMTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 }  // namespace crocoddyl
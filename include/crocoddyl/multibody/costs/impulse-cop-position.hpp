@@ -134,6 +134,11 @@ class CostModelImpulseCoPPositionTpl : public CostModelAbstractTpl<_Scalar> {
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
 
+  /**
+   * @brief Clone the impulse CoP cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
+
  protected:
   /**
    * @brief Return the frame CoP support
@@ -73,6 +73,15 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelImpulseCoPPositionTpl<S
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelImpulseCoPPositionTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelImpulseCoPPositionTpl> model =
+      boost::allocate_shared<CostModelImpulseCoPPositionTpl>(
+          Eigen::aligned_allocator<CostModelImpulseCoPPositionTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelImpulseCoPPositionTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FrameCoPSupport)) {
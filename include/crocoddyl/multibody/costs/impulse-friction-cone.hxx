@@ -70,6 +70,15 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelImpulseFrictionConeTpl<
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelImpulseFrictionConeTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelImpulseFrictionConeTpl> model =
+      boost::allocate_shared<CostModelImpulseFrictionConeTpl>(
+          Eigen::aligned_allocator<CostModelImpulseFrictionConeTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelImpulseFrictionConeTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FrameFrictionCone)) {
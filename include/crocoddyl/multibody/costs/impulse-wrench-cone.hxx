@@ -68,6 +68,15 @@ boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelImpulseWrenchConeTpl<Sc
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelImpulseWrenchConeTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelImpulseWrenchConeTpl> model =
+      boost::allocate_shared<CostModelImpulseWrenchConeTpl>(
+          Eigen::aligned_allocator<CostModelImpulseWrenchConeTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
 template <typename Scalar>
 void CostModelImpulseWrenchConeTpl<Scalar>::set_referenceImpl(const std::type_info& ti, const void* pv) {
   if (ti == typeid(FrameWrenchCone)) {
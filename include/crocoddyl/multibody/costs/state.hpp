@@ -43,6 +43,7 @@ class CostModelStateTpl : public CostModelAbstractTpl<_Scalar> {
   typedef _Scalar Scalar;
   typedef MathBaseTpl<Scalar> MathBase;
   typedef CostModelAbstractTpl<Scalar> Base;
+  typedef CostDataStateTpl<Scalar> Data;
   typedef StateMultibodyTpl<Scalar> StateMultibody;
   typedef CostDataAbstractTpl<Scalar> CostDataAbstract;
   typedef ActivationModelAbstractTpl<Scalar> ActivationModelAbstract;
@@ -168,6 +169,14 @@ class CostModelStateTpl : public CostModelAbstractTpl<_Scalar> {
    * @brief Create the state cost data
    */
   virtual boost::shared_ptr<CostDataAbstract> createData(DataCollectorAbstract* const data);
+  virtual void copyNodeParameters(const boost::shared_ptr<CostDataAbstract>& from,
+                                  const boost::shared_ptr<CostDataAbstract>& to) const;
+  virtual void resetNodeParameters(const boost::shared_ptr<CostDataAbstract>& data) const;
+
+  /**
+   * @brief Clone the state cost
+   */
+  virtual boost::shared_ptr<Base> clone() const;
 
   DEPRECATED("Use set_reference<MathBaseTpl<Scalar>::VectorXs>()", void set_xref(const VectorXs& xref_in));
   DEPRECATED("Use get_reference<MathBaseTpl<Scalar>::VectorXs>()", const VectorXs& get_xref() const);
@@ -183,9 +192,22 @@ class CostModelStateTpl : public CostModelAbstractTpl<_Scalar> {
    */
   virtual void get_referenceImpl(const std::type_info& ti, void* pv) const;
 
+  /**
+   * @brief Modify the state reference of a given node
+   */
+  virtual void set_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data, const std::type_info& ti,
+                                     const void* pv);
+
+  /**
+   * @brief Return the state reference used by a given node
+   */
+  virtual void get_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data, const std::type_info& ti,
+                                     void* pv) const;
+
   using Base::activation_;
   using Base::nu_;
   using Base::state_;
+  using Base::u_dependent_;
   using Base::unone_;
 
  private:
@@ -201,15 +223,20 @@ struct CostDataStateTpl : public CostDataAbstractTpl<_Scalar> {
   typedef MathBaseTpl<Scalar> MathBase;
   typedef CostDataAbstractTpl<Scalar> Base;
   typedef DataCollectorAbstractTpl<Scalar> DataCollectorAbstract;
+  typedef typename MathBase::VectorXs VectorXs;
   typedef typename MathBase::MatrixXs MatrixXs;
 
   template <template <typename Scalar> class Model>
   CostDataStateTpl(Model<Scalar>* const model, DataCollectorAbstract* const data)
-      : Base(model, data), Arr_Rx(model->get_activation()->get_nr(), model->get_state()->get_ndx()) {
+      : Base(model, data),
+        Arr_Rx(model->get_activation()->get_nr(), model->get_state()->get_ndx()),
+        has_reference(false) {
     Arr_Rx.setZero();
   }
 
   MatrixXs Arr_Rx;
+  VectorXs xref;       //!< Reference state of the node
+  bool has_reference;  //!< Indicates if the node uses its own reference
 
   using Base::activation;
   using Base::cost;
@@ -16,6 +16,7 @@ CostModelStateTpl<Scalar>::CostModelStateTpl(boost::shared_ptr<typename Base::St
                                              boost::shared_ptr<ActivationModelAbstract> activation,
                                              const VectorXs& xref, const std::size_t& nu)
     : Base(state, activation, nu), xref_(xref) {
+  u_dependent_ = false;
   if (static_cast<std::size_t>(xref_.size()) != state_->get_nx()) {
     throw_pretty("Invalid argument: "
                  << "xref has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
@@ -36,6 +37,7 @@ CostModelStateTpl<Scalar>::CostModelStateTpl(boost::shared_ptr<typename Base::St
                                              boost::shared_ptr<ActivationModelAbstract> activation,
                                              const VectorXs& xref)
     : Base(state, activation), xref_(xref) {
+  u_dependent_ = false;
   if (static_cast<std::size_t>(xref_.size()) != state_->get_nx()) {
     throw_pretty("Invalid argument: "
                  << "xref has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
@@ -55,6 +57,7 @@ template <typename Scalar>
 CostModelStateTpl<Scalar>::CostModelStateTpl(boost::shared_ptr<typename Base::StateAbstract> state,
                                              const VectorXs& xref, const std::size_t& nu)
     : Base(state, state->get_ndx(), nu), xref_(xref) {
+  u_dependent_ = false;
   if (static_cast<std::size_t>(xref_.size()) != state_->get_nx()) {
     throw_pretty("Invalid argument: "
                  << "xref has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
@@ -74,6 +77,7 @@ template <typename Scalar>
 CostModelStateTpl<Scalar>::CostModelStateTpl(boost::shared_ptr<typename Base::StateAbstract> state,
                                              const VectorXs& xref)
     : Base(state, state->get_ndx()), xref_(xref) {
+  u_dependent_ = false;
   if (static_cast<std::size_t>(xref_.size()) != state_->get_nx()) {
     throw_pretty("Invalid argument: "
                  << "xref has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
@@ -94,6 +98,7 @@ CostModelStateTpl<Scalar>::CostModelStateTpl(boost::shared_ptr<typename Base::St
                                              boost::shared_ptr<ActivationModelAbstract> activation,
                                              const std::size_t& nu)
     : Base(state, activation, nu), xref_(state->zero()) {
+  u_dependent_ = false;
   if (static_cast<std::size_t>(xref_.size()) != state_->get_nx()) {
     throw_pretty("Invalid argument: "
                  << "xref has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
@@ -113,6 +118,7 @@ template <typename Scalar>
 CostModelStateTpl<Scalar>::CostModelStateTpl(boost::shared_ptr<typename Base::StateAbstract> state,
                                              const std::size_t& nu)
     : Base(state, state->get_ndx(), nu), xref_(state->zero()) {
+  u_dependent_ = false;
   if (static_cast<std::size_t>(xref_.size()) != state_->get_nx()) {
     throw_pretty("Invalid argument: "
                  << "xref has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
@@ -132,6 +138,7 @@ template <typename Scalar>
 CostModelStateTpl<Scalar>::CostModelStateTpl(boost::shared_ptr<typename Base::StateAbstract> state,
                                              boost::shared_ptr<ActivationModelAbstract> activation)
     : Base(state, activation), xref_(state->zero()) {
+  u_dependent_ = false;
   if (static_cast<std::size_t>(xref_.size()) != state_->get_nx()) {
     throw_pretty("Invalid argument: "
                  << "xref has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
@@ -150,6 +157,7 @@ CostModelStateTpl<Scalar>::CostModelStateTpl(boost::shared_ptr<typename Base::St
 template <typename Scalar>
 CostModelStateTpl<Scalar>::CostModelStateTpl(boost::shared_ptr<typename Base::StateAbstract> state)
     : Base(state, state->get_ndx()), xref_(state->zero()) {
+  u_dependent_ = false;
   if (static_cast<std::size_t>(xref_.size()) != state_->get_nx()) {
     throw_pretty("Invalid argument: "
                  << "xref has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
@@ -176,7 +184,8 @@ void CostModelStateTpl<Scalar>::calc(const boost::shared_ptr<CostDataAbstract>&
                  << "x has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
   }
 
-  state_->diff(xref_, x, data->r);
+  Data* d = static_cast<Data*>(data.get());
+  state_->diff(d->has_reference ? d->xref : xref_, x, data->r);
   activation_->calc(data->activation, data->r);
   data->cost = data->activation->a_value;
 }
@@ -189,7 +198,8 @@ void CostModelStateTpl<Scalar>::calcDiff(const boost::shared_ptr<CostDataAbstrac
                  << "x has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
   }
 
-  state_->Jdiff(xref_, x, data->Rx, data->Rx, second);
+  Data* d = static_cast<Data*>(data.get());
+  state_->Jdiff(d->has_reference ? d->xref : xref_, x, data->Rx, data->Rx, second);
   activation_->calcDiff(data->activation, data->r);
 
   if (pin_model_) {
@@ -214,7 +224,30 @@ void CostModelStateTpl<Scalar>::calcDiff(const boost::shared_ptr<CostDataAbstrac
 template <typename Scalar>
 boost::shared_ptr<CostDataAbstractTpl<Scalar> > CostModelStateTpl<Scalar>::createData(
     DataCollectorAbstract* const data) {
-  return boost::make_shared<CostDataStateTpl<Scalar> >(this, data);
+  return boost::make_shared<Data>(this, data);
+}
+
+template <typename Scalar>
+boost::shared_ptr<CostModelAbstractTpl<Scalar> > CostModelStateTpl<Scalar>::clone() const {
+  boost::shared_ptr<CostModelStateTpl> model =
+      boost::allocate_shared<CostModelStateTpl>(Eigen::aligned_allocator<CostModelStateTpl>(), *this);
+  model->activation_ = activation_->clone();
+  return model;
+}
+
+template <typename Scalar>
+void CostModelStateTpl<Scalar>::copyNodeParameters(const boost::shared_ptr<CostDataAbstract>& from,
+                                                   const boost::shared_ptr<CostDataAbstract>& to) const {
+  Data* d_from = static_cast<Data*>(from.get());
+  Data* d_to = static_cast<Data*>(to.get());
+  d_to->xref = d_from->xref;
+  d_to->has_reference = d_from->has_reference;
+}
+
+template <typename Scalar>
+void CostModelStateTpl<Scalar>::resetNodeParameters(const boost::shared_ptr<CostDataAbstract>& data) const {
+  Data* d = static_cast<Data*>(data.get());
+  d->has_reference = false;
 }
 
 template <typename Scalar>
@@ -244,6 +277,39 @@ void CostModelStateTpl<Scalar>::get_referenceImpl(const std::type_info& ti, void
   }
 }
 
+template <typename Scalar>
+void CostModelStateTpl<Scalar>::set_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data,
+                                                      const std::type_info& ti, const void* pv) {
+  if (ti == typeid(VectorXs)) {
+    if (static_cast<std::size_t>(static_cast<const VectorXs*>(pv)->size()) != state_->get_nx()) {
+      throw_pretty("Invalid argument: "
+                   << "reference has wrong dimension (it should be " + std::to_string(state_->get_nx()) + ")");
+    }
+    Data* d = static_cast<Data*>(data.get());
+    d->xref = *static_cast<const VectorXs*>(pv);
+    d->has_reference = true;
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be VectorXs)");
+  }
+}
+
+template <typename Scalar>
+void CostModelStateTpl<Scalar>::get_nodeReferenceImpl(const boost::shared_ptr<CostDataAbstract>& data,
+                                                      const std::type_info& ti, void* pv) const {
+  if (ti == typeid(VectorXs)) {
+    Data* d = static_cast<Data*>(data.get());
+    const VectorXs& xref = d->has_reference ? d->xref : xref_;
+    VectorXs& tmp = *static_cast<VectorXs*>(pv);
+    tmp.resize(state_->get_nx());
+    Eigen::Map<VectorXs> ref_map(static_cast<VectorXs*>(pv)->data(), state_->get_nx());
+    for (std::size_t i = 0; i < state_->get_nx(); ++i) {
+      ref_map[i] = xref[i];
+    }
+  } else {
+    throw_pretty("Invalid argument: incorrect type (it should be VectorXs)");
+  }
+}
+
 template <typename Scalar>
 const typename MathBaseTpl<Scalar>::VectorXs& CostModelStateTpl<Scalar>::get_xref() const {
   return xref_;
@@ -32,12 +32,20 @@ template <typename Scalar>
 class ActionModelImpulseFwdDynamicsTpl;
 template <typename Scalar>
 struct ActionDataImpulseFwdDynamicsTpl;
+template <typename Scalar>
+class ActionModelCentroidalTransitionTpl;
+template <typename Scalar>
+struct ActionDataCentroidalTransitionTpl;
 
 // differential action
 template <typename Scalar>
 class DifferentialActionModelFreeFwdDynamicsTpl;
 template <typename Scalar>
 struct DifferentialActionDataFreeFwdDynamicsTpl;
+template <typename Scalar>
+class DifferentialActionModelCentroidalFwdDynamicsTpl;
+template <typename Scalar>
+struct DifferentialActionDataCentroidalFwdDynamicsTpl;
 
 template <typename Scalar>
 class DifferentialActionModelContactFwdDynamicsTpl;
@@ -96,6 +104,17 @@ class CostModelCoMPositionTpl;
 template <typename Scalar>
 struct CostDataCoMPositionTpl;
 
+template <typename Scalar>
+class CostModelCentroidalCoMPositionTpl;
+
+template <typename Scalar>
+class CostModelCentroidalContactForceTpl;
+
+template <typename Scalar>
+class CostModelCentroidalFrictionConeTpl;
+template <typename Scalar>
+struct CostDataCentroidalFrictionConeTpl;
+
 template <typename Scalar>
 class CostModelFramePlacementTpl;
 template <typename Scalar>
@@ -251,11 +270,15 @@ typedef ContactDataAbstractTpl<double> ContactDataAbstract;
 
 typedef ActionModelImpulseFwdDynamicsTpl<double> ActionModelImpulseFwdDynamics;
 typedef ActionDataImpulseFwdDynamicsTpl<double> ActionDataImpulseFwdDynamics;
+typedef ActionModelCentroidalTransitionTpl<double> ActionModelCentroidalTransition;
+typedef ActionDataCentroidalTransitionTpl<double> ActionDataCentroidalTransition;
 
 typedef DifferentialActionModelFreeFwdDynamicsTpl<double> DifferentialActionModelFreeFwdDynamics;
 typedef DifferentialActionDataFreeFwdDynamicsTpl<double> DifferentialActionDataFreeFwdDynamics;
 typedef DifferentialActionModelContactFwdDynamicsTpl<double> DifferentialActionModelContactFwdDynamics;
 typedef DifferentialActionDataContactFwdDynamicsTpl<double> DifferentialActionDataContactFwdDynamics;
+typedef DifferentialActionModelCentroidalFwdDynamicsTpl<double> DifferentialActionModelCentroidalFwdDynamics;
+typedef DifferentialActionDataCentroidalFwdDynamicsTpl<double> DifferentialActionDataCentroidalFwdDynamics;
 
 typedef CostModelNumDiffTpl<double> CostModelNumDiff;
 typedef CostDataNumDiffTpl<double> CostDataNumDiff;
@@ -280,6 +303,10 @@ typedef CostModelCentroidalMomentumTpl<double> CostModelCentroidalMomentum;
 typedef CostDataCentroidalMomentumTpl<double> CostDataCentroidalMomentum;
 typedef CostModelCoMPositionTpl<double> CostModelCoMPosition;
 typedef CostDataCoMPositionTpl<double> CostDataCoMPosition;
+typedef CostModelCentroidalCoMPositionTpl<double> CostModelCentroidalCoMPosition;
+typedef CostModelCentroidalContactForceTpl<double> CostModelCentroidalContactForce;
+typedef CostModelCentroidalFrictionConeTpl<double> CostModelCentroidalFrictionCone;
+typedef CostDataCentroidalFrictionConeTpl<double> CostDataCentroidalFrictionCone;
 typedef CostModelFramePlacementTpl<double> CostModelFramePlacement;
 typedef CostDataFramePlacementTpl<double> CostDataFramePlacement;
 typedef CostModelImpulseCoMTpl<double> CostModelImpulseCoM;
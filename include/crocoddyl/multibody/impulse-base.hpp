@@ -42,6 +42,7 @@ class ImpulseModelAbstractTpl {
   void setZeroForceDiff(const boost::shared_ptr<ImpulseDataAbstract>& data) const;
 
   virtual boost::shared_ptr<ImpulseDataAbstract> createData(pinocchio::DataTpl<Scalar>* const data);
+  virtual boost::shared_ptr<ImpulseModelAbstractTpl<Scalar> > clone() const;
 
   const boost::shared_ptr<StateMultibody>& get_state() const;
   const std::size_t& get_ni() const;
@@ -44,6 +44,11 @@ boost::shared_ptr<ImpulseDataAbstractTpl<Scalar> > ImpulseModelAbstractTpl<Scala
   return boost::allocate_shared<ImpulseDataAbstract>(Eigen::aligned_allocator<ImpulseDataAbstract>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ImpulseModelAbstractTpl<Scalar> > ImpulseModelAbstractTpl<Scalar>::clone() const {
+  throw_pretty("It has not been implemented the clone() function");
+}
+
 template <typename Scalar>
 const boost::shared_ptr<StateMultibodyTpl<Scalar> >& ImpulseModelAbstractTpl<Scalar>::get_state() const {
   return state_;
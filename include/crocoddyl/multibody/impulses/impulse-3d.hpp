@@ -40,6 +40,7 @@ class ImpulseModel3DTpl : public ImpulseModelAbstractTpl<_Scalar> {
   virtual void calcDiff(const boost::shared_ptr<ImpulseDataAbstract>& data, const Eigen::Ref<const VectorXs>& x);
   virtual void updateForce(const boost::shared_ptr<ImpulseDataAbstract>& data, const VectorXs& force);
   virtual boost::shared_ptr<ImpulseDataAbstract> createData(pinocchio::DataTpl<Scalar>* const data);
+  virtual boost::shared_ptr<Base> clone() const;
 
   const std::size_t& get_frame() const;
 
@@ -24,7 +24,7 @@ ImpulseModel3DTpl<Scalar>::~ImpulseModel3DTpl() {}
 template <typename Scalar>
 void ImpulseModel3DTpl<Scalar>::calc(const boost::shared_ptr<ImpulseDataAbstract>& data,
                                      const Eigen::Ref<const VectorXs>&) {
-  boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+  Data* d = static_cast<Data*>(data.get());
 
   pinocchio::getFrameJacobian(*state_->get_pinocchio().get(), *d->pinocchio, frame_, pinocchio::LOCAL, d->fJf);
   d->Jc = d->fJf.template topRows<3>();
@@ -33,7 +33,7 @@ void ImpulseModel3DTpl<Scalar>::calc(const boost::shared_ptr<ImpulseDataAbstract
 template <typename Scalar>
 void ImpulseModel3DTpl<Scalar>::calcDiff(const boost::shared_ptr<ImpulseDataAbstract>& data,
                                          const Eigen::Ref<const VectorXs>&) {
-  boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+  Data* d = static_cast<Data*>(data.get());
   pinocchio::getJointVelocityDerivatives(*state_->get_pinocchio().get(), *d->pinocchio, d->joint, pinocchio::LOCAL,
                                          d->v_partial_dq, d->v_partial_dv);
   d->dv0_dq.noalias() = d->fXj.template topRows<3>() * d->v_partial_dq;
@@ -55,6 +55,11 @@ boost::shared_ptr<ImpulseDataAbstractTpl<Scalar> > ImpulseModel3DTpl<Scalar>::cr
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ImpulseModelAbstractTpl<Scalar> > ImpulseModel3DTpl<Scalar>::clone() const {
+  return boost::allocate_shared<ImpulseModel3DTpl>(Eigen::aligned_allocator<ImpulseModel3DTpl>(), *this);
+}
+
 template <typename Scalar>
 const std::size_t& ImpulseModel3DTpl<Scalar>::get_frame() const {
   return frame_;
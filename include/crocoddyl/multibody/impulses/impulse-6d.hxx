@@ -23,7 +23,7 @@ ImpulseModel6DTpl<Scalar>::~ImpulseModel6DTpl() {}
 template <typename Scalar>
 void ImpulseModel6DTpl<Scalar>::calc(const boost::shared_ptr<ImpulseDataAbstract>& data,
                                      const Eigen::Ref<const VectorXs>&) {
-  boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+  Data* d = static_cast<Data*>(data.get());
 
   pinocchio::getFrameJacobian(*state_->get_pinocchio().get(), *d->pinocchio, frame_, pinocchio::LOCAL, d->Jc);
 }
@@ -31,7 +31,7 @@ void ImpulseModel6DTpl<Scalar>::calc(const boost::shared_ptr<ImpulseDataAbstract
 template <typename Scalar>
 void ImpulseModel6DTpl<Scalar>::calcDiff(const boost::shared_ptr<ImpulseDataAbstract>& data,
                                          const Eigen::Ref<const VectorXs>&) {
-  boost::shared_ptr<Data> d = boost::static_pointer_cast<Data>(data);
+  Data* d = static_cast<Data*>(data.get());
   pinocchio::getJointVelocityDerivatives(*state_->get_pinocchio().get(), *d->pinocchio, d->joint, pinocchio::LOCAL,
                                          d->v_partial_dq, d->v_partial_dv);
   d->dv0_dq.noalias() = d->fXj * d->v_partial_dq;
@@ -52,6 +52,11 @@ boost::shared_ptr<ImpulseDataAbstractTpl<Scalar> > ImpulseModel6DTpl<Scalar>::cr
     pinocchio::DataTpl<Scalar>* const data) {
   return boost::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this, data);
 }
+
+template <typename Scalar>
+boost::shared_ptr<ImpulseModelAbstractTpl<Scalar> > ImpulseModel6DTpl<Scalar>::clone() const {
+  return boost::allocate_shared<ImpulseModel6DTpl>(Eigen::aligned_allocator<ImpulseModel6DTpl>(), *this);
+}
 template <typename Scalar>
 const std::size_t& ImpulseModel6DTpl<Scalar>::get_frame() const {
   return frame_;
@@ -158,6 +158,15 @@ class ImpulseModelMultipleTpl {
    */
   boost::shared_ptr<ImpulseDataMultiple> createData(pinocchio::DataTpl<Scalar>* const data);
 
+  /**
+   * @brief Clone the multi-impulse model
+   *
+   * The cloned model has its own copy of each impulse item, whose impulse model is cloned as well.
+   *
+   * @return the cloned multi-impulse model
+   */
+  boost::shared_ptr<ImpulseModelMultipleTpl<Scalar> > clone() const;
+
   /**
    * @brief Return the multibody state
    */
@@ -230,6 +230,17 @@ boost::shared_ptr<ImpulseDataMultipleTpl<Scalar> > ImpulseModelMultipleTpl<Scala
   return boost::allocate_shared<ImpulseDataMultiple>(Eigen::aligned_allocator<ImpulseDataMultiple>(), this, data);
 }
 
+template <typename Scalar>
+boost::shared_ptr<ImpulseModelMultipleTpl<Scalar> > ImpulseModelMultipleTpl<Scalar>::clone() const {
+  boost::shared_ptr<ImpulseModelMultipleTpl> model =
+      boost::allocate_shared<ImpulseModelMultipleTpl>(Eigen::aligned_allocator<ImpulseModelMultipleTpl>(), *this);
+  for (typename ImpulseModelContainer::iterator it = model->impulses_.begin(); it != model->impulses_.end(); ++it) {
+    const ImpulseItem& item = *it->second;
+    it->second = boost::make_shared<ImpulseItem>(item.name, item.impulse->clone(), item.active);
+  }
+  return model;
+}
+
 template <typename Scalar>
 const boost::shared_ptr<StateMultibodyTpl<Scalar> >& ImpulseModelMultipleTpl<Scalar>::get_state() const {
   return state_;
@@ -23,7 +23,7 @@ ContactModelNumDiffTpl<Scalar>::~ContactModelNumDiffTpl() {}
 template <typename Scalar>
 void ContactModelNumDiffTpl<Scalar>::calc(const boost::shared_ptr<ContactDataAbstract>& data,
                                           const Eigen::Ref<const VectorXs>& x) {
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
   model_->calc(data_nd->data_0, x);
   data_nd->a0 = data_nd->data_0->a0;
 }
@@ -31,7 +31,7 @@ void ContactModelNumDiffTpl<Scalar>::calc(const boost::shared_ptr<ContactDataAbs
 template <typename Scalar>
 void ContactModelNumDiffTpl<Scalar>::calcDiff(const boost::shared_ptr<ContactDataAbstract>& data,
                                               const Eigen::Ref<const VectorXs>& x) {
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
 
   const VectorXs& a0 = data_nd->a0;
 
@@ -62,7 +62,7 @@ void ContactModelNumDiffTpl<Scalar>::updateForce(const boost::shared_ptr<Contact
                  << "lambda has wrong dimension (it should be " << model_->get_nc() << ")");
   }
 
-  boost::shared_ptr<Data> data_nd = boost::static_pointer_cast<Data>(data);
+  Data* data_nd = static_cast<Data*>(data.get());
 
   model_->updateForce(data_nd->data_0, force);
 }
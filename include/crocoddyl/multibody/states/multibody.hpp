@@ -46,6 +46,12 @@ class StateMultibodyTpl : public StateAbstractTpl<_Scalar> {
                           const Jcomponent firstsecond = both, const AssignmentOp = setto) const;
   virtual void JintegrateTransport(const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& dx,
                                    Eigen::Ref<MatrixXs> Jin, const Jcomponent firstsecond) const;
+  virtual void diffTrajectory(const std::vector<VectorXs>& x0s, const std::vector<VectorXs>& x1s,
+                              std::vector<VectorXs>& dxouts) const;
+  virtual void integrateTrajectory(const std::vector<VectorXs>& xs, const std::vector<VectorXs>& dxs,
+                                   std::vector<VectorXs>& xouts) const;
+  virtual void JintegrateTransportTrajectory(const std::vector<VectorXs>& xs, const std::vector<VectorXs>& dxs,
+                                             std::vector<MatrixXs>& Jins, const Jcomponent firstsecond) const;
 
   const boost::shared_ptr<PinocchioModel>& get_pinocchio() const;
 
@@ -228,6 +228,89 @@ void StateMultibodyTpl<Scalar>::JintegrateTransport(const Eigen::Ref<const Vecto
   }
 }
 
+template <typename Scalar>
+void StateMultibodyTpl<Scalar>::diffTrajectory(const std::vector<VectorXs>& x0s, const std::vector<VectorXs>& x1s,
+                                               std::vector<VectorXs>& dxouts) const {
+  const std::size_t T = x0s.size();
+  if (x1s.size() != T || dxouts.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "x1s and dxouts have wrong dimension (they should be " + std::to_string(T) + ")");
+  }
+  // Dimensions are checked before entering the parallel region, since exceptions cannot leave it
+  for (std::size_t i = 0; i < T; ++i) {
+    if (static_cast<std::size_t>(x0s[i].size()) != nx_ || static_cast<std::size_t>(x1s[i].size()) != nx_ ||
+        static_cast<std::size_t>(dxouts[i].size()) != ndx_) {
+      throw_pretty("Invalid argument: "
+                   << "node " + std::to_string(i) + " has wrong dimension (it should be " + std::to_string(nx_) +
+                          ")");
+    }
+  }
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for
+#endif
+  for (std::size_t i = 0; i < T; ++i) {
+    pinocchio::difference(*pinocchio_.get(), x0s[i].head(nq_), x1s[i].head(nq_), dxouts[i].head(nv_));
+    dxouts[i].tail(nv_) = x1s[i].tail(nv_) - x0s[i].tail(nv_);
+  }
+}
+
+template <typename Scalar>
+void StateMultibodyTpl<Scalar>::integrateTrajectory(const std::vector<VectorXs>& xs, const std::vector<VectorXs>& dxs,
+                                                    std::vector<VectorXs>& xouts) const {
+  const std::size_t T = xs.size();
+  if (dxs.size() != T || xouts.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "dxs and xouts have wrong dimension (they should be " + std::to_string(T) + ")");
+  }
+  for (std::size_t i = 0; i < T; ++i) {
+    if (static_cast<std::size_t>(xs[i].size()) != nx_ || static_cast<std::size_t>(dxs[i].size()) != ndx_ ||
+        static_cast<std::size_t>(xouts[i].size()) != nx_) {
+      throw_pretty("Invalid argument: "
+                   << "node " + std::to_string(i) + " has wrong dimension (it should be " + std::to_string(nx_) +
+                          ")");
+    }
+  }
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for
+#endif
+  for (std::size_t i = 0; i < T; ++i) {
+    pinocchio::integrate(*pinocchio_.get(), xs[i].head(nq_), dxs[i].head(nv_), xouts[i].head(nq_));
+    xouts[i].tail(nv_) = xs[i].tail(nv_) + dxs[i].tail(nv_);
+  }
+}
+
+template <typename Scalar>
+void StateMultibodyTpl<Scalar>::JintegrateTransportTrajectory(const std::vector<VectorXs>& xs,
+                                                              const std::vector<VectorXs>& dxs,
+                                                              std::vector<MatrixXs>& Jins,
+                                                              const Jcomponent firstsecond) const {
+  assert_pretty(is_a_Jcomponent(firstsecond), ("firstsecond must be one of the Jcomponent {both, first, second}"));
+  if (firstsecond != first && firstsecond != second) {
+    throw_pretty(
+        "Invalid argument: firstsecond must be either first or second. both not supported for this operation.");
+  }
+  const std::size_t T = xs.size();
+  if (dxs.size() != T || Jins.size() != T) {
+    throw_pretty("Invalid argument: "
+                 << "dxs and Jins have wrong dimension (they should be " + std::to_string(T) + ")");
+  }
+  for (std::size_t i = 0; i < T; ++i) {
+    if (static_cast<std::size_t>(xs[i].size()) != nx_ || static_cast<std::size_t>(dxs[i].size()) != ndx_ ||
+        static_cast<std::size_t>(Jins[i].rows()) < nv_) {
+      throw_pretty("Invalid argument: "
+                   << "node " + std::to_string(i) + " has wrong dimension (it should be " + std::to_string(nx_) +
+                          ")");
+    }
+  }
+  const pinocchio::ArgumentPosition arg = firstsecond == first ? pinocchio::ARG0 : pinocchio::ARG1;
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for
+#endif
+  for (std::size_t i = 0; i < T; ++i) {
+    pinocchio::dIntegrateTransport(*pinocchio_.get(), xs[i].head(nq_), dxs[i].head(nv_), Jins[i].topRows(nv_), arg);
+  }
+}
+
 template <typename Scalar>
 const boost::shared_ptr<pinocchio::ModelTpl<Scalar> >& StateMultibodyTpl<Scalar>::get_pinocchio() const {
   return pinocchio_;
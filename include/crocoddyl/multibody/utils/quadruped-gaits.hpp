@@ -9,6 +9,7 @@
 #ifndef CROCODDYL_MULTIBODY_UTILS_QUADRUPED_GAITS_HPP_
 #define CROCODDYL_MULTIBODY_UTILS_QUADRUPED_GAITS_HPP_
 
+#include <map>
 #include <pinocchio/spatial/se3.hpp>
 #include <pinocchio/multibody/model.hpp>
 #include <pinocchio/multibody/frame.hpp>
@@ -34,8 +35,32 @@
 
 namespace crocoddyl {
 
+/**
+ * @brief Builder of simple quadrupedal gait problems
+ *
+ * The knots of a contact phase only differ in the references of their tracking costs (CoM and swing-foot
+ * positions). For this reason, the builder creates one action model per phase, i.e. per set of support and swing
+ * feet, and all the knots of the phase share it. The targets of each knot are stored as node references in its data
+ * (see `setKnotTask()`). The phase models are kept across calls, so rebuilding a problem (e.g. at each MPC replan)
+ * only creates the datas of the new problem.
+ *
+ * Note that the phase models are shared among the knots, and across the problems built by this builder. Hence,
+ * changing a phase model (e.g. its contact status with `ContactModelMultiple::changeContactStatus()`, or the weight
+ * of a cost item) changes it in all of them. To modify a single knot, or the problems built before, replace its model
+ * with a clone (`ActionModelAbstract::clone()`), or call `clearPrototypes()` before building the next problem.
+ */
 class SimpleQuadrupedGaitProblem {
  public:
+  /**
+   * @brief Tracking targets of a knot
+   */
+  struct KnotTask {
+    KnotTask();
+
+    Eigen::Vector3d com;                    //!< CoM target (it is not tracked if it is not finite)
+    std::vector<FramePlacement> swingFeet;  //!< Targets of the swing feet
+  };
+
   SimpleQuadrupedGaitProblem(const pinocchio::Model& rmodel, const std::string& lf_foot, const std::string& rf_foot,
                              const std::string& lh_foot, const std::string& rh_foot);
   ~SimpleQuadrupedGaitProblem();
@@ -46,29 +71,62 @@ class SimpleQuadrupedGaitProblem {
                                                                      const std::size_t stepKnots,
                                                                      const std::size_t supportKnots);
 
+  /**
+   * @brief Create the models of a foot step, and append the targets of its knots to `knotTasks`
+   */
   std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > createFootStepModels(
       double timeStep, Eigen::Vector3d& comPos0, std::vector<Eigen::Vector3d>& feetPos0, double stepLength,
       double stepHeight, std::size_t numKnots, const std::vector<pinocchio::FrameIndex>& supportFootIds,
-      const std::vector<pinocchio::FrameIndex>& swingFootIds);
+      const std::vector<pinocchio::FrameIndex>& swingFootIds, std::vector<KnotTask>& knotTasks);
 
+  /**
+   * @brief Return the model of a swing phase, which tracks the swing feet and, if `comTrack`, the CoM
+   *
+   * The model is created once per phase. The targets of each knot are set with `setKnotTask()`.
+   */
   boost::shared_ptr<ActionModelAbstract> createSwingFootModel(
       double timeStep, const std::vector<pinocchio::FrameIndex>& supportFootIds,
-      const Eigen::Vector3d& comTask = Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity()),
-      const std::vector<crocoddyl::FramePlacement>& swingFootTask = std::vector<crocoddyl::FramePlacement>());
+      const std::vector<pinocchio::FrameIndex>& swingFootIds = std::vector<pinocchio::FrameIndex>(),
+      bool comTrack = false);
 
   boost::shared_ptr<ActionModelAbstract> createFootSwitchModel(
-      const std::vector<pinocchio::FrameIndex>& supportFootIds, const std::vector<FramePlacement>& swingFootTask,
-      bool pseudoImpulse = false);
+      const std::vector<pinocchio::FrameIndex>& supportFootIds,
+      const std::vector<pinocchio::FrameIndex>& swingFootIds, bool pseudoImpulse = false);
 
   boost::shared_ptr<ActionModelAbstract> createPseudoImpulseModel(
-      const std::vector<pinocchio::FrameIndex>& supportFootIds, const std::vector<FramePlacement>& swingFootTask);
+      const std::vector<pinocchio::FrameIndex>& supportFootIds,
+      const std::vector<pinocchio::FrameIndex>& swingFootIds);
 
   boost::shared_ptr<ActionModelAbstract> createImpulseModel(const std::vector<pinocchio::FrameIndex>& supportFootIds,
-                                                            const std::vector<FramePlacement>& swingFootTask);
+                                                            const std::vector<pinocchio::FrameIndex>& swingFootIds);
+
+  /**
+   * @brief Set the targets of a knot as node references of its data
+   *
+   * @param[in] model  Phase model created by this builder
+   * @param[in] data   Data of the knot
+   * @param[in] task   Targets of the knot
+   */
+  void setKnotTask(const boost::shared_ptr<ActionModelAbstract>& model,
+                   const boost::shared_ptr<ActionDataAbstract>& data, const KnotTask& task) const;
 
   const Eigen::VectorXd& get_defaultState() const;
 
+  /**
+   * @brief Remove the phase models and the contact prototypes
+   *
+   * The next built problem creates again the action and contact models of each phase.
+   */
+  void clearPrototypes();
+
  protected:
+  typedef std::vector<pinocchio::FrameIndex> FootIds;
+  typedef std::pair<FootIds, FootIds> PhaseKey;                    //!< Support and swing feet of a phase
+  typedef std::pair<PhaseKey, std::pair<bool, double> > SwingKey;  //!< Phase, CoM tracking and time step
+
+  boost::shared_ptr<ContactModelMultiple> getContactPrototype(const std::vector<pinocchio::FrameIndex>& supportFootIds);
+  boost::shared_ptr<ImpulseModelMultiple> getImpulsePrototype(const std::vector<pinocchio::FrameIndex>& supportFootIds);
+
   pinocchio::Model rmodel_;
   pinocchio::Data rdata_;
   pinocchio::FrameIndex lf_foot_id_, rf_foot_id_, lh_foot_id_, rh_foot_id_;
@@ -76,6 +134,15 @@ class SimpleQuadrupedGaitProblem {
   boost::shared_ptr<ActuationModelFloatingBase> actuation_;
   bool firtstep_;
   Eigen::VectorXd defaultstate_;
+  std::map<FootIds, boost::shared_ptr<ContactModelMultiple> > contact_prototypes_;
+  std::map<FootIds, boost::shared_ptr<ImpulseModelMultiple> > impulse_prototypes_;
+  std::map<SwingKey, boost::shared_ptr<ActionModelAbstract> > swing_models_;           //!< Swing-phase models
+  std::map<PhaseKey, boost::shared_ptr<ActionModelAbstract> > pseudo_impulse_models_;  //!< Pseudo-impulse models
+  std::map<PhaseKey, boost::shared_ptr<ActionModelAbstract> > impulse_models_;         //!< Impulse models
+  boost::shared_ptr<CostModelAbstract> swing_state_reg_;    //!< State regularization of the swing phases
+  boost::shared_ptr<CostModelAbstract> pseudo_state_reg_;   //!< State regularization of the pseudo-impulses
+  boost::shared_ptr<CostModelAbstract> impulse_state_reg_;  //!< State regularization of the impulses
+  boost::shared_ptr<CostModelAbstract> ctrl_reg_;           //!< Control regularization
 };
 }  // namespace crocoddyl
 
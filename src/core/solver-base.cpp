@@ -85,7 +85,12 @@ void SolverAbstract::setCandidate(const std::vector<Eigen::VectorXd>& xs_warm,
                             std::to_string(nu) + ")");
       }
     }
-    std::copy(us_warm.begin(), us_warm.end(), us_.begin());
+    // The controls shorter than nu_max are padded with zeros, so the solvers can swap them with their trial
+    // controls regardless of the dimension of each node
+    for (std::size_t t = 0; t < T; ++t) {
+      us_[t] = Eigen::VectorXd::Zero(nu);
+      us_[t].head(us_warm[t].size()) = us_warm[t];
+    }
   }
   is_feasible_ = is_feasible;
 }
@@ -96,6 +101,14 @@ void SolverAbstract::setCallbacks(const std::vector<boost::shared_ptr<CallbackAb
 
 const std::vector<boost::shared_ptr<CallbackAbstract> >& SolverAbstract::getCallbacks() const { return callbacks_; }
 
+const boost::shared_ptr<CancellationToken>& SolverAbstract::get_cancellation_token() const {
+  return cancellation_token_;
+}
+
+void SolverAbstract::set_cancellation_token(boost::shared_ptr<CancellationToken> token) {
+  cancellation_token_ = token;
+}
+
 const boost::shared_ptr<ShootingProblem>& SolverAbstract::get_problem() const { return problem_; }
 
 const std::vector<Eigen::VectorXd>& SolverAbstract::get_xs() const { return xs_; }
@@ -133,13 +146,15 @@ void SolverAbstract::set_xs(const std::vector<Eigen::VectorXd>& xs) {
                  << "xs list has to be " + std::to_string(T + 1));
   }
 
-  const std::size_t& nx = problem_->get_nx();
+  const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
   for (std::size_t t = 0; t < T; ++t) {
+    const std::size_t& nx = models[t]->get_state()->get_nx();
     if (static_cast<std::size_t>(xs[t].size()) != nx) {
       throw_pretty("Invalid argument: "
                    << "xs[" + std::to_string(t) + "] has wrong dimension (it should be " + std::to_string(nx) + ")")
     }
   }
+  const std::size_t& nx = problem_->get_terminalModel()->get_state()->get_nx();
   if (static_cast<std::size_t>(xs[T].size()) != nx) {
     throw_pretty("Invalid argument: "
                  << "xs[" + std::to_string(T) + "] has wrong dimension (it should be " + std::to_string(nx) + ")")
@@ -57,6 +57,10 @@ void SolverBoxDDP::computeGains(const std::size_t& t) {
 
     const BoxQPSolution& boxqp_sol =
         qp_.solve(Quu_[t].topLeftCorner(nu, nu), Qu_[t].head(nu), du_lb_.head(nu), du_ub_.head(nu), k_[t].head(nu));
+    if (!boxqp_sol.success) {
+      pass_status_ = BackwardError;
+      return;
+    }
 
     // Compute controls
     Quu_inv_[t].topLeftCorner(nu, nu).setZero();
@@ -81,11 +85,12 @@ void SolverBoxDDP::forwardPass(const double& steplength) {
     throw_pretty("Invalid argument: "
                  << "invalid step length, value is between 0. to 1.");
   }
+  pass_status_ = PassSuccess;
   cost_try_ = 0.;
   xnext_ = problem_->get_x0();
   const std::size_t& T = problem_->get_T();
   const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
-  const std::vector<boost::shared_ptr<ActionDataAbstract> >& datas = problem_->get_runningDatas();
+  const std::vector<boost::shared_ptr<ActionDataAbstract> >& datas = running_datas_try_;
   for (std::size_t t = 0; t < T; ++t) {
     const boost::shared_ptr<ActionModelAbstract>& m = models[t];
     const boost::shared_ptr<ActionDataAbstract>& d = datas[t];
@@ -105,16 +110,14 @@ void SolverBoxDDP::forwardPass(const double& steplength) {
     xnext_ = d->xnext;
     cost_try_ += d->cost;
 
-    if (raiseIfNaN(cost_try_)) {
-      throw_pretty("forward_error");
-    }
-    if (raiseIfNaN(xnext_.lpNorm<Eigen::Infinity>())) {
-      throw_pretty("forward_error");
+    if (raiseIfNaN(cost_try_) || raiseIfNaN(xnext_.lpNorm<Eigen::Infinity>())) {
+      pass_status_ = ForwardError;
+      return;
     }
   }
 
   const boost::shared_ptr<ActionModelAbstract>& m = problem_->get_terminalModel();
-  const boost::shared_ptr<ActionDataAbstract>& d = problem_->get_terminalData();
+  const boost::shared_ptr<ActionDataAbstract>& d = terminal_data_try_;
   if ((is_feasible_) || (steplength == 1)) {
     xs_try_.back() = xnext_;
   } else {
@@ -124,7 +127,7 @@ void SolverBoxDDP::forwardPass(const double& steplength) {
   cost_try_ += d->cost;
 
   if (raiseIfNaN(cost_try_)) {
-    throw_pretty("forward_error");
+    pass_status_ = ForwardError;
   }
 }
 
@@ -120,12 +120,15 @@ const BoxQPSolution& BoxQP::solve(const Eigen::MatrixXd& H, const Eigen::VectorX
         Hff_inv_llt_.compute(Hff_);
         const Eigen::ComputationInfo& info = Hff_inv_llt_.info();
         if (info != Eigen::Success) {
-          throw_pretty("backward_error");
+          solution_.x = x_;
+          solution_.success = false;
+          return solution_;
         }
         solution_.Hff_inv.setIdentity(nf_, nf_);
         Hff_inv_llt_.solveInPlace(solution_.Hff_inv);
       }
       solution_.x = x_;
+      solution_.success = true;
       return solution_;
     }
 
@@ -155,7 +158,9 @@ const BoxQPSolution& BoxQP::solve(const Eigen::MatrixXd& H, const Eigen::VectorX
     Hff_inv_llt_.compute(Hff_);
     const Eigen::ComputationInfo& info = Hff_inv_llt_.info();
     if (info != Eigen::Success) {
-      throw_pretty("backward_error");
+      solution_.x = x_;
+      solution_.success = false;
+      return solution_;
     }
     solution_.Hff_inv.setIdentity(nf_, nf_);
     Hff_inv_llt_.solveInPlace(solution_.Hff_inv);
@@ -185,6 +190,7 @@ const BoxQPSolution& BoxQP::solve(const Eigen::MatrixXd& H, const Eigen::VectorX
     }
   }
   solution_.x = x_;
+  solution_.success = true;
   return solution_;
 }
 
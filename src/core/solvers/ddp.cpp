@@ -7,6 +7,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <algorithm>
+#include <limits>
 #include "crocoddyl/core/utils/exception.hpp"
 #include "crocoddyl/core/solvers/ddp.hpp"
 
@@ -22,7 +24,11 @@ SolverDDP::SolverDDP(boost::shared_ptr<ShootingProblem> problem)
       th_gaptol_(1e-16),
       th_stepdec_(0.5),
       th_stepinc_(0.01),
-      was_feasible_(false) {
+      was_feasible_(false),
+      pass_status_(PassSuccess),
+      trial_linearized_(false),
+      datas_linearized_(false),
+      square_root_(false) {
   allocateData();
 
   const std::size_t& n_alphas = 10;
@@ -37,12 +43,20 @@ SolverDDP::SolverDDP(boost::shared_ptr<ShootingProblem> problem)
   }
 }
 
-SolverDDP::~SolverDDP() {}
+SolverDDP::~SolverDDP() {
+  // The trial datas go back to the data pool of the problem, so another solver of this problem can recycle them
+  for (std::size_t t = 0; t < running_models_try_.size(); ++t) {
+    problem_->releaseData(running_models_try_[t], running_datas_try_[t]);
+  }
+  problem_->releaseData(terminal_model_try_, terminal_data_try_);
+}
 
 bool SolverDDP::solve(const std::vector<Eigen::VectorXd>& init_xs, const std::vector<Eigen::VectorXd>& init_us,
                       const std::size_t& maxiter, const bool& is_feasible, const double& reginit) {
-  xs_try_[0] = problem_->get_x0();  // it is needed in case that init_xs[0] is infeasible
   setCandidate(init_xs, init_us, is_feasible);
+  resizeData();
+  updateTrialDatas();
+  datas_linearized_ = false;
 
   if (std::isnan(reginit)) {
     xreg_ = regmin_;
@@ -55,30 +69,30 @@ bool SolverDDP::solve(const std::vector<Eigen::VectorXd>& init_xs, const std::ve
 
   bool recalcDiff = true;
   for (iter_ = 0; iter_ < maxiter; ++iter_) {
+    if (isCancelled()) {
+      return false;
+    }
     while (true) {
-      try {
-        computeDirection(recalcDiff);
-      } catch (std::exception& e) {
-        recalcDiff = false;
-        increaseRegularization();
-        if (xreg_ == regmax_) {
-          return false;
-        } else {
-          continue;
-        }
+      if (computeDirectionStep(recalcDiff) == PassSuccess) {
+        break;
+      }
+      recalcDiff = false;
+      increaseRegularization();
+      if (xreg_ == regmax_) {
+        return false;
       }
-      break;
     }
     expectedImprovement();
 
     // We need to recalculate the derivatives when the step length passes
     recalcDiff = false;
     for (std::vector<double>::const_iterator it = alphas_.begin(); it != alphas_.end(); ++it) {
+      if (isCancelled()) {
+        return false;
+      }
       steplength_ = *it;
 
-      try {
-        dV_ = tryStep(steplength_);
-      } catch (std::exception& e) {
+      if (tryStepLength(steplength_) != PassSuccess) {
         continue;
       }
       dVexp_ = steplength_ * (d_[0] + 0.5 * steplength_ * d_[1]);
@@ -86,7 +100,7 @@ bool SolverDDP::solve(const std::vector<Eigen::VectorXd>& init_xs, const std::ve
       if (dVexp_ >= 0) {  // descend direction
         if (d_[0] < th_grad_ || !is_feasible_ || dV_ > th_acceptstep_ * dVexp_) {
           was_feasible_ = is_feasible_;
-          setCandidate(xs_try_, us_try_, true);
+          acceptStep(true);
           cost_ = cost_try_;
           recalcDiff = true;
           break;
@@ -119,15 +133,18 @@ bool SolverDDP::solve(const std::vector<Eigen::VectorXd>& init_xs, const std::ve
 }
 
 void SolverDDP::computeDirection(const bool& recalcDiff) {
-  if (recalcDiff) {
-    calcDiff();
+  resizeData();
+  updateTrialDatas();
+  if (computeDirectionStep(recalcDiff) != PassSuccess) {
+    throw_pretty("backward_error");
   }
-  backwardPass();
 }
 
 double SolverDDP::tryStep(const double& steplength) {
-  forwardPass(steplength);
-  return cost_ - cost_try_;
+  if (tryStepLength(steplength) != PassSuccess) {
+    throw_pretty("forward_error");
+  }
+  return dV_;
 }
 
 double SolverDDP::stoppingCriteria() {
@@ -160,7 +177,11 @@ const Eigen::Vector2d& SolverDDP::expectedImprovement() {
 double SolverDDP::calcDiff() {
   if (iter_ == 0) problem_->calc(xs_, us_);
   cost_ = problem_->calcDiff(xs_, us_);
+  computeGaps();
+  return cost_;
+}
 
+void SolverDDP::computeGaps() {
   if (!is_feasible_) {
     const Eigen::VectorXd& x0 = problem_->get_x0();
     problem_->get_runningModels()[0]->get_state()->diff(xs_[0], x0, fs_[0]);
@@ -172,7 +193,8 @@ double SolverDDP::calcDiff() {
     const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
     const std::vector<boost::shared_ptr<ActionDataAbstract> >& datas = problem_->get_runningDatas();
     for (std::size_t t = 0; t < T; ++t) {
-      const boost::shared_ptr<ActionModelAbstract>& model = models[t];
+      // The gap lives in the state of the next node, which might differ from the current one
+      const boost::shared_ptr<ActionModelAbstract>& model = t + 1 < T ? models[t + 1] : problem_->get_terminalModel();
       const boost::shared_ptr<ActionDataAbstract>& d = datas[t];
       model->get_state()->diff(xs_[t + 1], d->xnext, fs_[t + 1]);
       if (could_be_feasible) {
@@ -188,10 +210,89 @@ double SolverDDP::calcDiff() {
       it->setZero();
     }
   }
+}
+
+double SolverDDP::calcDiffAndBackwardPass() {
+  if (datas_linearized_) {
+    datas_linearized_ = false;
+    cost_ = problem_->updateCost();
+    computeGaps();
+    backwardPass();
+    return cost_;
+  }
+#ifdef CROCODDYL_WITH_MULTITHREADING
+  if (iter_ == 0) problem_->calc(xs_, us_);
+  // The gaps only depend on the rollout, so they are ready before the linearization
+  computeGaps();
+
+  const std::size_t& T = problem_->get_T();
+  // The dependency tokens are only referenced by the depend clauses, which GCC does not count as a use
+  char* node_deps = &node_deps_[0];
+  char value_dep = 0;
+  (void)node_deps;
+  (void)value_dep;
+  pass_status_ = PassSuccess;
+#pragma omp parallel
+#pragma omp single
+  {
+    // The nodes are linearized in reverse time order, i.e. the order in which the Riccati sweep consumes them
+#pragma omp task depend(out : node_deps[T])
+    linearizeNode(T);
+    for (int t = static_cast<int>(T) - 1; t >= 0; --t) {
+#pragma omp task firstprivate(t) depend(out : node_deps[t])
+      linearizeNode(t);
+    }
+    // The Riccati steps form a serial chain, and each one starts once its node is linearized
+#pragma omp task depend(in : node_deps[T]) depend(inout : value_dep)
+    computeTerminalValue();
+    for (int t = static_cast<int>(T) - 1; t >= 0; --t) {
+#pragma omp task firstprivate(t) depend(in : node_deps[t]) depend(inout : value_dep)
+      {
+        if (pass_status_ == PassSuccess) {
+          computeRiccatiStep(t);
+        }
+      }
+    }
+  }
+
+  cost_ = problem_->updateCost();
+#else
+  calcDiff();
+  backwardPass();
+#endif
   return cost_;
 }
 
 void SolverDDP::backwardPass() {
+  pass_status_ = PassSuccess;
+  computeTerminalValue();
+  if (pass_status_ != PassSuccess) {
+    return;
+  }
+  for (int t = static_cast<int>(problem_->get_T()) - 1; t >= 0; --t) {
+    computeRiccatiStep(t);
+    if (pass_status_ != PassSuccess) {
+      return;
+    }
+  }
+}
+
+void SolverDDP::linearizeNode(const std::size_t& t) {
+  if (t == problem_->get_T()) {
+    problem_->get_terminalModel()->calcDiff(problem_->get_terminalData(), xs_.back());
+    return;
+  }
+  const boost::shared_ptr<ActionModelAbstract>& m = problem_->get_runningModels()[t];
+  const boost::shared_ptr<ActionDataAbstract>& d = problem_->get_runningDatas()[t];
+  const std::size_t& nu = m->get_nu();
+  if (nu != 0) {
+    m->calcDiff(d, xs_[t], us_[t].head(nu));
+  } else {
+    m->calcDiff(d, xs_[t]);
+  }
+}
+
+void SolverDDP::computeTerminalValue() {
   const boost::shared_ptr<ActionDataAbstract>& d_T = problem_->get_terminalData();
   Vxx_.back() = d_T->Lxx;
   Vx_.back() = d_T->Lx;
@@ -199,68 +300,221 @@ void SolverDDP::backwardPass() {
   if (!std::isnan(xreg_)) {
     Vxx_.back().diagonal().array() += xreg_;
   }
+  if (square_root_ && !factorizeSemidefinite(Vxx_.back(), Sxx_.back())) {
+    pass_status_ = BackwardError;
+    return;
+  }
 
   if (!is_feasible_) {
     Vx_.back().noalias() += Vxx_.back() * fs_.back();
   }
-  const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
-  const std::vector<boost::shared_ptr<ActionDataAbstract> >& datas = problem_->get_runningDatas();
-  for (int t = static_cast<int>(problem_->get_T()) - 1; t >= 0; --t) {
-    const boost::shared_ptr<ActionModelAbstract>& m = models[t];
-    const boost::shared_ptr<ActionDataAbstract>& d = datas[t];
-    const Eigen::MatrixXd& Vxx_p = Vxx_[t + 1];
-    const Eigen::VectorXd& Vx_p = Vx_[t + 1];
-    const std::size_t& nu = m->get_nu();
+}
+
+void SolverDDP::computeRiccatiStep(const std::size_t& t) {
+  const boost::shared_ptr<ActionModelAbstract>& m = problem_->get_runningModels()[t];
+  const boost::shared_ptr<ActionDataAbstract>& d = problem_->get_runningDatas()[t];
+  const Eigen::MatrixXd& Vxx_p = Vxx_[t + 1];
+  const Eigen::VectorXd& Vx_p = Vx_[t + 1];
+  const std::size_t& nu = m->get_nu();
+
+  Qx_[t] = d->Lx;
+  Qx_[t].noalias() += d->Fx.transpose() * Vx_p;
+  if (nu != 0) {
+    Qu_[t].head(nu) = d->Lu;
+    Qu_[t].head(nu).noalias() += d->Fu.transpose() * Vx_p;
+  }
 
+  if (square_root_) {
+    computeSquareRootHamiltonian(t);
+    if (pass_status_ != PassSuccess) {
+      return;
+    }
+  } else {
+    // The Hessians are symmetric, so we only compute their lower triangle and copy it into the upper one
     Qxx_[t] = d->Lxx;
-    Qx_[t] = d->Lx;
     FxTVxx_p_.noalias() = d->Fx.transpose() * Vxx_p;
-    Qxx_[t].noalias() += FxTVxx_p_ * d->Fx;
-    Qx_[t].noalias() += d->Fx.transpose() * Vx_p;
+    Qxx_[t].triangularView<Eigen::Lower>() += FxTVxx_p_ * d->Fx;
+    Qxx_[t].triangularView<Eigen::StrictlyUpper>() = Qxx_[t].transpose();
     if (nu != 0) {
       Qxu_[t].leftCols(nu) = d->Lxu;
       Quu_[t].topLeftCorner(nu, nu) = d->Luu;
-      Qu_[t].head(nu) = d->Lu;
       FuTVxx_p_[t].topRows(nu).noalias() = d->Fu.transpose() * Vxx_p;
       Qxu_[t].leftCols(nu).noalias() += FxTVxx_p_ * d->Fu;
-      Quu_[t].topLeftCorner(nu, nu).noalias() += FuTVxx_p_[t].topRows(nu) * d->Fu;
-      Qu_[t].head(nu).noalias() += d->Fu.transpose() * Vx_p;
+      Quu_[t].topLeftCorner(nu, nu).triangularView<Eigen::Lower>() += FuTVxx_p_[t].topRows(nu) * d->Fu;
+      Quu_[t].topLeftCorner(nu, nu).triangularView<Eigen::StrictlyUpper>() =
+          Quu_[t].topLeftCorner(nu, nu).transpose();
 
       if (!std::isnan(ureg_)) {
         Quu_[t].diagonal().head(nu).array() += ureg_;
       }
     }
+  }
 
-    computeGains(t);
+  computeGains(t);
+  if (pass_status_ != PassSuccess) {
+    return;
+  }
 
-    Vx_[t] = Qx_[t];
+  Vx_[t] = Qx_[t];
+  if (nu != 0) {
+    if (std::isnan(ureg_)) {
+      Vx_[t].noalias() -= K_[t].topRows(nu).transpose() * Qu_[t].head(nu);
+    } else {
+      Quuk_[t].head(nu).noalias() = Quu_[t].topLeftCorner(nu, nu) * k_[t].head(nu);
+      Vx_[t].noalias() += K_[t].topRows(nu).transpose() * Quuk_[t].head(nu);
+      Vx_[t].noalias() -= 2 * (K_[t].topRows(nu).transpose() * Qu_[t].head(nu));
+    }
+  }
+
+  if (square_root_) {
+    computeSquareRootValue(t);
+  } else {
     Vxx_[t] = Qxx_[t];
     if (nu != 0) {
-      if (std::isnan(ureg_)) {
-        Vx_[t].noalias() -= K_[t].topRows(nu).transpose() * Qu_[t].head(nu);
-      } else {
-        Quuk_[t].head(nu).noalias() = Quu_[t].topLeftCorner(nu, nu) * k_[t].head(nu);
-        Vx_[t].noalias() += K_[t].topRows(nu).transpose() * Quuk_[t].head(nu);
-        Vx_[t].noalias() -= 2 * (K_[t].topRows(nu).transpose() * Qu_[t].head(nu));
-      }
-      Vxx_[t].noalias() -= Qxu_[t].leftCols(nu) * K_[t].topRows(nu);
+      Vxx_[t].triangularView<Eigen::Lower>() -= Qxu_[t].leftCols(nu) * K_[t].topRows(nu);
+      Vxx_[t].triangularView<Eigen::StrictlyUpper>() = Vxx_[t].transpose();
     }
-    Vxx_[t] = 0.5 * (Vxx_[t] + Vxx_[t].transpose()).eval();
-
     if (!std::isnan(xreg_)) {
       Vxx_[t].diagonal().array() += xreg_;
     }
+  }
+
+  // Compute and store the Vx gradient at end of the interval (rollout state)
+  if (!is_feasible_) {
+    Vx_[t].noalias() += Vxx_[t] * fs_[t];
+  }
+
+  if (raiseIfNaN(Vx_[t].lpNorm<Eigen::Infinity>()) || raiseIfNaN(Vxx_[t].lpNorm<Eigen::Infinity>())) {
+    pass_status_ = BackwardError;
+  }
+}
 
-    // Compute and store the Vx gradient at end of the interval (rollout state)
-    if (!is_feasible_) {
-      Vx_[t].noalias() += Vxx_[t] * fs_[t];
+void SolverDDP::computeSquareRootHamiltonian(const std::size_t& t) {
+  const boost::shared_ptr<ActionModelAbstract>& m = problem_->get_runningModels()[t];
+  const boost::shared_ptr<ActionDataAbstract>& d = problem_->get_runningDatas()[t];
+  const Eigen::MatrixXd& Sxx_p = Sxx_[t + 1];
+  const std::size_t& nu = m->get_nu();
+  const std::size_t& ndx = m->get_state()->get_ndx();
+  const std::size_t ndx_next = static_cast<std::size_t>(Sxx_p.rows());
+  const std::size_t n = nu + ndx;
+
+  // Stage Hessian ordered as (u, x). The regularization of the state is added here, so it propagates into the
+  // Value function in the same way as the conventional Riccati step
+  sqrt_H_.resize(n, n);
+  sqrt_H_.bottomRightCorner(ndx, ndx) = d->Lxx;
+  if (!std::isnan(xreg_)) {
+    sqrt_H_.bottomRightCorner(ndx, ndx).diagonal().array() += xreg_;
+  }
+  if (nu != 0) {
+    sqrt_H_.topLeftCorner(nu, nu) = d->Luu;
+    sqrt_H_.bottomLeftCorner(ndx, nu) = d->Lxu;
+    sqrt_H_.topRightCorner(nu, ndx) = d->Lxu.transpose();
+    if (!std::isnan(ureg_)) {
+      sqrt_H_.topLeftCorner(nu, nu).diagonal().array() += ureg_;
     }
+  }
+
+  // The Hamiltonian Hessian is the Gram matrix of [F_H; S' [Fu Fx]], so its triangular factor R comes from a QR
+  // decomposition of this stack and it cannot lose positive semi-definiteness
+  sqrt_M_.resize(n + ndx_next, n);
+  if (!factorizeSemidefinite(sqrt_H_, sqrt_F_)) {
+    pass_status_ = BackwardError;
+    return;
+  }
+  sqrt_M_.topRows(n) = sqrt_F_;
+  if (nu != 0) {
+    sqrt_M_.bottomLeftCorner(ndx_next, nu).noalias() = Sxx_p * d->Fu;
+  }
+  sqrt_M_.bottomRightCorner(ndx_next, ndx).noalias() = Sxx_p * d->Fx;
+  sqrt_qr_.compute(sqrt_M_);
+  sqrt_R_ = sqrt_qr_.matrixQR().topRows(n).triangularView<Eigen::Upper>();
+
+  Qxx_[t].setZero();
+  Qxx_[t].triangularView<Eigen::Lower>() += sqrt_R_.rightCols(ndx).transpose() * sqrt_R_.rightCols(ndx);
+  Qxx_[t].triangularView<Eigen::StrictlyUpper>() = Qxx_[t].transpose();
+  if (nu != 0) {
+    Quu_[t].topLeftCorner(nu, nu).noalias() = sqrt_R_.topLeftCorner(nu, nu).transpose() * sqrt_R_.topLeftCorner(nu, nu);
+    Qxu_[t].leftCols(nu).noalias() = sqrt_R_.topRightCorner(nu, ndx).transpose() * sqrt_R_.topLeftCorner(nu, nu);
+  }
+}
+
+void SolverDDP::computeSquareRootGains(const std::size_t& t) {
+  const std::size_t& nu = problem_->get_runningModels()[t]->get_nu();
+  const std::size_t& ndx = problem_->get_runningModels()[t]->get_state()->get_ndx();
+
+  // Quu = Ruu' Ruu and Qux = Ruu' Rux, so the gains only need triangular solves with Ruu. A (numerically) zero
+  // pivot means that Quu is singular, which is the failure of its Cholesky decomposition
+  const Eigen::Block<Eigen::MatrixXd> Ruu = sqrt_R_.topLeftCorner(nu, nu);
+  const double tol = static_cast<double>(nu) * std::numeric_limits<double>::epsilon() *
+                     Ruu.diagonal().cwiseAbs().maxCoeff();
+  if (!(Ruu.diagonal().cwiseAbs().minCoeff() > tol)) {
+    pass_status_ = BackwardError;
+    return;
+  }
+  K_[t].topRows(nu) = sqrt_R_.topRightCorner(nu, ndx);
+  Eigen::Block<Eigen::MatrixXd> K = K_[t].topRows(nu);
+  Ruu.triangularView<Eigen::Upper>().solveInPlace(K);
+  k_[t].head(nu) = Qu_[t].head(nu);
+  Eigen::VectorBlock<Eigen::VectorXd, Eigen::Dynamic> k = k_[t].head(nu);
+  Ruu.triangularView<Eigen::Upper>().transpose().solveInPlace(k);
+  Ruu.triangularView<Eigen::Upper>().solveInPlace(k);
+}
+
+void SolverDDP::computeSquareRootValue(const std::size_t& t) {
+  const std::size_t& nu = problem_->get_runningModels()[t]->get_nu();
+  const std::size_t& ndx = problem_->get_runningModels()[t]->get_state()->get_ndx();
+
+  // Vxx = Rxx' Rxx + D' D with D = Rux - Ruu K, so the factor of the Value function is updated with each row of D
+  Sxx_[t] = sqrt_R_.bottomRightCorner(ndx, ndx);
+  if (nu != 0) {
+    sqrt_D_.resize(nu, ndx);
+    sqrt_D_ = sqrt_R_.topRightCorner(nu, ndx);
+    sqrt_D_.noalias() -= sqrt_R_.topLeftCorner(nu, nu).triangularView<Eigen::Upper>() * K_[t].topRows(nu);
+    for (std::size_t i = 0; i < nu; ++i) {
+      sqrt_w_ = sqrt_D_.row(i).transpose();
+      choleskyUpdate(Sxx_[t], sqrt_w_);
+    }
+  }
+  Vxx_[t].setZero();
+  Vxx_[t].triangularView<Eigen::Lower>() += Sxx_[t].transpose() * Sxx_[t];
+  Vxx_[t].triangularView<Eigen::StrictlyUpper>() = Vxx_[t].transpose();
+}
 
-    if (raiseIfNaN(Vx_[t].lpNorm<Eigen::Infinity>())) {
-      throw_pretty("backward_error");
+bool SolverDDP::factorizeSemidefinite(const Eigen::MatrixXd& A, Eigen::MatrixXd& F) {
+  // A = P' L D L' P, then F = sqrt(D) L' P. Negative pivots above the round-off level mean that A is indefinite
+  sqrt_ldlt_.compute(A);
+  const Eigen::VectorXd& D = sqrt_ldlt_.vectorD();
+  const std::size_t n = static_cast<std::size_t>(A.rows());
+  if (n == 0) {
+    F.resize(0, 0);
+    return true;
+  }
+  const double tol = static_cast<double>(n) * std::numeric_limits<double>::epsilon() * D.cwiseAbs().maxCoeff();
+  if (!(D.minCoeff() >= -tol)) {
+    return false;
+  }
+  F = sqrt_ldlt_.matrixU();
+  F = D.cwiseMax(0.).cwiseSqrt().asDiagonal() * F;
+  F = F * sqrt_ldlt_.transpositionsP().transpose();
+  return true;
+}
+
+void SolverDDP::choleskyUpdate(Eigen::MatrixXd& R, Eigen::VectorXd& w) {
+  // Givens rotations that annihilate w against the diagonal of R, i.e. R'R + ww' = R_new' R_new
+  const Eigen::Index n = R.cols();
+  for (Eigen::Index k = 0; k < n; ++k) {
+    const double r = std::hypot(R(k, k), w(k));
+    if (r == 0.) {
+      continue;
     }
-    if (raiseIfNaN(Vxx_[t].lpNorm<Eigen::Infinity>())) {
-      throw_pretty("backward_error");
+    const double c = R(k, k) / r;
+    const double s = w(k) / r;
+    R(k, k) = r;
+    w(k) = 0.;
+    for (Eigen::Index j = k + 1; j < n; ++j) {
+      const double Rkj = R(k, j);
+      R(k, j) = c * Rkj + s * w(j);
+      w(j) = c * w(j) - s * Rkj;
     }
   }
 }
@@ -270,10 +524,12 @@ void SolverDDP::forwardPass(const double& steplength) {
     throw_pretty("Invalid argument: "
                  << "invalid step length, value is between 0. to 1.");
   }
+  pass_status_ = PassSuccess;
   cost_try_ = 0.;
+  xs_try_[0] = problem_->get_x0();  // it is needed in case that xs[0] is infeasible
   const std::size_t& T = problem_->get_T();
   const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
-  const std::vector<boost::shared_ptr<ActionDataAbstract> >& datas = problem_->get_runningDatas();
+  const std::vector<boost::shared_ptr<ActionDataAbstract> >& datas = running_datas_try_;
   for (std::size_t t = 0; t < T; ++t) {
     const boost::shared_ptr<ActionModelAbstract>& m = models[t];
     const boost::shared_ptr<ActionDataAbstract>& d = datas[t];
@@ -292,31 +548,34 @@ void SolverDDP::forwardPass(const double& steplength) {
     xs_try_[t + 1] = d->xnext;
     cost_try_ += d->cost;
 
-    if (raiseIfNaN(cost_try_)) {
-      throw_pretty("forward_error");
-    }
-    if (raiseIfNaN(xs_try_[t + 1].lpNorm<Eigen::Infinity>())) {
-      throw_pretty("forward_error");
+    if (raiseIfNaN(cost_try_) || raiseIfNaN(xs_try_[t + 1].lpNorm<Eigen::Infinity>())) {
+      pass_status_ = ForwardError;
+      return;
     }
   }
 
   const boost::shared_ptr<ActionModelAbstract>& m = problem_->get_terminalModel();
-  const boost::shared_ptr<ActionDataAbstract>& d = problem_->get_terminalData();
+  const boost::shared_ptr<ActionDataAbstract>& d = terminal_data_try_;
   m->calc(d, xs_try_.back());
   cost_try_ += d->cost;
 
   if (raiseIfNaN(cost_try_)) {
-    throw_pretty("forward_error");
+    pass_status_ = ForwardError;
   }
 }
 
 void SolverDDP::computeGains(const std::size_t& t) {
   const std::size_t& nu = problem_->get_runningModels()[t]->get_nu();
   if (nu > 0) {
+    if (square_root_) {
+      computeSquareRootGains(t);
+      return;
+    }
     Quu_llt_[t].compute(Quu_[t].topLeftCorner(nu, nu));
     const Eigen::ComputationInfo& info = Quu_llt_[t].info();
     if (info != Eigen::Success) {
-      throw_pretty("backward_error");
+      pass_status_ = BackwardError;
+      return;
     }
     K_[t].topRows(nu).noalias() = Qxu_[t].leftCols(nu).transpose();
 
@@ -344,9 +603,57 @@ void SolverDDP::decreaseRegularization() {
   ureg_ = xreg_;
 }
 
+void SolverDDP::acceptStep(const bool& is_feasible) {
+  xs_.swap(xs_try_);
+  us_.swap(us_try_);
+  problem_->swapDatas(running_datas_try_, terminal_data_try_);
+  is_feasible_ = is_feasible;
+  datas_linearized_ = trial_linearized_;
+  trial_linearized_ = false;
+}
+
+void SolverDDP::updateTrialDatas() {
+  const std::size_t& T = problem_->get_T();
+  const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
+  if (running_models_try_.size() != T) {
+    for (std::size_t t = T; t < running_models_try_.size(); ++t) {
+      problem_->releaseData(running_models_try_[t], running_datas_try_[t]);
+    }
+    running_models_try_.resize(T);
+    running_datas_try_.resize(T);
+  }
+  // A circular append shifts the running nodes by one, so we shift the trial datas too and only create the new one
+  if (T > 1 && running_models_try_[0] != models[0] && running_models_try_[1] == models[0]) {
+    std::rotate(running_models_try_.begin(), running_models_try_.begin() + 1, running_models_try_.end());
+    std::rotate(running_datas_try_.begin(), running_datas_try_.begin() + 1, running_datas_try_.end());
+  }
+  // The replaced trial datas go back to the data pool of the problem, so it can recycle them in later updates
+  for (std::size_t t = 0; t < T; ++t) {
+    if (running_models_try_[t] != models[t]) {
+      problem_->releaseData(running_models_try_[t], running_datas_try_[t]);
+      running_models_try_[t] = models[t];
+      running_datas_try_[t] = problem_->acquireData(models[t]);
+    }
+  }
+  const boost::shared_ptr<ActionModelAbstract>& model = problem_->get_terminalModel();
+  if (terminal_model_try_ != model) {
+    problem_->releaseData(terminal_model_try_, terminal_data_try_);
+    terminal_model_try_ = model;
+    terminal_data_try_ = problem_->acquireData(model);
+  }
+  // The trial datas are swapped into the problem when a step is accepted, so they need the node parameters of the
+  // problem datas (e.g. per-node references)
+  const std::vector<boost::shared_ptr<ActionDataAbstract> >& datas = problem_->get_runningDatas();
+  for (std::size_t t = 0; t < T; ++t) {
+    models[t]->copyNodeParameters(datas[t], running_datas_try_[t]);
+  }
+  model->copyNodeParameters(problem_->get_terminalData(), terminal_data_try_);
+}
+
 void SolverDDP::allocateData() {
   const std::size_t& T = problem_->get_T();
   Vxx_.resize(T + 1);
+  Sxx_.resize(T + 1);
   Vx_.resize(T + 1);
   Qxx_.resize(T);
   Qxu_.resize(T);
@@ -359,18 +666,27 @@ void SolverDDP::allocateData() {
 
   xs_try_.resize(T + 1);
   us_try_.resize(T);
-  dx_.resize(T);
+  dx_.resize(T + 1);
+  node_deps_.resize(T + 1);
+  updateTrialDatas();
 
   FuTVxx_p_.resize(T);
   Quu_llt_.resize(T);
   Quuk_.resize(T);
 
-  const std::size_t& ndx = problem_->get_ndx();
   const std::size_t& nu = problem_->get_nu_max();
   const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
+  const std::size_t& ndx_T = problem_->get_terminalModel()->get_state()->get_ndx();
+  std::size_t ndx_max = ndx_T;
   for (std::size_t t = 0; t < T; ++t) {
     const boost::shared_ptr<ActionModelAbstract>& model = models[t];
+    const std::size_t& ndx = model->get_state()->get_ndx();
+    const std::size_t& ndx_next = t + 1 < T ? models[t + 1]->get_state()->get_ndx() : ndx_T;
+    if (ndx_max < ndx) {
+      ndx_max = ndx;
+    }
     Vxx_[t] = Eigen::MatrixXd::Zero(ndx, ndx);
+    Sxx_[t] = Eigen::MatrixXd::Zero(ndx, ndx);
     Vx_[t] = Eigen::VectorXd::Zero(ndx);
     Qxx_[t] = Eigen::MatrixXd::Zero(ndx, ndx);
     Qxu_[t] = Eigen::MatrixXd::Zero(ndx, nu);
@@ -389,17 +705,76 @@ void SolverDDP::allocateData() {
     us_try_[t] = Eigen::VectorXd::Zero(nu);
     dx_[t] = Eigen::VectorXd::Zero(ndx);
 
-    FuTVxx_p_[t] = Eigen::MatrixXd::Zero(nu, ndx);
+    FuTVxx_p_[t] = Eigen::MatrixXd::Zero(nu, ndx_next);
     Quu_llt_[t] = Eigen::LLT<Eigen::MatrixXd>(model->get_nu());
     Quuk_[t] = Eigen::VectorXd(nu);
   }
-  Vxx_.back() = Eigen::MatrixXd::Zero(ndx, ndx);
-  Vx_.back() = Eigen::VectorXd::Zero(ndx);
+  Vxx_.back() = Eigen::MatrixXd::Zero(ndx_T, ndx_T);
+  Sxx_.back() = Eigen::MatrixXd::Zero(ndx_T, ndx_T);
+  Vx_.back() = Eigen::VectorXd::Zero(ndx_T);
+  dx_.back() = Eigen::VectorXd::Zero(ndx_T);
   xs_try_.back() = problem_->get_terminalModel()->get_state()->zero();
-  fs_.back() = Eigen::VectorXd::Zero(ndx);
+  fs_.back() = Eigen::VectorXd::Zero(ndx_T);
 
-  FxTVxx_p_ = Eigen::MatrixXd::Zero(ndx, ndx);
-  fTVxx_p_ = Eigen::VectorXd::Zero(ndx);
+  // These buffers are shared among nodes, so we reserve the largest size and let them resize when the state
+  // dimension changes along the horizon
+  FxTVxx_p_ = Eigen::MatrixXd::Zero(ndx_max, ndx_max);
+  fTVxx_p_ = Eigen::VectorXd::Zero(ndx_max);
+}
+
+void SolverDDP::resizeData() {
+  // A circular append or a node update can move a node with a different dimension, so we reallocate the buffers of
+  // the nodes whose dimension has changed
+  const std::size_t& T = problem_->get_T();
+  const std::size_t& nu = problem_->get_nu_max();
+  const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
+  const boost::shared_ptr<ActionModelAbstract>& model_T = problem_->get_terminalModel();
+  for (std::size_t t = 0; t <= T; ++t) {
+    const boost::shared_ptr<StateAbstract>& state = t < T ? models[t]->get_state() : model_T->get_state();
+    const std::size_t& ndx = state->get_ndx();
+    if (static_cast<std::size_t>(Vx_[t].size()) != ndx) {
+      Vxx_[t] = Eigen::MatrixXd::Zero(ndx, ndx);
+      Sxx_[t] = Eigen::MatrixXd::Zero(ndx, ndx);
+      Vx_[t] = Eigen::VectorXd::Zero(ndx);
+      fs_[t] = Eigen::VectorXd::Zero(ndx);
+      dx_[t] = Eigen::VectorXd::Zero(ndx);
+      if (t < T) {
+        Qxx_[t] = Eigen::MatrixXd::Zero(ndx, ndx);
+        Qxu_[t] = Eigen::MatrixXd::Zero(ndx, nu);
+        Qx_[t] = Eigen::VectorXd::Zero(ndx);
+        K_[t] = Eigen::MatrixXd::Zero(nu, ndx);
+      }
+    }
+    if (static_cast<std::size_t>(xs_try_[t].size()) != state->get_nx()) {
+      xs_try_[t] = state->zero();
+    }
+    if (t < T) {
+      if (static_cast<std::size_t>(us_try_[t].size()) != nu) {
+        us_try_[t] = Eigen::VectorXd::Zero(nu);
+      }
+      const std::size_t& ndx_next = (t + 1 < T ? models[t + 1] : model_T)->get_state()->get_ndx();
+      if (static_cast<std::size_t>(FuTVxx_p_[t].cols()) != ndx_next) {
+        FuTVxx_p_[t] = Eigen::MatrixXd::Zero(nu, ndx_next);
+      }
+    }
+  }
+}
+
+PassStatus SolverDDP::computeDirectionStep(const bool& recalcDiff) {
+  if (recalcDiff) {
+    calcDiffAndBackwardPass();
+  } else {
+    backwardPass();
+  }
+  return pass_status_;
+}
+
+PassStatus SolverDDP::tryStepLength(const double& steplength) {
+  forwardPass(steplength);
+  if (pass_status_ == PassSuccess) {
+    dV_ = cost_ - cost_try_;
+  }
+  return pass_status_;
 }
 
 const double& SolverDDP::get_regfactor() const { return regfactor_; }
@@ -418,8 +793,14 @@ const double& SolverDDP::get_th_grad() const { return th_grad_; }
 
 const double& SolverDDP::get_th_gaptol() const { return th_gaptol_; }
 
+PassStatus SolverDDP::get_pass_status() const { return pass_status_; }
+
+bool SolverDDP::get_square_root() const { return square_root_; }
+
 const std::vector<Eigen::MatrixXd>& SolverDDP::get_Vxx() const { return Vxx_; }
 
+const std::vector<Eigen::MatrixXd>& SolverDDP::get_Sxx() const { return Sxx_; }
+
 const std::vector<Eigen::VectorXd>& SolverDDP::get_Vx() const { return Vx_; }
 
 const std::vector<Eigen::MatrixXd>& SolverDDP::get_Qxx() const { return Qxx_; }
@@ -514,4 +895,6 @@ void SolverDDP::set_th_gaptol(const double& th_gaptol) {
   th_gaptol_ = th_gaptol;
 }
 
+void SolverDDP::set_square_root(const bool& square_root) { square_root_ = square_root; }
+
 }  // namespace crocoddyl
@@ -12,14 +12,16 @@
 namespace crocoddyl {
 
 SolverFDDP::SolverFDDP(boost::shared_ptr<ShootingProblem> problem)
-    : SolverDDP(problem), dg_(0), dq_(0), dv_(0), th_acceptnegstep_(2) {}
+    : SolverDDP(problem), dg_(0), dq_(0), dv_(0), th_acceptnegstep_(2), speculative_(false) {}
 
 SolverFDDP::~SolverFDDP() {}
 
 bool SolverFDDP::solve(const std::vector<Eigen::VectorXd>& init_xs, const std::vector<Eigen::VectorXd>& init_us,
                        const std::size_t& maxiter, const bool& is_feasible, const double& reginit) {
-  xs_try_[0] = problem_->get_x0();  // it is needed in case that init_xs[0] is infeasible
   setCandidate(init_xs, init_us, is_feasible);
+  resizeData();
+  updateTrialDatas();
+  datas_linearized_ = false;
 
   if (std::isnan(reginit)) {
     xreg_ = regmin_;
@@ -32,30 +34,30 @@ bool SolverFDDP::solve(const std::vector<Eigen::VectorXd>& init_xs, const std::v
 
   bool recalcDiff = true;
   for (iter_ = 0; iter_ < maxiter; ++iter_) {
+    if (isCancelled()) {
+      return false;
+    }
     while (true) {
-      try {
-        computeDirection(recalcDiff);
-      } catch (std::exception& e) {
-        recalcDiff = false;
-        increaseRegularization();
-        if (xreg_ == regmax_) {
-          return false;
-        } else {
-          continue;
-        }
+      if (computeDirectionStep(recalcDiff) == PassSuccess) {
+        break;
+      }
+      recalcDiff = false;
+      increaseRegularization();
+      if (xreg_ == regmax_) {
+        return false;
       }
-      break;
     }
     updateExpectedImprovement();
 
     // We need to recalculate the derivatives when the step length passes
     recalcDiff = false;
     for (std::vector<double>::const_iterator it = alphas_.begin(); it != alphas_.end(); ++it) {
+      if (isCancelled()) {
+        return false;
+      }
       steplength_ = *it;
 
-      try {
-        dV_ = tryStep(steplength_);
-      } catch (std::exception& e) {
+      if (tryStepLength(steplength_) != PassSuccess) {
         continue;
       }
       expectedImprovement();
@@ -64,7 +66,7 @@ bool SolverFDDP::solve(const std::vector<Eigen::VectorXd>& init_xs, const std::v
       if (dVexp_ >= 0) {  // descend direction
         if (d_[0] < th_grad_ || dV_ > th_acceptstep_ * dVexp_) {
           was_feasible_ = is_feasible_;
-          setCandidate(xs_try_, us_try_, (was_feasible_) || (steplength_ == 1));
+          acceptStep((was_feasible_) || (steplength_ == 1));
           cost_ = cost_try_;
           recalcDiff = true;
           break;
@@ -72,7 +74,7 @@ bool SolverFDDP::solve(const std::vector<Eigen::VectorXd>& init_xs, const std::v
       } else {  // reducing the gaps by allowing a small increment in the cost value
         if (dV_ > th_acceptnegstep_ * dVexp_) {
           was_feasible_ = is_feasible_;
-          setCandidate(xs_try_, us_try_, (was_feasible_) || (steplength_ == 1));
+          acceptStep((was_feasible_) || (steplength_ == 1));
           cost_ = cost_try_;
           recalcDiff = true;
           break;
@@ -108,12 +110,18 @@ const Eigen::Vector2d& SolverFDDP::expectedImprovement() {
   dv_ = 0;
   const std::size_t& T = this->problem_->get_T();
   if (!is_feasible_) {
-    problem_->get_terminalModel()->get_state()->diff(xs_try_.back(), xs_.back(), dx_.back());
+    if (common_state_) {
+      common_state_->diffTrajectory(xs_try_, xs_, dx_);
+    } else {
+      problem_->get_terminalModel()->get_state()->diff(xs_try_.back(), xs_.back(), dx_.back());
+      const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
+      for (std::size_t t = 0; t < T; ++t) {
+        models[t]->get_state()->diff(xs_try_[t], xs_[t], dx_[t]);
+      }
+    }
     fTVxx_p_.noalias() = Vxx_.back() * dx_.back();
     dv_ -= fs_.back().dot(fTVxx_p_);
-    const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
     for (std::size_t t = 0; t < T; ++t) {
-      models[t]->get_state()->diff(xs_try_[t], xs_[t], dx_[t]);
       fTVxx_p_.noalias() = Vxx_[t] * dx_[t];
       dv_ -= fs_[t].dot(fTVxx_p_);
     }
@@ -127,6 +135,7 @@ void SolverFDDP::updateExpectedImprovement() {
   dg_ = 0;
   dq_ = 0;
   const std::size_t& T = this->problem_->get_T();
+  common_state_ = problem_->get_commonState();
   if (!is_feasible_) {
     dg_ -= Vx_.back().dot(fs_.back());
     fTVxx_p_.noalias() = Vxx_.back() * fs_.back();
@@ -152,45 +161,66 @@ void SolverFDDP::forwardPass(const double& steplength) {
     throw_pretty("Invalid argument: "
                  << "invalid step length, value is between 0. to 1.");
   }
+  pass_status_ = PassSuccess;
+  trial_linearized_ = false;
   cost_try_ = 0.;
   xnext_ = problem_->get_x0();
   const std::size_t& T = problem_->get_T();
   const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
-  const std::vector<boost::shared_ptr<ActionDataAbstract> >& datas = problem_->get_runningDatas();
+  const std::vector<boost::shared_ptr<ActionDataAbstract> >& datas = running_datas_try_;
   if ((is_feasible_) || (steplength == 1)) {
-    for (std::size_t t = 0; t < T; ++t) {
-      const boost::shared_ptr<ActionModelAbstract>& m = models[t];
-      const boost::shared_ptr<ActionDataAbstract>& d = datas[t];
-      const std::size_t& nu = m->get_nu();
+    // A full step is the most likely one to be accepted, so we speculatively linearize each node once its rollout is
+    // done. Its derivatives are computed by other threads while the rollout continues, and they are simply discarded
+    // if the step is rejected.
+    const bool speculate = speculative_ && steplength == 1;
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel if (speculate)
+#pragma omp single
+#endif
+    {
+      for (std::size_t t = 0; t < T; ++t) {
+        const boost::shared_ptr<ActionModelAbstract>& m = models[t];
+        const boost::shared_ptr<ActionDataAbstract>& d = datas[t];
+        const std::size_t& nu = m->get_nu();
 
-      xs_try_[t] = xnext_;
-      m->get_state()->diff(xs_[t], xs_try_[t], dx_[t]);
-      if (nu != 0) {
-        us_try_[t].head(nu).noalias() = us_[t].head(nu) - k_[t].head(nu) * steplength - K_[t].topRows(nu) * dx_[t];
-        m->calc(d, xs_try_[t], us_try_[t].head(nu));
-      } else {
-        m->calc(d, xs_try_[t]);
-      }
-      xnext_ = d->xnext;
-      cost_try_ += d->cost;
+        xs_try_[t] = xnext_;
+        m->get_state()->diff(xs_[t], xs_try_[t], dx_[t]);
+        if (nu != 0) {
+          us_try_[t].head(nu).noalias() = us_[t].head(nu) - k_[t].head(nu) * steplength - K_[t].topRows(nu) * dx_[t];
+          m->calc(d, xs_try_[t], us_try_[t].head(nu));
+        } else {
+          m->calc(d, xs_try_[t]);
+        }
+        xnext_ = d->xnext;
+        cost_try_ += d->cost;
 
-      if (raiseIfNaN(cost_try_)) {
-        throw_pretty("forward_error");
-      }
-      if (raiseIfNaN(xnext_.lpNorm<Eigen::Infinity>())) {
-        throw_pretty("forward_error");
+        if (raiseIfNaN(cost_try_) || raiseIfNaN(xnext_.lpNorm<Eigen::Infinity>())) {
+          pass_status_ = ForwardError;
+          break;
+        }
+        if (speculate) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp task firstprivate(t)
+#endif
+          linearizeTrialNode(t);
+        }
       }
-    }
 
-    const boost::shared_ptr<ActionModelAbstract>& m = problem_->get_terminalModel();
-    const boost::shared_ptr<ActionDataAbstract>& d = problem_->get_terminalData();
-    xs_try_.back() = xnext_;
-    m->calc(d, xs_try_.back());
-    cost_try_ += d->cost;
+      if (pass_status_ == PassSuccess) {
+        const boost::shared_ptr<ActionModelAbstract>& m = problem_->get_terminalModel();
+        const boost::shared_ptr<ActionDataAbstract>& d = terminal_data_try_;
+        xs_try_.back() = xnext_;
+        m->calc(d, xs_try_.back());
+        cost_try_ += d->cost;
 
-    if (raiseIfNaN(cost_try_)) {
-      throw_pretty("forward_error");
+        if (raiseIfNaN(cost_try_)) {
+          pass_status_ = ForwardError;
+        } else if (speculate) {
+          linearizeTrialNode(T);
+        }
+      }
     }
+    trial_linearized_ = speculate && pass_status_ == PassSuccess;
   } else {
     for (std::size_t t = 0; t < T; ++t) {
       const boost::shared_ptr<ActionModelAbstract>& m = models[t];
@@ -207,26 +237,38 @@ void SolverFDDP::forwardPass(const double& steplength) {
       xnext_ = d->xnext;
       cost_try_ += d->cost;
 
-      if (raiseIfNaN(cost_try_)) {
-        throw_pretty("forward_error");
-      }
-      if (raiseIfNaN(xnext_.lpNorm<Eigen::Infinity>())) {
-        throw_pretty("forward_error");
+      if (raiseIfNaN(cost_try_) || raiseIfNaN(xnext_.lpNorm<Eigen::Infinity>())) {
+        pass_status_ = ForwardError;
+        return;
       }
     }
 
     const boost::shared_ptr<ActionModelAbstract>& m = problem_->get_terminalModel();
-    const boost::shared_ptr<ActionDataAbstract>& d = problem_->get_terminalData();
+    const boost::shared_ptr<ActionDataAbstract>& d = terminal_data_try_;
     m->get_state()->integrate(xnext_, fs_.back() * (steplength - 1), xs_try_.back());
     m->calc(d, xs_try_.back());
     cost_try_ += d->cost;
 
     if (raiseIfNaN(cost_try_)) {
-      throw_pretty("forward_error");
+      pass_status_ = ForwardError;
     }
   }
 }
 
+void SolverFDDP::linearizeTrialNode(const std::size_t& t) {
+  if (t == problem_->get_T()) {
+    problem_->get_terminalModel()->calcDiff(terminal_data_try_, xs_try_.back());
+    return;
+  }
+  const boost::shared_ptr<ActionModelAbstract>& m = problem_->get_runningModels()[t];
+  const std::size_t& nu = m->get_nu();
+  if (nu != 0) {
+    m->calcDiff(running_datas_try_[t], xs_try_[t], us_try_[t].head(nu));
+  } else {
+    m->calcDiff(running_datas_try_[t], xs_try_[t]);
+  }
+}
+
 double SolverFDDP::get_th_acceptnegstep() const { return th_acceptnegstep_; }
 
 void SolverFDDP::set_th_acceptnegstep(const double& th_acceptnegstep) {
@@ -237,4 +279,8 @@ void SolverFDDP::set_th_acceptnegstep(const double& th_acceptnegstep) {
   th_acceptnegstep_ = th_acceptnegstep;
 }
 
+bool SolverFDDP::get_speculative() const { return speculative_; }
+
+void SolverFDDP::set_speculative(const bool& speculative) { speculative_ = speculative; }
+
 }  // namespace crocoddyl
@@ -34,8 +34,26 @@ SolverKKT::~SolverKKT() {}
 bool SolverKKT::solve(const std::vector<Eigen::VectorXd>& init_xs, const std::vector<Eigen::VectorXd>& init_us,
                       const std::size_t& maxiter, const bool& is_feasible, const double&) {
   setCandidate(init_xs, init_us, is_feasible);
+
+  // A circular append or a node update can change the dimension of the nodes, so we reallocate the KKT system when
+  // it does not match them anymore
+  const std::size_t& T = problem_->get_T();
+  const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
+  bool is_allocated = static_cast<std::size_t>(dxs_.back().size()) ==
+                      problem_->get_terminalModel()->get_state()->get_ndx();
+  for (std::size_t t = 0; t < T && is_allocated; ++t) {
+    is_allocated = static_cast<std::size_t>(dxs_[t].size()) == models[t]->get_state()->get_ndx() &&
+                   static_cast<std::size_t>(dus_[t].size()) == models[t]->get_nu();
+  }
+  if (!is_allocated) {
+    allocateData();
+  }
+
   bool recalc = true;
   for (iter_ = 0; iter_ < maxiter; ++iter_) {
+    if (isCancelled()) {
+      return false;
+    }
     while (true) {
       try {
         computeDirection(recalc);
@@ -52,6 +70,9 @@ bool SolverKKT::solve(const std::vector<Eigen::VectorXd>& init_xs, const std::ve
 
     expectedImprovement();
     for (std::vector<double>::const_iterator it = alphas_.begin(); it != alphas_.end(); ++it) {
+      if (isCancelled()) {
+        return false;
+      }
       steplength_ = *it;
       try {
         dV_ = tryStep(steplength_);
@@ -114,12 +135,13 @@ double SolverKKT::tryStep(const double& steplength) {
     const boost::shared_ptr<ActionModelAbstract>& m = models[t];
 
     m->get_state()->integrate(xs_[t], steplength * dxs_[t], xs_try_[t]);
-    if (m->get_nu() != 0) {
-      us_try_[t] = us_[t];
+    const std::size_t& nu = m->get_nu();
+    if (nu != 0) {
+      us_try_[t] = us_[t].head(nu);
       us_try_[t] += steplength * dus_[t];
     }
   }
-  const boost::shared_ptr<ActionModelAbstract> m = problem_->get_terminalModel();
+  const boost::shared_ptr<ActionModelAbstract>& m = problem_->get_terminalModel();
   m->get_state()->integrate(xs_[T], steplength * dxs_[T], xs_try_[T]);
   cost_try_ = problem_->calc(xs_try_, us_try_);
   return cost_ - cost_try_;
@@ -180,18 +202,20 @@ double SolverKKT::calc() {
   cost_ = problem_->calc(xs_, us_);
   cost_ = problem_->calcDiff(xs_, us_);
 
-  // offset on constraint xnext = f(x,u) due to x0 = ref.
-  const std::size_t& cx0 = problem_->get_runningModels()[0]->get_state()->get_ndx();
-
   std::size_t ix = 0;
   std::size_t iu = 0;
   const std::size_t& T = problem_->get_T();
+  const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
   kkt_.block(ndx_ + nu_, 0, ndx_, ndx_) = Eigen::MatrixXd::Identity(ndx_, ndx_);
   for (std::size_t t = 0; t < T; ++t) {
-    const boost::shared_ptr<ActionModelAbstract>& m = problem_->get_runningModels()[t];
+    const boost::shared_ptr<ActionModelAbstract>& m = models[t];
     const boost::shared_ptr<ActionDataAbstract>& d = problem_->get_runningDatas()[t];
+    const boost::shared_ptr<ActionModelAbstract>& m_next = t + 1 < T ? models[t + 1] : problem_->get_terminalModel();
     const std::size_t& ndxi = m->get_state()->get_ndx();
+    const std::size_t& ndx_next = m_next->get_state()->get_ndx();
     const std::size_t& nui = m->get_nu();
+    // offset on constraint xnext = f(x,u) due to the previous nodes and x0 = ref.
+    const std::size_t ic = ndx_ + nu_ + ix + ndxi;
 
     // Computing the gap at the initial state
     if (t == 0) {
@@ -203,13 +227,13 @@ double SolverKKT::calc() {
     kkt_.block(ix, ndx_ + iu, ndxi, nui) = d->Lxu;
     kkt_.block(ndx_ + iu, ix, nui, ndxi) = d->Lxu.transpose();
     kkt_.block(ndx_ + iu, ndx_ + iu, nui, nui) = d->Luu;
-    kkt_.block(ndx_ + nu_ + cx0 + ix, ix, ndxi, ndxi) = -d->Fx;
-    kkt_.block(ndx_ + nu_ + cx0 + ix, ndx_ + iu, ndxi, nui) = -d->Fu;
+    kkt_.block(ic, ix, ndx_next, ndxi) = -d->Fx;
+    kkt_.block(ic, ndx_ + iu, ndx_next, nui) = -d->Fu;
 
     // Filling KKT vector
     kktref_.segment(ix, ndxi) = d->Lx;
     kktref_.segment(ndx_ + iu, nui) = d->Lu;
-    m->get_state()->diff(d->xnext, xs_[t + 1], kktref_.segment(ndx_ + nu_ + cx0 + ix, ndxi));
+    m_next->get_state()->diff(d->xnext, xs_[t + 1], kktref_.segment(ic, ndx_next));
 
     ix += ndxi;
     iu += nui;
@@ -255,15 +279,16 @@ void SolverKKT::allocateData() {
   nx_ = 0;
   ndx_ = 0;
   nu_ = 0;
-  const std::size_t& nx = problem_->get_nx();
-  const std::size_t& ndx = problem_->get_ndx();
+  const std::vector<boost::shared_ptr<ActionModelAbstract> >& models = problem_->get_runningModels();
   for (std::size_t t = 0; t < T; ++t) {
+    const std::size_t& nx = models[t]->get_state()->get_nx();
+    const std::size_t& ndx = models[t]->get_state()->get_ndx();
     if (t == 0) {
       xs_try_[t] = problem_->get_x0();
     } else {
       xs_try_[t] = Eigen::VectorXd::Constant(nx, NAN);
     }
-    const std::size_t& nu = problem_->get_runningModels()[t]->get_nu();
+    const std::size_t& nu = models[t]->get_nu();
     us_try_[t] = Eigen::VectorXd::Constant(nu, NAN);
     dxs_[t] = Eigen::VectorXd::Zero(ndx);
     dus_[t] = Eigen::VectorXd::Zero(nu);
@@ -273,8 +298,8 @@ void SolverKKT::allocateData() {
     nu_ += nu;
   }
   const boost::shared_ptr<ActionModelAbstract>& model = problem_->get_terminalModel();
-  nx_ += nx;
-  ndx_ += ndx;
+  nx_ += model->get_state()->get_nx();
+  ndx_ += model->get_state()->get_ndx();
   xs_try_.back() = problem_->get_terminalModel()->get_state()->zero();
   dxs_.back() = Eigen::VectorXd::Zero(model->get_state()->get_ndx());
   lambdas_.back() = Eigen::VectorXd::Zero(model->get_state()->get_ndx());
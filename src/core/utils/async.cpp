@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2020, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <thread>
+#include <boost/bind.hpp>
+
+#include "crocoddyl/core/utils/async.hpp"
+
+namespace crocoddyl {
+
+void runInNewThread(const boost::function<void()>& task) { std::thread(task).detach(); }
+
+SolveHandle::SolveHandle(boost::shared_ptr<SolverAbstract> solver, const std::vector<Eigen::VectorXd>& init_xs,
+                         const std::vector<Eigen::VectorXd>& init_us, const std::size_t& maxiter,
+                         const bool& is_feasible, const double& reg_init)
+    : solver_(solver),
+      init_xs_(init_xs),
+      init_us_(init_us),
+      maxiter_(maxiter),
+      is_feasible_(is_feasible),
+      reg_init_(reg_init),
+      token_(boost::make_shared<CancellationToken>()),
+      progress_(boost::make_shared<CallbackProgress>()),
+      result_(promise_.get_future().share()) {}
+
+SolveHandle::~SolveHandle() {}
+
+void SolveHandle::run() {
+  const boost::shared_ptr<CancellationToken> token = solver_->get_cancellation_token();
+  const std::vector<boost::shared_ptr<CallbackAbstract> > callbacks = solver_->getCallbacks();
+  std::vector<boost::shared_ptr<CallbackAbstract> > run_callbacks = callbacks;
+  run_callbacks.push_back(progress_);
+  solver_->set_cancellation_token(token_);
+  solver_->setCallbacks(run_callbacks);
+  try {
+    const bool converged = solver_->solve(init_xs_, init_us_, maxiter_, is_feasible_, reg_init_);
+    solver_->set_cancellation_token(token);
+    solver_->setCallbacks(callbacks);
+    promise_.set_value(converged);
+  } catch (...) {
+    solver_->set_cancellation_token(token);
+    solver_->setCallbacks(callbacks);
+    promise_.set_exception(std::current_exception());
+  }
+}
+
+void SolveHandle::cancel() { token_->cancel(); }
+
+bool SolveHandle::is_ready() const {
+  return result_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void SolveHandle::wait() const { result_.wait(); }
+
+bool SolveHandle::wait_for(const double& timeout) const {
+  return result_.wait_for(std::chrono::duration<double, std::milli>(timeout)) == std::future_status::ready;
+}
+
+bool SolveHandle::get() const { return result_.get(); }
+
+bool SolveHandle::is_cancelled() const { return token_->is_cancelled(); }
+
+const boost::shared_ptr<SolverAbstract>& SolveHandle::get_solver() const { return solver_; }
+
+const boost::shared_ptr<CallbackProgress>& SolveHandle::get_progress() const { return progress_; }
+
+boost::shared_ptr<SolveHandle> solveAsync(boost::shared_ptr<SolverAbstract> solver,
+                                          const std::vector<Eigen::VectorXd>& init_xs,
+                                          const std::vector<Eigen::VectorXd>& init_us, const std::size_t& maxiter,
+                                          const bool& is_feasible, const double& reg_init,
+                                          const SolverExecutor& executor) {
+  if (!solver) {
+    throw_pretty("Invalid argument: "
+                 << "the solver is null");
+  }
+  boost::shared_ptr<SolveHandle> handle =
+      boost::make_shared<SolveHandle>(solver, init_xs, init_us, maxiter, is_feasible, reg_init);
+  // The task owns the handle, so the handle outlives the solve even if the caller drops it
+  executor(boost::bind(&SolveHandle::run, handle));
+  return handle;
+}
+
+}  // namespace crocoddyl
@@ -66,4 +66,26 @@ void CallbackVerbose::operator()(SolverAbstract& solver) {
   }
 }
 
+CallbackProgress::CallbackProgress() : CallbackAbstract(), iter_(0), cost_(NAN), stop_(NAN) {}
+
+CallbackProgress::~CallbackProgress() {}
+
+void CallbackProgress::operator()(SolverAbstract& solver) {
+  cost_.store(solver.get_cost(), std::memory_order_relaxed);
+  stop_.store(solver.get_stop(), std::memory_order_relaxed);
+  iter_.store(solver.get_iter() + 1, std::memory_order_release);
+}
+
+void CallbackProgress::reset() {
+  cost_.store(NAN, std::memory_order_relaxed);
+  stop_.store(NAN, std::memory_order_relaxed);
+  iter_.store(0, std::memory_order_release);
+}
+
+std::size_t CallbackProgress::get_iter() const { return iter_.load(std::memory_order_acquire); }
+
+double CallbackProgress::get_cost() const { return cost_.load(std::memory_order_relaxed); }
+
+double CallbackProgress::get_stop() const { return stop_.load(std::memory_order_relaxed); }
+
 }  // namespace crocoddyl
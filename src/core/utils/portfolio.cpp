@@ -0,0 +1,268 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2020, University of Edinburgh
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <boost/bind.hpp>
+
+#include "crocoddyl/core/utils/portfolio.hpp"
+
+namespace crocoddyl {
+
+namespace {
+
+/**
+ * @brief Number of finished solves of a portfolio solve
+ *
+ * The tasks share it with the portfolio, as they can signal it after the portfolio has returned.
+ */
+struct SolveCompletions {
+  SolveCompletions() : count(0) {}
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::size_t count;
+};
+
+void runAndSignal(const boost::function<void()>& task, const boost::shared_ptr<SolveCompletions>& completions) {
+  task();
+  {
+    std::lock_guard<std::mutex> lock(completions->mutex);
+    ++completions->count;
+  }
+  completions->cv.notify_all();
+}
+
+/**
+ * @brief Executor that signals the completions of the tasks run by another executor
+ */
+struct SignallingExecutor {
+  SignallingExecutor(const SolverExecutor& executor, const boost::shared_ptr<SolveCompletions>& completions)
+      : executor(executor), completions(completions) {}
+
+  void operator()(const boost::function<void()>& task) const {
+    executor(boost::bind(&runAndSignal, task, completions));
+  }
+
+  SolverExecutor executor;
+  boost::shared_ptr<SolveCompletions> completions;
+};
+
+}  // namespace
+
+SolverPortfolio::SolverPortfolio(boost::shared_ptr<ShootingProblem> problem, const SolverExecutor& executor)
+    : problem_(problem), executor_(executor), best_(0) {
+  if (!problem_) {
+    throw_pretty("Invalid argument: "
+                 << "the problem is null");
+  }
+}
+
+SolverPortfolio::~SolverPortfolio() {}
+
+std::size_t SolverPortfolio::addSolver(const SolverFactory& factory, const PortfolioWarmStart warmstart,
+                                       const double& reg_init) {
+  const boost::shared_ptr<SolverAbstract> solver = factory(problem_->clone());
+  if (!solver) {
+    throw_pretty("Invalid argument: "
+                 << "the factory has returned a null solver");
+  }
+  factories_.push_back(factory);
+  warmstarts_.push_back(warmstart);
+  reg_inits_.push_back(reg_init);
+  solvers_.push_back(solver);
+  return solvers_.size() - 1;
+}
+
+void SolverPortfolio::updateProblems() {
+  for (std::size_t i = 0; i < solvers_.size(); ++i) {
+    solvers_[i] = factories_[i](problem_->clone());
+  }
+  handles_.clear();
+}
+
+bool SolverPortfolio::solve(const std::vector<Eigen::VectorXd>& init_xs, const std::vector<Eigen::VectorXd>& init_us,
+                            const std::size_t& maxiter, const double& deadline) {
+  const std::size_t n = solvers_.size();
+  if (n == 0) {
+    throw_pretty("Invalid argument: "
+                 << "the portfolio has no solvers");
+  }
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  // Warm-start and launch all the solvers. Note that the warm starts are computed before launching any solver, as
+  // the previous solution belongs to one of them.
+  std::vector<std::vector<Eigen::VectorXd> > xs(n), us(n);
+  std::vector<char> is_feasible(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    solvers_[i]->get_problem()->set_x0(problem_->get_x0());
+    is_feasible[i] = computeWarmStart(i, init_xs, init_us, xs[i], us[i]);
+  }
+  const boost::shared_ptr<SolveCompletions> completions = boost::make_shared<SolveCompletions>();
+  const SolverExecutor executor = SignallingExecutor(executor_, completions);
+  handles_.resize(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    handles_[i] = solveAsync(solvers_[i], xs[i], us[i], maxiter, is_feasible[i], reg_inits_[i], executor);
+  }
+
+  // Race them until the first one converges, all of them finish, or the deadline expires. The deadlines beyond the
+  // range of the steady clock (e.g. infinity) are waited without timeout.
+  const bool has_deadline =
+      deadline < 0.5 * std::chrono::duration<double, std::milli>(std::chrono::steady_clock::time_point::max() - start)
+                           .count();
+  const std::chrono::steady_clock::time_point stop =
+      has_deadline ? start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                 std::chrono::duration<double, std::milli>(deadline))
+                   : std::chrono::steady_clock::time_point::max();
+  const std::size_t none = n;
+  std::size_t winner = none;
+  std::size_t n_running = n;
+  std::vector<char> is_running(n, true);
+  while (true) {
+    for (std::size_t i = 0; i < n; ++i) {
+      if (is_running[i] && handles_[i]->is_ready()) {
+        is_running[i] = false;
+        --n_running;
+        try {
+          if (handles_[i]->get() && winner == none) {
+            winner = i;
+          }
+        } catch (...) {
+        }
+      }
+    }
+    if (winner != none || n_running == 0) {
+      break;
+    }
+    // Sleep until another solve finishes. Note that a solve is ready slightly before it is counted.
+    std::unique_lock<std::mutex> lock(completions->mutex);
+    while (completions->count <= n - n_running && std::chrono::steady_clock::now() < stop) {
+      if (has_deadline) {
+        completions->cv.wait_until(lock, stop);
+      } else {
+        completions->cv.wait(lock);
+      }
+    }
+    if (completions->count <= n - n_running) {
+      break;
+    }
+  }
+
+  // Cancel the rest, and wait for them as their solvers are reused in the next solve
+  for (std::size_t i = 0; i < n; ++i) {
+    handles_[i]->cancel();
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    handles_[i]->wait();
+  }
+
+  // Without a converged solver, we keep the feasible (or otherwise any) solver with the lowest cost among the ones
+  // that have completed an iteration. Note that the cost of the others is not updated yet.
+  best_ = winner;
+  if (best_ == none) {
+    std::size_t first_valid = none;
+    for (std::size_t i = 0; i < n; ++i) {
+      try {
+        handles_[i]->get();
+      } catch (...) {
+        continue;
+      }
+      if (first_valid == none) {
+        first_valid = i;
+      }
+      if (handles_[i]->get_progress()->get_iter() == 0) {
+        continue;
+      }
+      const boost::shared_ptr<SolverAbstract>& solver = solvers_[i];
+      if (best_ == none || (solver->get_is_feasible() && !solvers_[best_]->get_is_feasible()) ||
+          (solver->get_is_feasible() == solvers_[best_]->get_is_feasible() &&
+           solver->get_cost() < solvers_[best_]->get_cost())) {
+        best_ = i;
+      }
+    }
+    if (best_ == none) {
+      best_ = first_valid;
+    }
+    if (best_ == none) {
+      best_ = 0;
+      handles_[0]->get();  // all the solvers have failed, so we rethrow the first exception
+    }
+  }
+  xs_ = solvers_[best_]->get_xs();
+  us_ = solvers_[best_]->get_us();
+  return winner != none;
+}
+
+bool SolverPortfolio::computeWarmStart(const std::size_t& i, const std::vector<Eigen::VectorXd>& init_xs,
+                                       const std::vector<Eigen::VectorXd>& init_us, std::vector<Eigen::VectorXd>& xs,
+                                       std::vector<Eigen::VectorXd>& us) {
+  const boost::shared_ptr<ShootingProblem>& problem = solvers_[i]->get_problem();
+  const std::size_t& T = problem->get_T();
+  switch (warmstarts_[i]) {
+    case WarmStartPrevious:
+      if (!xs_.empty()) {
+        xs = xs_;
+        us = us_;
+        return false;
+      }
+      xs = init_xs;
+      us = init_us;
+      return false;
+    case WarmStartQuasiStatic:
+      if (init_xs.empty()) {
+        // The nodes with another state than the initial one start from their zero state
+        xs.resize(T + 1);
+        for (std::size_t t = 0; t <= T; ++t) {
+          const boost::shared_ptr<StateAbstract>& state =
+              t < T ? problem->get_runningModels()[t]->get_state() : problem->get_terminalModel()->get_state();
+          xs[t] = state->get_nx() == problem->get_nx() ? problem->get_x0() : state->zero();
+        }
+      } else {
+        xs = init_xs;
+      }
+      us.assign(T, Eigen::VectorXd::Zero(problem->get_nu_max()));
+      problem->quasiStatic(us, std::vector<Eigen::VectorXd>(xs.begin(), xs.begin() + T));
+      return false;
+    case WarmStartRollout:
+      if (init_us.empty()) {
+        us.assign(T, Eigen::VectorXd::Zero(problem->get_nu_max()));
+      } else {
+        us = init_us;
+      }
+      xs.resize(T + 1);
+      problem->rollout(us, xs);
+      return true;
+    default:
+      xs = init_xs;
+      us = init_us;
+      return false;
+  }
+}
+
+const boost::shared_ptr<ShootingProblem>& SolverPortfolio::get_problem() const { return problem_; }
+
+const std::vector<boost::shared_ptr<SolverAbstract> >& SolverPortfolio::get_solvers() const { return solvers_; }
+
+const std::vector<PortfolioWarmStart>& SolverPortfolio::get_warmstarts() const { return warmstarts_; }
+
+const std::vector<boost::shared_ptr<SolveHandle> >& SolverPortfolio::get_handles() const { return handles_; }
+
+std::size_t SolverPortfolio::get_best() const { return best_; }
+
+const boost::shared_ptr<SolverAbstract>& SolverPortfolio::get_best_solver() const { return solvers_[best_]; }
+
+const std::vector<Eigen::VectorXd>& SolverPortfolio::get_xs() const { return xs_; }
+
+const std::vector<Eigen::VectorXd>& SolverPortfolio::get_us() const { return us_; }
+
+const SolverExecutor& SolverPortfolio::get_executor() const { return executor_; }
+
+void SolverPortfolio::set_executor(const SolverExecutor& executor) { executor_ = executor; }
+
+}  // namespace crocoddyl
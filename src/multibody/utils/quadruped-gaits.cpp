@@ -10,6 +10,9 @@
 
 namespace crocoddyl {
 
+SimpleQuadrupedGaitProblem::KnotTask::KnotTask()
+    : com(Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity())) {}
+
 SimpleQuadrupedGaitProblem::SimpleQuadrupedGaitProblem(const pinocchio::Model& rmodel, const std::string& lf_foot,
                                                        const std::string& rf_foot, const std::string& lh_foot,
                                                        const std::string& rh_foot)
@@ -29,6 +32,29 @@ SimpleQuadrupedGaitProblem::SimpleQuadrupedGaitProblem(const pinocchio::Model& r
       defaultstate_(rmodel_.nq + rmodel_.nv) {
   defaultstate_.head(rmodel_.nq) = rmodel_.referenceConfigurations["standing"];
   defaultstate_.tail(rmodel_.nv).setZero();
+
+  // Regularization costs shared by all the nodes, since their references do not change along the gait
+  Eigen::VectorXd state_weights(2 * rmodel_.nv);
+  state_weights.head<3>().fill(0.);
+  state_weights.segment<3>(3).fill(pow(500., 2));
+  state_weights.segment(6, rmodel_.nv - 6).fill(pow(0.01, 2));
+  state_weights.segment(rmodel_.nv, 6).fill(pow(10., 2));
+  state_weights.segment(rmodel_.nv + 6, rmodel_.nv - 6).fill(pow(1., 2));
+  swing_state_reg_ = boost::make_shared<crocoddyl::CostModelState>(
+      state_, boost::make_shared<crocoddyl::ActivationModelWeightedQuad>(state_weights), defaultstate_,
+      actuation_->get_nu());
+
+  state_weights.segment(rmodel_.nv, rmodel_.nv).fill(pow(10., 2));
+  pseudo_state_reg_ = boost::make_shared<crocoddyl::CostModelState>(
+      state_, boost::make_shared<crocoddyl::ActivationModelWeightedQuad>(state_weights), defaultstate_,
+      actuation_->get_nu());
+
+  state_weights.head<6>().fill(1.);
+  state_weights.segment(6, rmodel_.nv - 6).fill(pow(10., 2));
+  impulse_state_reg_ = boost::make_shared<crocoddyl::CostModelState>(
+      state_, boost::make_shared<crocoddyl::ActivationModelWeightedQuad>(state_weights), defaultstate_, 0);
+
+  ctrl_reg_ = boost::make_shared<crocoddyl::CostModelControl>(state_, actuation_->get_nu());
 }
 
 SimpleQuadrupedGaitProblem::~SimpleQuadrupedGaitProblem() {}
@@ -52,9 +78,11 @@ boost::shared_ptr<crocoddyl::ShootingProblem> SimpleQuadrupedGaitProblem::create
   pinocchio::SE3::Vector3 comRef = (rf_foot_pos0 + rh_foot_pos0 + lf_foot_pos0 + lh_foot_pos0) / 4;
   comRef[2] = rdata_.com[0][2];
 
-  // Defining the action models along the time instances
+  // Defining the action models along the time instances, and the targets of their knots
   std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > loco3d_model;
   std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > rh_step, rf_step, lh_step, lf_step;
+  std::vector<KnotTask> loco3d_tasks;
+  std::vector<KnotTask> rh_tasks, rf_tasks, lh_tasks, lf_tasks;
 
   // doublesupport
   std::vector<pinocchio::FrameIndex> support_feet;
@@ -62,10 +90,9 @@ boost::shared_ptr<crocoddyl::ShootingProblem> SimpleQuadrupedGaitProblem::create
   support_feet.push_back(rf_foot_id_);
   support_feet.push_back(lh_foot_id_);
   support_feet.push_back(rh_foot_id_);
-  Eigen::Vector3d nullCoM = Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity());
-  const std::vector<crocoddyl::FramePlacement> emptyVector;
   std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > doubleSupport(
-      supportknots, createSwingFootModel(timestep, support_feet, nullCoM, emptyVector));
+      supportknots, createSwingFootModel(timestep, support_feet));
+  const std::vector<KnotTask> doubleSupportTasks(supportknots);
 
   const pinocchio::FrameIndex rh_s[] = {lf_foot_id_, rf_foot_id_, lh_foot_id_};
   const pinocchio::FrameIndex rf_s[] = {lf_foot_id_, lh_foot_id_, rh_foot_id_};
@@ -88,20 +115,20 @@ boost::shared_ptr<crocoddyl::ShootingProblem> SimpleQuadrupedGaitProblem::create
   std::vector<Eigen::Vector3d> lf_foot_pos0_v(1, lf_foot_pos0);
   if (firtstep_) {
     rh_step = createFootStepModels(timestep, comRef, rh_foot_pos0_v, 0.5 * steplength, stepheight, stepknots,
-                                   rh_support, rh_foot);
+                                   rh_support, rh_foot, rh_tasks);
     rf_step = createFootStepModels(timestep, comRef, rf_foot_pos0_v, 0.5 * steplength, stepheight, stepknots,
-                                   rf_support, rf_foot);
+                                   rf_support, rf_foot, rf_tasks);
     firtstep_ = false;
   } else {
-    rh_step =
-        createFootStepModels(timestep, comRef, rh_foot_pos0_v, steplength, stepheight, stepknots, rh_support, rh_foot);
-    rf_step =
-        createFootStepModels(timestep, comRef, rf_foot_pos0_v, steplength, stepheight, stepknots, rf_support, rf_foot);
+    rh_step = createFootStepModels(timestep, comRef, rh_foot_pos0_v, steplength, stepheight, stepknots, rh_support,
+                                   rh_foot, rh_tasks);
+    rf_step = createFootStepModels(timestep, comRef, rf_foot_pos0_v, steplength, stepheight, stepknots, rf_support,
+                                   rf_foot, rf_tasks);
   }
-  lh_step =
-      createFootStepModels(timestep, comRef, lh_foot_pos0_v, steplength, stepheight, stepknots, lh_support, lh_foot);
-  lf_step =
-      createFootStepModels(timestep, comRef, lf_foot_pos0_v, steplength, stepheight, stepknots, lf_support, lf_foot);
+  lh_step = createFootStepModels(timestep, comRef, lh_foot_pos0_v, steplength, stepheight, stepknots, lh_support,
+                                 lh_foot, lh_tasks);
+  lf_step = createFootStepModels(timestep, comRef, lf_foot_pos0_v, steplength, stepheight, stepknots, lf_support,
+                                 lf_foot, lf_tasks);
 
   loco3d_model.insert(loco3d_model.end(), doubleSupport.begin(), doubleSupport.end());
   loco3d_model.insert(loco3d_model.end(), rh_step.begin(), rh_step.end());
@@ -109,19 +136,34 @@ boost::shared_ptr<crocoddyl::ShootingProblem> SimpleQuadrupedGaitProblem::create
   loco3d_model.insert(loco3d_model.end(), doubleSupport.begin(), doubleSupport.end());
   loco3d_model.insert(loco3d_model.end(), lh_step.begin(), lh_step.end());
   loco3d_model.insert(loco3d_model.end(), lf_step.begin(), lf_step.end());
-
-  return boost::make_shared<crocoddyl::ShootingProblem>(x0, loco3d_model, loco3d_model.back());
+  loco3d_tasks.insert(loco3d_tasks.end(), doubleSupportTasks.begin(), doubleSupportTasks.end());
+  loco3d_tasks.insert(loco3d_tasks.end(), rh_tasks.begin(), rh_tasks.end());
+  loco3d_tasks.insert(loco3d_tasks.end(), rf_tasks.begin(), rf_tasks.end());
+  loco3d_tasks.insert(loco3d_tasks.end(), doubleSupportTasks.begin(), doubleSupportTasks.end());
+  loco3d_tasks.insert(loco3d_tasks.end(), lh_tasks.begin(), lh_tasks.end());
+  loco3d_tasks.insert(loco3d_tasks.end(), lf_tasks.begin(), lf_tasks.end());
+
+  // The knots share the models of their phase, so their targets are set in their datas
+  boost::shared_ptr<crocoddyl::ShootingProblem> problem =
+      boost::make_shared<crocoddyl::ShootingProblem>(x0, loco3d_model, loco3d_model.back());
+  const std::vector<boost::shared_ptr<crocoddyl::ActionDataAbstract> >& datas = problem->get_runningDatas();
+  for (std::size_t t = 0; t < loco3d_model.size(); ++t) {
+    setKnotTask(loco3d_model[t], datas[t], loco3d_tasks[t]);
+  }
+  setKnotTask(loco3d_model.back(), problem->get_terminalData(), loco3d_tasks.back());
+  return problem;
 }
 
 std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > SimpleQuadrupedGaitProblem::createFootStepModels(
     double timestep, Eigen::Vector3d& com_pos0, std::vector<Eigen::Vector3d>& feet_pos0, double steplength,
     double stepheight, std::size_t n_knots, const std::vector<pinocchio::FrameIndex>& support_foot_ids,
-    const std::vector<pinocchio::FrameIndex>& swingFootIds) {
+    const std::vector<pinocchio::FrameIndex>& swingFootIds, std::vector<KnotTask>& knot_tasks) {
   std::size_t n_legs = static_cast<std::size_t>(support_foot_ids.size() + swingFootIds.size());
   double com_percentage = static_cast<double>(swingFootIds.size()) / static_cast<double>(n_legs);
 
-  // Action models for the foot swing
-  std::vector<boost::shared_ptr<ActionModelAbstract> > foot_swing_model;
+  // Action models for the foot swing, which are shared by the knots
+  std::vector<boost::shared_ptr<ActionModelAbstract> > foot_swing_model(
+      n_knots, createSwingFootModel(timestep, support_foot_ids, swingFootIds, true));
   std::vector<crocoddyl::FramePlacement> foot_swing_task;
   for (std::size_t k = 0; k < n_knots; ++k) {
     double _kp1_n = 0;
@@ -145,12 +187,17 @@ std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > SimpleQuadrupedG
           crocoddyl::FramePlacement(swingFootIds[i], pinocchio::SE3(Eigen::Matrix3d::Identity(), tref)));
     }
 
-    // Action model for the foot switch
-    Eigen::Vector3d com_task = Eigen::Vector3d(steplength * _kp1_n, 0., 0.) * com_percentage + com_pos0;
-    foot_swing_model.push_back(createSwingFootModel(timestep, support_foot_ids, com_task, foot_swing_task));
+    // Targets of the knot
+    KnotTask task;
+    task.com = Eigen::Vector3d(steplength * _kp1_n, 0., 0.) * com_percentage + com_pos0;
+    task.swingFeet = foot_swing_task;
+    knot_tasks.push_back(task);
   }
   // Action model for the foot switch
-  foot_swing_model.push_back(createFootSwitchModel(support_foot_ids, foot_swing_task));
+  foot_swing_model.push_back(createFootSwitchModel(support_foot_ids, swingFootIds));
+  KnotTask switch_task;
+  switch_task.swingFeet = foot_swing_task;
+  knot_tasks.push_back(switch_task);
 
   // Updating the current foot position for next step
   com_pos0 += Eigen::Vector3d(steplength * com_percentage, 0., 0.);
@@ -161,122 +208,193 @@ std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > SimpleQuadrupedG
 }
 
 boost::shared_ptr<crocoddyl::ActionModelAbstract> SimpleQuadrupedGaitProblem::createSwingFootModel(
-    double timestep, const std::vector<pinocchio::FrameIndex>& support_foot_ids, const Eigen::Vector3d& com_task,
-    const std::vector<crocoddyl::FramePlacement>& foot_swing_task) {
-  // Creating a 3D multi-contact model, and then including the supporting foot
-  boost::shared_ptr<crocoddyl::ContactModelMultiple> contact_model =
-      boost::make_shared<crocoddyl::ContactModelMultiple>(state_, actuation_->get_nu());
-  for (std::vector<pinocchio::FrameIndex>::const_iterator it = support_foot_ids.begin(); it != support_foot_ids.end();
-       ++it) {
-    crocoddyl::FrameTranslation xref(*it, Eigen::Vector3d::Zero());
-    boost::shared_ptr<crocoddyl::ContactModelAbstract> support_contact_model =
-        boost::make_shared<crocoddyl::ContactModel3D>(state_, xref, actuation_->get_nu(), Eigen::Vector2d(0., 50.));
-    contact_model->addContact(rmodel_.frames[*it].name + "_contact", support_contact_model);
+    double timestep, const std::vector<pinocchio::FrameIndex>& support_foot_ids,
+    const std::vector<pinocchio::FrameIndex>& swing_foot_ids, bool com_track) {
+  const SwingKey key(PhaseKey(support_foot_ids, swing_foot_ids), std::make_pair(com_track, timestep));
+  std::map<SwingKey, boost::shared_ptr<ActionModelAbstract> >::const_iterator it_m = swing_models_.find(key);
+  if (it_m != swing_models_.end()) {
+    return it_m->second;
   }
 
-  // Creating the cost model for a contact phase
+  // Getting the 3D multi-contact model of the supporting feet
+  boost::shared_ptr<crocoddyl::ContactModelMultiple> contact_model = getContactPrototype(support_foot_ids);
+
+  // Creating the cost model for a contact phase, whose tracking references are set by each knot
   boost::shared_ptr<crocoddyl::CostModelSum> cost_model =
       boost::make_shared<crocoddyl::CostModelSum>(state_, actuation_->get_nu());
-  if (com_task.array().allFinite()) {
-    boost::shared_ptr<crocoddyl::CostModelAbstract> com_track =
-        boost::make_shared<crocoddyl::CostModelCoMPosition>(state_, com_task, actuation_->get_nu());
-    cost_model->addCost("comTrack", com_track, 1e6);
+  if (com_track) {
+    boost::shared_ptr<crocoddyl::CostModelAbstract> com_cost =
+        boost::make_shared<crocoddyl::CostModelCoMPosition>(state_, Eigen::Vector3d::Zero(), actuation_->get_nu());
+    cost_model->addCost("comTrack", com_cost, 1e6);
   }
-  if (!foot_swing_task.empty()) {
-    for (std::vector<crocoddyl::FramePlacement>::const_iterator it = foot_swing_task.begin();
-         it != foot_swing_task.end(); ++it) {
-      crocoddyl::FrameTranslation xref(it->id, it->placement.translation());
-      boost::shared_ptr<crocoddyl::CostModelAbstract> foot_track =
-          boost::make_shared<crocoddyl::CostModelFrameTranslation>(state_, xref, actuation_->get_nu());
-      cost_model->addCost(rmodel_.frames[it->id].name + "_footTrack", foot_track, 1e6);
-    }
+  for (std::vector<pinocchio::FrameIndex>::const_iterator it = swing_foot_ids.begin(); it != swing_foot_ids.end();
+       ++it) {
+    crocoddyl::FrameTranslation xref(*it, Eigen::Vector3d::Zero());
+    boost::shared_ptr<crocoddyl::CostModelAbstract> foot_track =
+        boost::make_shared<crocoddyl::CostModelFrameTranslation>(state_, xref, actuation_->get_nu());
+    cost_model->addCost(rmodel_.frames[*it].name + "_footTrack", foot_track, 1e6);
   }
-  Eigen::VectorXd state_weights(2 * rmodel_.nv);
-  state_weights.head<3>().fill(0.);
-  state_weights.segment<3>(3).fill(pow(500., 2));
-  state_weights.segment(6, rmodel_.nv - 6).fill(pow(0.01, 2));
-  state_weights.segment(rmodel_.nv, 6).fill(pow(10., 2));
-  state_weights.segment(rmodel_.nv + 6, rmodel_.nv - 6).fill(pow(1., 2));
-  boost::shared_ptr<crocoddyl::ActivationModelAbstract> state_activation =
-      boost::make_shared<crocoddyl::ActivationModelWeightedQuad>(state_weights);
-  boost::shared_ptr<crocoddyl::CostModelAbstract> state_reg =
-      boost::make_shared<crocoddyl::CostModelState>(state_, state_activation, defaultstate_, actuation_->get_nu());
-  boost::shared_ptr<crocoddyl::CostModelAbstract> ctrl_reg =
-      boost::make_shared<crocoddyl::CostModelControl>(state_, actuation_->get_nu());
-  cost_model->addCost("stateReg", state_reg, 1e1);
-  cost_model->addCost("ctrlReg", ctrl_reg, 1e-1);
+  cost_model->addCost("stateReg", swing_state_reg_, 1e1);
+  cost_model->addCost("ctrlReg", ctrl_reg_, 1e-1);
 
   // Creating the action model for the KKT dynamics with simpletic Euler integration scheme
   boost::shared_ptr<crocoddyl::DifferentialActionModelAbstract> dmodel =
       boost::make_shared<crocoddyl::DifferentialActionModelContactFwdDynamics>(state_, actuation_, contact_model,
                                                                                cost_model);
-  return boost::make_shared<crocoddyl::IntegratedActionModelEuler>(dmodel, timestep);
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> model =
+      boost::make_shared<crocoddyl::IntegratedActionModelEuler>(dmodel, timestep);
+  swing_models_[key] = model;
+  return model;
 }
 
 boost::shared_ptr<ActionModelAbstract> SimpleQuadrupedGaitProblem::createFootSwitchModel(
     const std::vector<pinocchio::FrameIndex>& support_foot_ids,
-    const std::vector<crocoddyl::FramePlacement>& foot_swing_task, bool pseudo_impulse) {
+    const std::vector<pinocchio::FrameIndex>& swing_foot_ids, bool pseudo_impulse) {
   if (pseudo_impulse) {
-    return createPseudoImpulseModel(support_foot_ids, foot_swing_task);
+    return createPseudoImpulseModel(support_foot_ids, swing_foot_ids);
   } else {
-    return createImpulseModel(support_foot_ids, foot_swing_task);
+    return createImpulseModel(support_foot_ids, swing_foot_ids);
   }
 }
 
 boost::shared_ptr<crocoddyl::ActionModelAbstract> SimpleQuadrupedGaitProblem::createPseudoImpulseModel(
     const std::vector<pinocchio::FrameIndex>& support_foot_ids,
-    const std::vector<crocoddyl::FramePlacement>& foot_swing_task) {
-  // Creating a 3D multi-contact model, and then including the supporting foot
-  boost::shared_ptr<crocoddyl::ContactModelMultiple> contact_model =
-      boost::make_shared<crocoddyl::ContactModelMultiple>(state_, actuation_->get_nu());
-  for (std::vector<pinocchio::FrameIndex>::const_iterator it = support_foot_ids.begin(); it != support_foot_ids.end();
-       ++it) {
-    crocoddyl::FrameTranslation xref(*it, Eigen::Vector3d::Zero());
-    boost::shared_ptr<crocoddyl::ContactModelAbstract> support_contact_model =
-        boost::make_shared<crocoddyl::ContactModel3D>(state_, xref, actuation_->get_nu(), Eigen::Vector2d(0., 50.));
-    contact_model->addContact(rmodel_.frames[*it].name + "_contact", support_contact_model);
+    const std::vector<pinocchio::FrameIndex>& swing_foot_ids) {
+  const PhaseKey key(support_foot_ids, swing_foot_ids);
+  std::map<PhaseKey, boost::shared_ptr<ActionModelAbstract> >::const_iterator it_m = pseudo_impulse_models_.find(key);
+  if (it_m != pseudo_impulse_models_.end()) {
+    return it_m->second;
   }
 
-  // Creating the cost model for a contact phase
+  // Getting the 3D multi-contact model of the supporting feet
+  boost::shared_ptr<crocoddyl::ContactModelMultiple> contact_model = getContactPrototype(support_foot_ids);
+
+  // Creating the cost model for a contact phase, whose tracking references are set by each knot
   boost::shared_ptr<crocoddyl::CostModelSum> cost_model =
       boost::make_shared<crocoddyl::CostModelSum>(state_, actuation_->get_nu());
-  if (!foot_swing_task.empty()) {
-    for (std::vector<crocoddyl::FramePlacement>::const_iterator it = foot_swing_task.begin();
-         it != foot_swing_task.end(); ++it) {
-      crocoddyl::FrameTranslation xref(it->id, it->placement.translation());
-      crocoddyl::FrameMotion vref(it->id, pinocchio::Motion::Zero());
-      boost::shared_ptr<crocoddyl::CostModelAbstract> foot_track =
-          boost::make_shared<crocoddyl::CostModelFrameTranslation>(state_, xref, actuation_->get_nu());
-      boost::shared_ptr<crocoddyl::CostModelAbstract> impulse_foot_vel =
-          boost::make_shared<crocoddyl::CostModelFrameVelocity>(state_, vref, actuation_->get_nu());
-      cost_model->addCost(rmodel_.frames[it->id].name + "_footTrack", foot_track, 1e7);
-      cost_model->addCost(rmodel_.frames[it->id].name + "_impulseVel", impulse_foot_vel, 1e6);
-    }
+  for (std::vector<pinocchio::FrameIndex>::const_iterator it = swing_foot_ids.begin(); it != swing_foot_ids.end();
+       ++it) {
+    crocoddyl::FrameTranslation xref(*it, Eigen::Vector3d::Zero());
+    crocoddyl::FrameMotion vref(*it, pinocchio::Motion::Zero());
+    boost::shared_ptr<crocoddyl::CostModelAbstract> foot_track =
+        boost::make_shared<crocoddyl::CostModelFrameTranslation>(state_, xref, actuation_->get_nu());
+    boost::shared_ptr<crocoddyl::CostModelAbstract> impulse_foot_vel =
+        boost::make_shared<crocoddyl::CostModelFrameVelocity>(state_, vref, actuation_->get_nu());
+    cost_model->addCost(rmodel_.frames[*it].name + "_footTrack", foot_track, 1e7);
+    cost_model->addCost(rmodel_.frames[*it].name + "_impulseVel", impulse_foot_vel, 1e6);
   }
-  Eigen::VectorXd state_weights(2 * rmodel_.nv);
-  state_weights.head<3>().fill(0.);
-  state_weights.segment<3>(3).fill(pow(500., 2));
-  state_weights.segment(6, rmodel_.nv - 6).fill(pow(0.01, 2));
-  state_weights.segment(rmodel_.nv, rmodel_.nv).fill(pow(10., 2));
-  boost::shared_ptr<crocoddyl::ActivationModelAbstract> state_activation =
-      boost::make_shared<crocoddyl::ActivationModelWeightedQuad>(state_weights);
-  boost::shared_ptr<crocoddyl::CostModelAbstract> state_reg =
-      boost::make_shared<crocoddyl::CostModelState>(state_, state_activation, defaultstate_, actuation_->get_nu());
-  boost::shared_ptr<crocoddyl::CostModelAbstract> ctrl_reg =
-      boost::make_shared<crocoddyl::CostModelControl>(state_, actuation_->get_nu());
-  cost_model->addCost("stateReg", state_reg, 1e1);
-  cost_model->addCost("ctrlReg", ctrl_reg, 1e-3);
+  cost_model->addCost("stateReg", pseudo_state_reg_, 1e1);
+  cost_model->addCost("ctrlReg", ctrl_reg_, 1e-3);
 
   // Creating the action model for the KKT dynamics with simpletic Euler integration scheme
   boost::shared_ptr<crocoddyl::DifferentialActionModelAbstract> dmodel =
       boost::make_shared<crocoddyl::DifferentialActionModelContactFwdDynamics>(state_, actuation_, contact_model,
                                                                                cost_model);
-  return boost::make_shared<crocoddyl::IntegratedActionModelEuler>(dmodel, 0.);
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> model =
+      boost::make_shared<crocoddyl::IntegratedActionModelEuler>(dmodel, 0.);
+  pseudo_impulse_models_[key] = model;
+  return model;
 }
 
 boost::shared_ptr<ActionModelAbstract> SimpleQuadrupedGaitProblem::createImpulseModel(
-    const std::vector<pinocchio::FrameIndex>& support_foot_ids, const std::vector<FramePlacement>& foot_swing_task) {
+    const std::vector<pinocchio::FrameIndex>& support_foot_ids,
+    const std::vector<pinocchio::FrameIndex>& swing_foot_ids) {
+  const PhaseKey key(support_foot_ids, swing_foot_ids);
+  std::map<PhaseKey, boost::shared_ptr<ActionModelAbstract> >::const_iterator it_m = impulse_models_.find(key);
+  if (it_m != impulse_models_.end()) {
+    return it_m->second;
+  }
+
+  // Getting the 3D multi-impulse model of the supporting feet
+  boost::shared_ptr<crocoddyl::ImpulseModelMultiple> impulse_model = getImpulsePrototype(support_foot_ids);
+
+  // Creating the cost model for a contact phase, whose tracking references are set by each knot
+  boost::shared_ptr<crocoddyl::CostModelSum> cost_model = boost::make_shared<crocoddyl::CostModelSum>(state_, 0);
+  for (std::vector<pinocchio::FrameIndex>::const_iterator it = swing_foot_ids.begin(); it != swing_foot_ids.end();
+       ++it) {
+    crocoddyl::FrameTranslation xref(*it, Eigen::Vector3d::Zero());
+    boost::shared_ptr<crocoddyl::CostModelAbstract> foot_track =
+        boost::make_shared<crocoddyl::CostModelFrameTranslation>(state_, xref, 0);
+    cost_model->addCost(rmodel_.frames[*it].name + "_footTrack", foot_track, 1e7);
+  }
+  cost_model->addCost("stateReg", impulse_state_reg_, 1e1);
+
+  // Creating the action model for the KKT dynamics with simpletic Euler integration scheme
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> model =
+      boost::make_shared<crocoddyl::ActionModelImpulseFwdDynamics>(state_, impulse_model, cost_model);
+  impulse_models_[key] = model;
+  return model;
+}
+
+void SimpleQuadrupedGaitProblem::setKnotTask(const boost::shared_ptr<ActionModelAbstract>& model,
+                                             const boost::shared_ptr<ActionDataAbstract>& data,
+                                             const KnotTask& task) const {
+  // Getting the costs of the knot, which is either a contact phase or an impulse
+  boost::shared_ptr<crocoddyl::CostModelSum> cost_model;
+  boost::shared_ptr<crocoddyl::CostDataSum> cost_data;
+  const boost::shared_ptr<crocoddyl::IntegratedActionModelEuler>& euler_model =
+      boost::dynamic_pointer_cast<crocoddyl::IntegratedActionModelEuler>(model);
+  const boost::shared_ptr<crocoddyl::ActionModelImpulseFwdDynamics>& impulse_model =
+      boost::dynamic_pointer_cast<crocoddyl::ActionModelImpulseFwdDynamics>(model);
+  if (euler_model) {
+    const boost::shared_ptr<crocoddyl::IntegratedActionDataEuler>& euler_data =
+        boost::static_pointer_cast<crocoddyl::IntegratedActionDataEuler>(data);
+    cost_model = boost::static_pointer_cast<crocoddyl::DifferentialActionModelContactFwdDynamics>(
+                     euler_model->get_differential())
+                     ->get_costs();
+    cost_data =
+        boost::static_pointer_cast<crocoddyl::DifferentialActionDataContactFwdDynamics>(euler_data->differential)
+            ->costs;
+  } else if (impulse_model) {
+    cost_model = impulse_model->get_costs();
+    cost_data = boost::static_pointer_cast<crocoddyl::ActionDataImpulseFwdDynamics>(data)->costs;
+  } else {
+    throw_pretty("Invalid argument: "
+                 << "the model has not been created by this builder");
+  }
+
+  // Setting the targets of the knot as node references
+  if (task.com.allFinite()) {
+    cost_model->changeCostReference(cost_data, "comTrack", task.com);
+  }
+  for (std::vector<crocoddyl::FramePlacement>::const_iterator it = task.swingFeet.begin();
+       it != task.swingFeet.end(); ++it) {
+    cost_model->changeCostReference(cost_data, rmodel_.frames[it->id].name + "_footTrack",
+                                    crocoddyl::FrameTranslation(it->id, it->placement.translation()));
+  }
+}
+
+boost::shared_ptr<ContactModelMultiple> SimpleQuadrupedGaitProblem::getContactPrototype(
+    const std::vector<pinocchio::FrameIndex>& support_foot_ids) {
+  std::map<std::vector<pinocchio::FrameIndex>, boost::shared_ptr<ContactModelMultiple> >::const_iterator it_p =
+      contact_prototypes_.find(support_foot_ids);
+  if (it_p != contact_prototypes_.end()) {
+    return it_p->second;
+  }
+
   // Creating a 3D multi-contact model, and then including the supporting foot
+  boost::shared_ptr<crocoddyl::ContactModelMultiple> contact_model =
+      boost::make_shared<crocoddyl::ContactModelMultiple>(state_, actuation_->get_nu());
+  for (std::vector<pinocchio::FrameIndex>::const_iterator it = support_foot_ids.begin(); it != support_foot_ids.end();
+       ++it) {
+    crocoddyl::FrameTranslation xref(*it, Eigen::Vector3d::Zero());
+    boost::shared_ptr<crocoddyl::ContactModelAbstract> support_contact_model =
+        boost::make_shared<crocoddyl::ContactModel3D>(state_, xref, actuation_->get_nu(), Eigen::Vector2d(0., 50.));
+    contact_model->addContact(rmodel_.frames[*it].name + "_contact", support_contact_model);
+  }
+  contact_prototypes_[support_foot_ids] = contact_model;
+  return contact_model;
+}
+
+boost::shared_ptr<ImpulseModelMultiple> SimpleQuadrupedGaitProblem::getImpulsePrototype(
+    const std::vector<pinocchio::FrameIndex>& support_foot_ids) {
+  std::map<std::vector<pinocchio::FrameIndex>, boost::shared_ptr<ImpulseModelMultiple> >::const_iterator it_p =
+      impulse_prototypes_.find(support_foot_ids);
+  if (it_p != impulse_prototypes_.end()) {
+    return it_p->second;
+  }
+
+  // Creating a 3D multi-impulse model, and then including the supporting foot
   boost::shared_ptr<crocoddyl::ImpulseModelMultiple> impulse_model =
       boost::make_shared<crocoddyl::ImpulseModelMultiple>(state_);
   for (std::vector<pinocchio::FrameIndex>::const_iterator it = support_foot_ids.begin(); it != support_foot_ids.end();
@@ -285,30 +403,16 @@ boost::shared_ptr<ActionModelAbstract> SimpleQuadrupedGaitProblem::createImpulse
         boost::make_shared<crocoddyl::ImpulseModel3D>(state_, *it);
     impulse_model->addImpulse(rmodel_.frames[*it].name + "_impulse", support_contact_model);
   }
+  impulse_prototypes_[support_foot_ids] = impulse_model;
+  return impulse_model;
+}
 
-  // Creating the cost model for a contact phase
-  boost::shared_ptr<crocoddyl::CostModelSum> cost_model = boost::make_shared<crocoddyl::CostModelSum>(state_, 0);
-  if (!foot_swing_task.empty()) {
-    for (std::vector<crocoddyl::FramePlacement>::const_iterator it = foot_swing_task.begin();
-         it != foot_swing_task.end(); ++it) {
-      crocoddyl::FrameTranslation xref(it->id, it->placement.translation());
-      boost::shared_ptr<crocoddyl::CostModelAbstract> foot_track =
-          boost::make_shared<crocoddyl::CostModelFrameTranslation>(state_, xref, 0);
-      cost_model->addCost(rmodel_.frames[it->id].name + "_footTrack", foot_track, 1e7);
-    }
-  }
-  Eigen::VectorXd state_weights(2 * rmodel_.nv);
-  state_weights.head<6>().fill(1.);
-  state_weights.segment(6, rmodel_.nv - 6).fill(pow(10., 2));
-  state_weights.segment(rmodel_.nv, rmodel_.nv).fill(pow(10., 2));
-  boost::shared_ptr<crocoddyl::ActivationModelAbstract> state_activation =
-      boost::make_shared<crocoddyl::ActivationModelWeightedQuad>(state_weights);
-  boost::shared_ptr<crocoddyl::CostModelAbstract> state_reg =
-      boost::make_shared<crocoddyl::CostModelState>(state_, state_activation, defaultstate_, 0);
-  cost_model->addCost("stateReg", state_reg, 1e1);
-
-  // Creating the action model for the KKT dynamics with simpletic Euler integration scheme
-  return boost::make_shared<crocoddyl::ActionModelImpulseFwdDynamics>(state_, impulse_model, cost_model);
+void SimpleQuadrupedGaitProblem::clearPrototypes() {
+  contact_prototypes_.clear();
+  impulse_prototypes_.clear();
+  swing_models_.clear();
+  pseudo_impulse_models_.clear();
+  impulse_models_.clear();
 }
 
 const Eigen::VectorXd& SimpleQuadrupedGaitProblem::get_defaultState() const { return defaultstate_; }
@@ -11,6 +11,8 @@
 #include "impulse.hpp"
 #include "crocoddyl/core/actions/unicycle.hpp"
 #include "crocoddyl/core/actions/lqr.hpp"
+#include "crocoddyl/core/actions/diff-lqr.hpp"
+#include "crocoddyl/core/integrator/multi-rate.hpp"
 #include "crocoddyl/multibody/impulses/multiple-impulses.hpp"
 #include "crocoddyl/multibody/impulses/impulse-3d.hpp"
 #include "crocoddyl/multibody/impulses/impulse-6d.hpp"
@@ -38,6 +40,12 @@ std::ostream& operator<<(std::ostream& os, ActionModelTypes::Type type) {
     case ActionModelTypes::ActionModelImpulseFwdDynamics_Talos:
       os << "ActionModelImpulseFwdDynamics_Talos";
       break;
+    case ActionModelTypes::IntegratedActionModelMultiRateEuler:
+      os << "IntegratedActionModelMultiRateEuler";
+      break;
+    case ActionModelTypes::IntegratedActionModelMultiRateRK4:
+      os << "IntegratedActionModelMultiRateRK4";
+      break;
     case ActionModelTypes::NbActionModelTypes:
       os << "NbActionModelTypes";
       break;
@@ -77,6 +85,16 @@ boost::shared_ptr<crocoddyl::ActionModelAbstract> ActionModelFactory::create(Act
     case ActionModelTypes::ActionModelImpulseFwdDynamics_Talos:
       action = create_impulseFwdDynamics(StateModelTypes::StateMultibody_Talos);
       break;
+    case ActionModelTypes::IntegratedActionModelMultiRateEuler:
+      action = boost::make_shared<crocoddyl::IntegratedActionModelMultiRate>(
+          boost::make_shared<crocoddyl::DifferentialActionModelLQR>(40, 20, false), 1e-2, 4,
+          crocoddyl::IntegratorEuler);
+      break;
+    case ActionModelTypes::IntegratedActionModelMultiRateRK4:
+      action = boost::make_shared<crocoddyl::IntegratedActionModelMultiRate>(
+          boost::make_shared<crocoddyl::DifferentialActionModelLQR>(40, 20, false), 1e-2, 4,
+          crocoddyl::IntegratorRK4);
+      break;
     default:
       throw_pretty(__FILE__ ": Wrong ActionModelTypes::Type given");
       break;
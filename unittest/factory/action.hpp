@@ -26,6 +26,8 @@ struct ActionModelTypes {
     ActionModelLQR,
     ActionModelImpulseFwdDynamics_HyQ,
     ActionModelImpulseFwdDynamics_Talos,
+    IntegratedActionModelMultiRateEuler,
+    IntegratedActionModelMultiRateRK4,
     NbActionModelTypes
   };
   static std::vector<Type> init_all() {
@@ -18,6 +18,10 @@
 #include "crocoddyl/multibody/costs/frame-placement.hpp"
 #include "crocoddyl/multibody/costs/frame-translation.hpp"
 #include "crocoddyl/multibody/costs/contact-friction-cone.hpp"
+#include "crocoddyl/multibody/costs/centroidal-com-position.hpp"
+#include "crocoddyl/multibody/costs/centroidal-contact-force.hpp"
+#include "crocoddyl/multibody/costs/centroidal-friction-cone.hpp"
+#include "crocoddyl/core/states/euclidean.hpp"
 #include "crocoddyl/core/activations/quadratic.hpp"
 #include "crocoddyl/core/activations/quadratic-barrier.hpp"
 #include "crocoddyl/multibody/frames.hpp"
@@ -61,6 +65,9 @@ std::ostream& operator<<(std::ostream& os, DifferentialActionModelTypes::Type ty
     case DifferentialActionModelTypes::DifferentialActionModelContactFwdDynamicsWithFriction_Talos:
       os << "DifferentialActionModelContactFwdDynamicsWithFriction_Talos";
       break;
+    case DifferentialActionModelTypes::DifferentialActionModelCentroidalFwdDynamics:
+      os << "DifferentialActionModelCentroidalFwdDynamics";
+      break;
     case DifferentialActionModelTypes::NbDifferentialActionModelTypes:
       os << "NbDifferentialActionModelTypes";
       break;
@@ -115,6 +122,9 @@ boost::shared_ptr<crocoddyl::DifferentialActionModelAbstract> DifferentialAction
       action = create_contactFwdDynamics(StateModelTypes::StateMultibody_Talos,
                                          ActuationModelTypes::ActuationModelFloatingBase);
       break;
+    case DifferentialActionModelTypes::DifferentialActionModelCentroidalFwdDynamics:
+      action = create_centroidalFwdDynamics();
+      break;
     default:
       throw_pretty(__FILE__ ": Wrong DifferentialActionModelTypes::Type given");
       break;
@@ -263,5 +273,41 @@ DifferentialActionModelFactory::create_contactFwdDynamics(StateModelTypes::Type
   return action;
 }
 
+boost::shared_ptr<crocoddyl::DifferentialActionModelCentroidalFwdDynamics>
+DifferentialActionModelFactory::create_centroidalFwdDynamics() const {
+  boost::shared_ptr<crocoddyl::DifferentialActionModelCentroidalFwdDynamics> action;
+  boost::shared_ptr<crocoddyl::StateVector> state = boost::make_shared<crocoddyl::StateVector>(12);
+  boost::shared_ptr<crocoddyl::CostModelSum> cost;
+
+  // Four point contacts of a quadruped-like robot
+  Eigen::Matrix3Xd contacts(3, 4);
+  contacts << 0.4, 0.4, -0.4, -0.4, 0.2, -0.2, 0.2, -0.2, 0., 0., 0., 0.;
+  const std::size_t nu = 3 * contacts.cols();
+  Eigen::Matrix3d inertia;
+  inertia << 0.4, 0.01, 0., 0.01, 1.1, 0.02, 0., 0.02, 1.2;
+  const double mass = 20.;
+
+  crocoddyl::FrictionCone cone(Eigen::Vector3d(0, 0, 1), 0.8, 4, false);
+  crocoddyl::ActivationBounds bounds(cone.get_lb(), cone.get_ub());
+  boost::shared_ptr<crocoddyl::ActivationModelAbstract> activation =
+      boost::make_shared<crocoddyl::ActivationModelQuadraticBarrier>(bounds);
+  cost = boost::make_shared<crocoddyl::CostModelSum>(state, nu);
+  cost->addCost("com",
+                boost::make_shared<crocoddyl::CostModelCentroidalCoMPosition>(state, Eigen::Vector3d(0., 0., 0.5), nu),
+                1.);
+  for (std::size_t i = 0; i < static_cast<std::size_t>(contacts.cols()); ++i) {
+    cost->addCost("force_" + std::to_string(i),
+                  boost::make_shared<crocoddyl::CostModelCentroidalContactForce>(
+                      state, i, Eigen::Vector3d(0., 0., mass * 9.81 / 4.), nu),
+                  1e-3);
+    cost->addCost("cone_" + std::to_string(i),
+                  boost::make_shared<crocoddyl::CostModelCentroidalFrictionCone>(state, activation, i, cone, nu), 0.1);
+  }
+  cost->addCost("control", boost::make_shared<crocoddyl::CostModelControl>(state, nu), 1e-3);
+  action = boost::make_shared<crocoddyl::DifferentialActionModelCentroidalFwdDynamics>(state, mass, inertia,
+                                                                                       contacts, cost);
+  return action;
+}
+
 }  // namespace unittest
 }  // namespace crocoddyl
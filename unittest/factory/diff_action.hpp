@@ -15,6 +15,7 @@
 #include "crocoddyl/core/numdiff/diff-action.hpp"
 #include "crocoddyl/multibody/actions/free-fwddyn.hpp"
 #include "crocoddyl/multibody/actions/contact-fwddyn.hpp"
+#include "crocoddyl/multibody/actions/centroidal-fwddyn.hpp"
 
 namespace crocoddyl {
 namespace unittest {
@@ -31,6 +32,7 @@ struct DifferentialActionModelTypes {
     DifferentialActionModelContactFwdDynamicsWithFriction_TalosArm,
     DifferentialActionModelContactFwdDynamicsWithFriction_HyQ,
     DifferentialActionModelContactFwdDynamicsWithFriction_Talos,
+    DifferentialActionModelCentroidalFwdDynamics,
     NbDifferentialActionModelTypes
   };
   static std::vector<Type> init_all() {
@@ -60,6 +62,8 @@ class DifferentialActionModelFactory {
 
   boost::shared_ptr<crocoddyl::DifferentialActionModelContactFwdDynamics> create_contactFwdDynamics(
       StateModelTypes::Type state_type, ActuationModelTypes::Type actuation_type, bool with_friction = true) const;
+
+  boost::shared_ptr<crocoddyl::DifferentialActionModelCentroidalFwdDynamics> create_centroidalFwdDynamics() const;
 };
 
 }  // namespace unittest
@@ -104,6 +104,65 @@ void test_partial_derivatives_against_numdiff(ActionModelTypes::Type action_mode
   }
 }
 
+void test_clone(ActionModelTypes::Type action_model_type) {
+  // create the model and its clone
+  ActionModelFactory factory;
+  const boost::shared_ptr<crocoddyl::ActionModelAbstract>& model = factory.create(action_model_type);
+  const boost::shared_ptr<crocoddyl::ActionModelAbstract>& clone = model->clone();
+  BOOST_CHECK(clone != model);
+  BOOST_CHECK(clone->get_state() == model->get_state());
+
+  // create the corresponding data objects
+  const boost::shared_ptr<crocoddyl::ActionDataAbstract>& data = model->createData();
+  const boost::shared_ptr<crocoddyl::ActionDataAbstract>& clone_data = clone->createData();
+  BOOST_CHECK(clone->checkData(clone_data));
+
+  // Generating random values for the state and control
+  const Eigen::VectorXd& x = model->get_state()->rand();
+  const Eigen::VectorXd& u = Eigen::VectorXd::Random(model->get_nu());
+
+  // Checking that both models compute the same values
+  model->calc(data, x, u);
+  model->calcDiff(data, x, u);
+  clone->calc(clone_data, x, u);
+  clone->calcDiff(clone_data, x, u);
+  BOOST_CHECK(data->cost == clone_data->cost);
+  BOOST_CHECK((data->xnext - clone_data->xnext).isZero());
+  BOOST_CHECK((data->Fx - clone_data->Fx).isZero());
+  BOOST_CHECK((data->Fu - clone_data->Fu).isZero());
+  BOOST_CHECK((data->Lx - clone_data->Lx).isZero());
+  BOOST_CHECK((data->Lu - clone_data->Lu).isZero());
+  BOOST_CHECK((data->Lxx - clone_data->Lxx).isZero());
+  BOOST_CHECK((data->Luu - clone_data->Luu).isZero());
+}
+
+void test_numdiff_clone(ActionModelTypes::Type action_model_type) {
+  // create the numdiff model and its clone
+  ActionModelFactory factory;
+  const boost::shared_ptr<crocoddyl::ActionModelAbstract>& model = factory.create(action_model_type);
+  crocoddyl::ActionModelNumDiff model_num_diff(model);
+  model_num_diff.set_disturbance(2. * model_num_diff.get_disturbance());
+  const boost::shared_ptr<crocoddyl::ActionModelNumDiff>& clone =
+      boost::static_pointer_cast<crocoddyl::ActionModelNumDiff>(model_num_diff.clone());
+  BOOST_CHECK(clone->get_model() != model);
+  BOOST_CHECK(clone->get_disturbance() == model_num_diff.get_disturbance());
+
+  // Checking that both models compute the same derivatives
+  const boost::shared_ptr<crocoddyl::ActionDataAbstract>& data = model_num_diff.createData();
+  const boost::shared_ptr<crocoddyl::ActionDataAbstract>& clone_data = clone->createData();
+  const Eigen::VectorXd& x = model->get_state()->rand();
+  const Eigen::VectorXd& u = Eigen::VectorXd::Random(model->get_nu());
+  model_num_diff.calc(data, x, u);
+  model_num_diff.calcDiff(data, x, u);
+  clone->calc(clone_data, x, u);
+  clone->calcDiff(clone_data, x, u);
+  BOOST_CHECK(data->cost == clone_data->cost);
+  BOOST_CHECK((data->Fx - clone_data->Fx).isZero());
+  BOOST_CHECK((data->Fu - clone_data->Fu).isZero());
+  BOOST_CHECK((data->Lx - clone_data->Lx).isZero());
+  BOOST_CHECK((data->Lu - clone_data->Lu).isZero());
+}
+
 //----------------------------------------------------------------------------//
 
 void register_action_model_unit_tests(ActionModelTypes::Type action_model_type) {
@@ -115,6 +174,8 @@ void register_action_model_unit_tests(ActionModelTypes::Type action_model_type)
   ts->add(BOOST_TEST_CASE(boost::bind(&test_calc_returns_state, action_model_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_calc_returns_a_cost, action_model_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_partial_derivatives_against_numdiff, action_model_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_clone, action_model_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_numdiff_clone, action_model_type)));
   framework::master_test_suite().add(ts);
 }
 
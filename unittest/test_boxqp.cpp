@@ -134,11 +134,34 @@ void test_box_qp_with_identity_hessian() {
   BOOST_CHECK(sol_reg.clamped_idx.size() == nc_reg);
 }
 
+void test_box_qp_with_indefinite_hessian() {
+  std::size_t nx = random_int_in_range(2, 5);
+  crocoddyl::BoxQP boxqp(nx);
+  boxqp.set_reg(0.);
+
+  Eigen::MatrixXd hessian = -Eigen::MatrixXd::Identity(nx, nx);
+  Eigen::VectorXd gradient = Eigen::VectorXd::Random(nx);
+  Eigen::VectorXd lb = -std::numeric_limits<double>::infinity() * Eigen::VectorXd::Ones(nx);
+  Eigen::VectorXd ub = std::numeric_limits<double>::infinity() * Eigen::VectorXd::Ones(nx);
+  Eigen::VectorXd xinit = Eigen::VectorXd::Zero(nx);
+
+  // The free Hessian cannot be factorized, which is reported through the solution instead of an exception
+  crocoddyl::BoxQPSolution sol = boxqp.solve(hessian, gradient, lb, ub, xinit);
+  BOOST_CHECK(!sol.success);
+  BOOST_CHECK(!boxqp.get_solution().success);
+
+  // A positive-definite Hessian restores the success label
+  sol = boxqp.solve(-hessian, gradient, lb, ub, xinit);
+  BOOST_CHECK(sol.success);
+  BOOST_CHECK((sol.x + gradient).isMuchSmallerThan(1.0, 1e-9));
+}
+
 void register_unit_tests() {
   framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_constructor)));
   framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_unconstrained_qp_with_identity_hessian)));
   framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_unconstrained_qp)));
   framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_box_qp_with_identity_hessian)));
+  framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_box_qp_with_indefinite_hessian)));
 }
 
 bool init_function() {
@@ -18,7 +18,9 @@
 
 #include "crocoddyl/core/mathbase.hpp"
 #include "crocoddyl/core/codegen/action-base.hpp"
+#include "crocoddyl/core/autodiff/action.hpp"
 #include "crocoddyl/core/integrator/euler.hpp"
+#include "crocoddyl/core/optctrl/shooting.hpp"
 #include "crocoddyl/core/solvers/ddp.hpp"
 #include "crocoddyl/core/utils/callbacks.hpp"
 
@@ -364,6 +366,174 @@ void test_codegen_bipedal() {
   BOOST_CHECK(runningDataCG->Luu.isApprox(runningDataD->Luu));
   BOOST_CHECK(runningDataCG->Fx.isApprox(runningDataD->Fx));
   BOOST_CHECK(runningDataCG->Fu.isApprox(runningDataD->Fu));
+  // The clone shares the loaded library, and it evaluates the same functions
+  const boost::shared_ptr<crocoddyl::ActionModelCodeGenTpl<Scalar> >& runningModelCGClone =
+      boost::static_pointer_cast<crocoddyl::ActionModelCodeGenTpl<Scalar> >(runningModelCG->clone());
+  BOOST_CHECK(runningModelCGClone->get_library() ==
+              static_cast<crocoddyl::ActionModelCodeGenTpl<Scalar>*>(runningModelCG.get())->get_library());
+  boost::shared_ptr<crocoddyl::ActionDataAbstractTpl<Scalar> > runningDataCGClone = runningModelCGClone->createData();
+  runningModelCGClone->calc(runningDataCGClone, x_rand, u_rand);
+  runningModelCGClone->calcDiff(runningDataCGClone, x_rand, u_rand);
+  BOOST_CHECK(runningDataCGClone->xnext == runningDataCG->xnext);
+  BOOST_CHECK(runningDataCGClone->cost == runningDataCG->cost);
+  BOOST_CHECK(runningDataCGClone->Lx == runningDataCG->Lx);
+  BOOST_CHECK(runningDataCGClone->Fx == runningDataCG->Fx);
+}
+
+void test_codegen_shared_model_in_problem() {
+  typedef double Scalar;
+  typedef CppAD::cg::CG<Scalar> CGScalar;
+  typedef CppAD::AD<CGScalar> ADScalar;
+  typedef typename crocoddyl::MathBaseTpl<Scalar>::VectorXs VectorXs;
+  boost::shared_ptr<crocoddyl::ActionModelAbstractTpl<Scalar> > runningModelD = build_bipedal_action_model<Scalar>();
+  boost::shared_ptr<crocoddyl::ActionModelAbstractTpl<ADScalar> > runningModelAD =
+      build_bipedal_action_model<ADScalar>();
+  boost::shared_ptr<crocoddyl::ActionModelAbstractTpl<Scalar> > runningModelCG =
+      boost::make_shared<crocoddyl::ActionModelCodeGenTpl<Scalar> >(runningModelAD, runningModelD, "pyrene_biped");
+
+  // All the nodes share the code-generated model, and they are evaluated in parallel by the problem
+  const std::size_t T = 20;
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstractTpl<Scalar> > > runningModels(T, runningModelCG);
+  crocoddyl::ShootingProblemTpl<Scalar> problem(runningModelCG->get_state()->zero(), runningModels, runningModelCG);
+  std::vector<VectorXs> xs(T + 1), us(T);
+  for (std::size_t i = 0; i < T; ++i) {
+    xs[i] = runningModelCG->get_state()->rand();
+    us[i] = VectorXs::Random(runningModelCG->get_nu());
+  }
+  xs.back() = runningModelCG->get_state()->rand();
+  problem.calc(xs, us);
+  problem.calcDiff(xs, us);
+
+  // Check that each node is the same as the original model
+  boost::shared_ptr<crocoddyl::ActionDataAbstractTpl<Scalar> > runningDataD = runningModelD->createData();
+  for (std::size_t i = 0; i < T; ++i) {
+    const boost::shared_ptr<crocoddyl::ActionDataAbstractTpl<Scalar> >& runningDataCG = problem.get_runningDatas()[i];
+    runningModelD->calc(runningDataD, xs[i], us[i]);
+    runningModelD->calcDiff(runningDataD, xs[i], us[i]);
+    BOOST_CHECK(runningDataCG->xnext.isApprox(runningDataD->xnext));
+    BOOST_CHECK_CLOSE(runningDataCG->cost, runningDataD->cost, Scalar(1e-10));
+    BOOST_CHECK(runningDataCG->Lx.isApprox(runningDataD->Lx));
+    BOOST_CHECK(runningDataCG->Lu.isApprox(runningDataD->Lu));
+    BOOST_CHECK(runningDataCG->Fx.isApprox(runningDataD->Fx));
+    BOOST_CHECK(runningDataCG->Fu.isApprox(runningDataD->Fu));
+  }
+}
+
+#ifdef CROCODDYL_WITH_CODEGEN_LLVM
+void test_codegen_jit_bipedal() {
+  typedef double Scalar;
+  typedef CppAD::cg::CG<Scalar> CGScalar;
+  typedef CppAD::AD<CGScalar> ADScalar;
+  typedef typename crocoddyl::MathBaseTpl<Scalar>::VectorXs VectorXs;
+  boost::shared_ptr<crocoddyl::ActionModelAbstractTpl<Scalar> > runningModelD = build_bipedal_action_model<Scalar>();
+  boost::shared_ptr<crocoddyl::ActionModelAbstractTpl<ADScalar> > runningModelAD =
+      build_bipedal_action_model<ADScalar>();
+
+  // The recorded functions are compiled in memory, without writing a dynamic library
+  boost::shared_ptr<crocoddyl::ActionModelAbstractTpl<Scalar> > runningModelCG =
+      boost::make_shared<crocoddyl::ActionModelCodeGenTpl<Scalar> >(
+          runningModelAD, runningModelD, "pyrene_biped_jit", 0,
+          crocoddyl::ActionModelCodeGenTpl<Scalar>::empty_record_env, "calc", "calcDiff", crocoddyl::CodeGenJit);
+
+  // Check that code-generated action model is the same as original.
+  /**************************************************************************/
+  boost::shared_ptr<crocoddyl::ActionDataAbstractTpl<Scalar> > runningDataCG = runningModelCG->createData();
+  boost::shared_ptr<crocoddyl::ActionDataAbstractTpl<Scalar> > runningDataD = runningModelD->createData();
+  VectorXs x_rand = runningModelCG->get_state()->rand();
+  VectorXs u_rand = VectorXs::Random(runningModelCG->get_nu());
+  runningModelD->calc(runningDataD, x_rand, u_rand);
+  runningModelD->calcDiff(runningDataD, x_rand, u_rand);
+  runningModelCG->calc(runningDataCG, x_rand, u_rand);
+  runningModelCG->calcDiff(runningDataCG, x_rand, u_rand);
+
+  BOOST_CHECK(runningDataCG->xnext.isApprox(runningDataD->xnext));
+  BOOST_CHECK_CLOSE(runningDataCG->cost, runningDataD->cost, Scalar(1e-10));
+  BOOST_CHECK(runningDataCG->Lx.isApprox(runningDataD->Lx));
+  BOOST_CHECK(runningDataCG->Lu.isApprox(runningDataD->Lu));
+  BOOST_CHECK(runningDataCG->Lxx.isApprox(runningDataD->Lxx));
+  BOOST_CHECK(runningDataCG->Lxu.isApprox(runningDataD->Lxu));
+  BOOST_CHECK(runningDataCG->Luu.isApprox(runningDataD->Luu));
+  BOOST_CHECK(runningDataCG->Fx.isApprox(runningDataD->Fx));
+  BOOST_CHECK(runningDataCG->Fu.isApprox(runningDataD->Fu));
+}
+#endif  // CROCODDYL_WITH_CODEGEN_LLVM
+
+void test_autodiff_4DoFArm() {
+  typedef double Scalar;
+  typedef CppAD::AD<Scalar> ADScalar;
+  typedef typename crocoddyl::MathBaseTpl<Scalar>::VectorXs VectorXs;
+  boost::shared_ptr<crocoddyl::ActionModelAbstractTpl<Scalar> > runningModelD = build_arm_action_model<Scalar>();
+  boost::shared_ptr<crocoddyl::ActionModelAbstractTpl<ADScalar> > runningModelAD = build_arm_action_model<ADScalar>();
+
+  // The tape is recorded once, without generating code
+  boost::shared_ptr<crocoddyl::ActionModelAbstractTpl<Scalar> > runningModelTape =
+      boost::make_shared<crocoddyl::ActionModelADTpl<Scalar> >(runningModelAD, runningModelD);
+
+  // Check that the derivatives of the tape are the same as the analytical ones
+  /**************************************************************************/
+  boost::shared_ptr<crocoddyl::ActionDataAbstractTpl<Scalar> > runningDataTape = runningModelTape->createData();
+  boost::shared_ptr<crocoddyl::ActionDataAbstractTpl<Scalar> > runningDataD = runningModelD->createData();
+  VectorXs x_rand = runningModelTape->get_state()->rand();
+  VectorXs u_rand = VectorXs::Random(runningModelTape->get_nu());
+  runningModelD->calc(runningDataD, x_rand, u_rand);
+  runningModelD->calcDiff(runningDataD, x_rand, u_rand);
+  runningModelTape->calc(runningDataTape, x_rand, u_rand);
+  runningModelTape->calcDiff(runningDataTape, x_rand, u_rand);
+
+  BOOST_CHECK(runningDataTape->xnext.isApprox(runningDataD->xnext));
+  BOOST_CHECK_CLOSE(runningDataTape->cost, runningDataD->cost, Scalar(1e-10));
+  BOOST_CHECK(runningDataTape->Lx.isApprox(runningDataD->Lx));
+  BOOST_CHECK(runningDataTape->Lu.isApprox(runningDataD->Lu));
+  BOOST_CHECK(runningDataTape->Fx.isApprox(runningDataD->Fx));
+  BOOST_CHECK(runningDataTape->Fu.isApprox(runningDataD->Fu));
+  // Only the control regularization depends on the control, and it is quadratic. So the Gauss-Newton approximation
+  // of Luu and Lxu is exact
+  BOOST_CHECK(runningDataTape->Luu.isApprox(runningDataD->Luu));
+  BOOST_CHECK((runningDataTape->Lxu - runningDataD->Lxu).isZero(1e-9));
+
+  // The tape gives the exact Hessian of the cost, whereas the analytical one is a Gauss-Newton approximation. Hence,
+  // we check Lxx against the central differences of the Lx computed by the tape (the state is a vector space)
+  const std::size_t& ndx = runningModelTape->get_state()->get_ndx();
+  const Scalar h = Scalar(1e-6);
+  boost::shared_ptr<crocoddyl::ActionDataAbstractTpl<Scalar> > runningDataTapeFD = runningModelTape->createData();
+  VectorXs dx = VectorXs::Zero(ndx), x_p(x_rand.size()), x_m(x_rand.size()), Lx_p(ndx);
+  typename crocoddyl::MathBaseTpl<Scalar>::MatrixXs Lxx_fd(ndx, ndx);
+  for (std::size_t i = 0; i < ndx; ++i) {
+    dx(i) = h;
+    runningModelTape->get_state()->integrate(x_rand, dx, x_p);
+    runningModelTape->get_state()->integrate(x_rand, -dx, x_m);
+    runningModelTape->calc(runningDataTapeFD, x_p, u_rand);
+    runningModelTape->calcDiff(runningDataTapeFD, x_p, u_rand);
+    Lx_p = runningDataTapeFD->Lx;
+    runningModelTape->calc(runningDataTapeFD, x_m, u_rand);
+    runningModelTape->calcDiff(runningDataTapeFD, x_m, u_rand);
+    Lxx_fd.col(i) = (Lx_p - runningDataTapeFD->Lx) / (2 * h);
+    dx(i) = Scalar(0);
+  }
+  BOOST_CHECK(runningDataTape->Lxx.isApprox(runningDataTape->Lxx.transpose()));
+  BOOST_CHECK(runningDataTape->Lxx.isApprox(Lxx_fd, 1e-4));
+
+  // The joint-limit barriers branch on the state, so a data evaluated beyond the limits records its tape again and
+  // keeps the analytical first-order derivatives
+  VectorXs x_limit = x_rand;
+  x_limit.head(runningModelTape->get_state()->get_nq()).fill(Scalar(10.));
+  runningModelD->calc(runningDataD, x_limit, u_rand);
+  runningModelD->calcDiff(runningDataD, x_limit, u_rand);
+  runningModelTape->calc(runningDataTape, x_limit, u_rand);
+  runningModelTape->calcDiff(runningDataTape, x_limit, u_rand);
+  BOOST_CHECK(runningDataTape->Lx.isApprox(runningDataD->Lx));
+  BOOST_CHECK(runningDataTape->Lu.isApprox(runningDataD->Lu));
+  // The clone copies the tape, and it wraps a clone of the original model
+  boost::shared_ptr<crocoddyl::ActionModelAbstractTpl<Scalar> > runningModelTapeClone = runningModelTape->clone();
+  BOOST_CHECK(boost::static_pointer_cast<crocoddyl::ActionModelADTpl<Scalar> >(runningModelTapeClone)->get_model() !=
+              runningModelD);
+  boost::shared_ptr<crocoddyl::ActionDataAbstractTpl<Scalar> > runningDataTapeClone =
+      runningModelTapeClone->createData();
+  runningModelTapeClone->calc(runningDataTapeClone, x_limit, u_rand);
+  runningModelTapeClone->calcDiff(runningDataTapeClone, x_limit, u_rand);
+  BOOST_CHECK(runningDataTapeClone->Lx.isApprox(runningDataTape->Lx));
+  BOOST_CHECK(runningDataTapeClone->Lxx.isApprox(runningDataTape->Lxx));
+  BOOST_CHECK(runningDataTapeClone->Fx.isApprox(runningDataTape->Fx));
 }
 
 bool init_function() {
@@ -371,6 +541,11 @@ bool init_function() {
   test_suite* ts = BOOST_TEST_SUITE(test_name);
   ts->add(BOOST_TEST_CASE(&test_codegen_4DoFArm));
   ts->add(BOOST_TEST_CASE(&test_codegen_bipedal));
+  ts->add(BOOST_TEST_CASE(&test_codegen_shared_model_in_problem));
+  ts->add(BOOST_TEST_CASE(&test_autodiff_4DoFArm));
+#ifdef CROCODDYL_WITH_CODEGEN_LLVM
+  ts->add(BOOST_TEST_CASE(&test_codegen_jit_bipedal));
+#endif
   framework::master_test_suite().add(ts);
 
   return true;
@@ -12,6 +12,9 @@
 #define BOOST_TEST_ALTERNATIVE_INIT_API
 
 #include "crocoddyl/multibody/data/multibody.hpp"
+#include "crocoddyl/multibody/costs/state.hpp"
+#include "crocoddyl/multibody/costs/com-position.hpp"
+#include "crocoddyl/core/activations/quadratic-barrier.hpp"
 
 #include "factory/cost.hpp"
 #include "unittest_common.hpp"
@@ -216,6 +219,185 @@ void test_partial_derivatives_in_cost_sum(CostModelTypes::Type cost_type, StateM
   BOOST_CHECK((data->Luu - data_sum->Luu).isMuchSmallerThan(1.0));
 }
 
+void test_weights_in_cost_sum(CostModelTypes::Type cost_type, StateModelTypes::Type state_type,
+                              ActivationModelTypes::Type activation_type) {
+  // create the model
+  CostModelFactory factory;
+  const boost::shared_ptr<crocoddyl::CostModelAbstract>& model =
+      factory.create(cost_type, state_type, activation_type);
+
+  // create the corresponding data object
+  const boost::shared_ptr<crocoddyl::StateMultibody>& state =
+      boost::static_pointer_cast<crocoddyl::StateMultibody>(model->get_state());
+  pinocchio::Model& pinocchio_model = *state->get_pinocchio().get();
+  pinocchio::Data pinocchio_data(pinocchio_model);
+  crocoddyl::DataCollectorMultibody shared_data(&pinocchio_data);
+  const boost::shared_ptr<crocoddyl::CostDataAbstract>& data = model->createData(&shared_data);
+
+  // create the cost sum model and two nodes, where the second one overrides the cost weight
+  crocoddyl::CostModelSum cost_sum(state, model->get_nu());
+  cost_sum.addCost("myCost", model, 1.);
+  const boost::shared_ptr<crocoddyl::CostDataSum>& data_sum = cost_sum.createData(&shared_data);
+  const boost::shared_ptr<crocoddyl::CostDataSum>& data_node = cost_sum.createData(&shared_data);
+  cost_sum.changeCostWeight(data_node, "myCost", 3.);
+  BOOST_CHECK(cost_sum.getCostWeight(data_sum, "myCost") == 1.);
+  BOOST_CHECK(cost_sum.getCostWeight(data_node, "myCost") == 3.);
+
+  // Generating random values for the state and control
+  const Eigen::VectorXd& x = state->rand();
+  const Eigen::VectorXd& u = Eigen::VectorXd::Random(model->get_nu());
+
+  // Compute all the pinocchio function needed for the models.
+  crocoddyl::unittest::updateAllPinocchio(&pinocchio_model, &pinocchio_data, x);
+
+  // Computing the cost derivatives
+  model->calc(data, x, u);
+  model->calcDiff(data, x, u);
+  cost_sum.calc(data_sum, x, u);
+  cost_sum.calcDiff(data_sum, x, u);
+  cost_sum.calc(data_node, x, u);
+  cost_sum.calcDiff(data_node, x, u);
+
+  BOOST_CHECK_CLOSE(data_sum->cost, data->cost, 1e-9);
+  BOOST_CHECK_CLOSE(data_node->cost, 3. * data->cost, 1e-9);
+  BOOST_CHECK((3. * data->Lx - data_node->Lx).isMuchSmallerThan(1.0));
+  BOOST_CHECK((3. * data->Lxx - data_node->Lxx).isMuchSmallerThan(1.0));
+  BOOST_CHECK((3. * data->Luu - data_node->Luu).isMuchSmallerThan(1.0));
+}
+
+void test_clone(CostModelTypes::Type cost_type, StateModelTypes::Type state_type,
+                ActivationModelTypes::Type activation_type) {
+  // create the model and its clone
+  CostModelFactory factory;
+  const boost::shared_ptr<crocoddyl::CostModelAbstract>& model =
+      factory.create(cost_type, state_type, activation_type);
+  const boost::shared_ptr<crocoddyl::CostModelAbstract>& clone = model->clone();
+  BOOST_CHECK(clone->get_state() == model->get_state());
+  BOOST_CHECK(clone->get_activation() != model->get_activation());
+
+  // create the corresponding data objects
+  const boost::shared_ptr<crocoddyl::StateMultibody>& state =
+      boost::static_pointer_cast<crocoddyl::StateMultibody>(model->get_state());
+  pinocchio::Model& pinocchio_model = *state->get_pinocchio().get();
+  pinocchio::Data pinocchio_data(pinocchio_model);
+  crocoddyl::DataCollectorMultibody shared_data(&pinocchio_data);
+  const boost::shared_ptr<crocoddyl::CostDataAbstract>& data = model->createData(&shared_data);
+  const boost::shared_ptr<crocoddyl::CostDataAbstract>& clone_data = clone->createData(&shared_data);
+
+  // Generating random values for the state and control
+  const Eigen::VectorXd& x = state->rand();
+  const Eigen::VectorXd& u = Eigen::VectorXd::Random(model->get_nu());
+
+  // Compute all the pinocchio function needed for the models.
+  crocoddyl::unittest::updateAllPinocchio(&pinocchio_model, &pinocchio_data, x);
+
+  // Checking that both costs compute the same values
+  model->calc(data, x, u);
+  model->calcDiff(data, x, u);
+  clone->calc(clone_data, x, u);
+  clone->calcDiff(clone_data, x, u);
+  BOOST_CHECK(data->cost == clone_data->cost);
+  BOOST_CHECK((data->Lx - clone_data->Lx).isZero());
+  BOOST_CHECK((data->Lu - clone_data->Lu).isZero());
+  BOOST_CHECK((data->Lxx - clone_data->Lxx).isZero());
+}
+
+void test_node_references_in_cost_sum(StateModelTypes::Type state_type) {
+  // create the state and two nodes references
+  StateModelFactory state_factory;
+  const boost::shared_ptr<crocoddyl::StateMultibody>& state =
+      boost::static_pointer_cast<crocoddyl::StateMultibody>(state_factory.create(state_type));
+  const std::size_t& nu = state->get_nv();
+  const Eigen::VectorXd& xref_a = state->rand();
+  const Eigen::VectorXd& xref_b = state->rand();
+  const Eigen::Vector3d& cref_a = Eigen::Vector3d::Random();
+  const Eigen::Vector3d& cref_b = Eigen::Vector3d::Random();
+
+  // create a cost sum shared by both nodes and a cost sum with the references of the second node
+  crocoddyl::CostModelSum cost_sum(state, nu);
+  cost_sum.addCost("xReg", boost::make_shared<crocoddyl::CostModelState>(state, xref_a, nu), 1.);
+  cost_sum.addCost("comTrack", boost::make_shared<crocoddyl::CostModelCoMPosition>(state, cref_a, nu), 10.);
+  crocoddyl::CostModelSum cost_sum_b(state, nu);
+  cost_sum_b.addCost("xReg", boost::make_shared<crocoddyl::CostModelState>(state, xref_b, nu), 1.);
+  cost_sum_b.addCost("comTrack", boost::make_shared<crocoddyl::CostModelCoMPosition>(state, cref_b, nu), 10.);
+
+  pinocchio::Model& pinocchio_model = *state->get_pinocchio().get();
+  pinocchio::Data pinocchio_data(pinocchio_model);
+  crocoddyl::DataCollectorMultibody shared_data(&pinocchio_data);
+  const boost::shared_ptr<crocoddyl::CostDataSum>& data_a = cost_sum.createData(&shared_data);
+  const boost::shared_ptr<crocoddyl::CostDataSum>& data_b = cost_sum.createData(&shared_data);
+  const boost::shared_ptr<crocoddyl::CostDataSum>& data_ref = cost_sum_b.createData(&shared_data);
+  cost_sum.changeCostReference(data_b, "xReg", xref_b);
+  cost_sum.changeCostReference(data_b, "comTrack", cref_b);
+  BOOST_CHECK(cost_sum.get_costs().find("xReg")->second->cost->get_nodeReference<Eigen::VectorXd>(
+                  data_a->costs.find("xReg")->second) == xref_a);
+  BOOST_CHECK(cost_sum.get_costs().find("xReg")->second->cost->get_nodeReference<Eigen::VectorXd>(
+                  data_b->costs.find("xReg")->second) == xref_b);
+
+  // Generating random values for the state and control
+  const Eigen::VectorXd& x = state->rand();
+  const Eigen::VectorXd& u = Eigen::VectorXd::Random(nu);
+
+  // Compute all the pinocchio function needed for the models.
+  crocoddyl::unittest::updateAllPinocchio(&pinocchio_model, &pinocchio_data, x);
+
+  // Computing the costs of both nodes
+  cost_sum.calc(data_a, x, u);
+  cost_sum.calcDiff(data_a, x, u);
+  cost_sum.calc(data_b, x, u);
+  cost_sum.calcDiff(data_b, x, u);
+  cost_sum_b.calc(data_ref, x, u);
+  cost_sum_b.calcDiff(data_ref, x, u);
+
+  BOOST_CHECK_CLOSE(data_b->cost, data_ref->cost, 1e-9);
+  BOOST_CHECK((data_b->Lx - data_ref->Lx).isMuchSmallerThan(1.0));
+  BOOST_CHECK((data_b->Lxx - data_ref->Lxx).isMuchSmallerThan(1.0));
+  BOOST_CHECK(std::abs(data_a->cost - data_ref->cost) > 0.);
+}
+
+void test_inactive_barrier_in_cost_sum(StateModelTypes::Type state_type) {
+  // create the state and a joint-limit cost whose bounds contain the sampled states
+  StateModelFactory state_factory;
+  const boost::shared_ptr<crocoddyl::StateMultibody>& state =
+      boost::static_pointer_cast<crocoddyl::StateMultibody>(state_factory.create(state_type));
+  const std::size_t& nu = state->get_nv();
+  const std::size_t& ndx = state->get_ndx();
+  const Eigen::VectorXd bound = Eigen::VectorXd::Constant(ndx, 1e3);
+  boost::shared_ptr<crocoddyl::ActivationModelQuadraticBarrier> activation =
+      boost::make_shared<crocoddyl::ActivationModelQuadraticBarrier>(crocoddyl::ActivationBounds(-bound, bound));
+  boost::shared_ptr<crocoddyl::CostModelAbstract> limit =
+      boost::make_shared<crocoddyl::CostModelState>(state, activation, state->zero(), nu);
+  crocoddyl::CostModelSum cost_sum(state, nu);
+  cost_sum.addCost("xLimit", limit, 1.);
+  cost_sum.addCost("xReg", boost::make_shared<crocoddyl::CostModelState>(state, nu), 1.);
+
+  pinocchio::Model& pinocchio_model = *state->get_pinocchio().get();
+  pinocchio::Data pinocchio_data(pinocchio_model);
+  crocoddyl::DataCollectorMultibody shared_data(&pinocchio_data);
+  const boost::shared_ptr<crocoddyl::CostDataSum>& data = cost_sum.createData(&shared_data);
+  const boost::shared_ptr<crocoddyl::CostDataAbstract>& limit_data = limit->createData(&shared_data);
+
+  // Generating random values for the state and control
+  const Eigen::VectorXd& x = state->rand();
+  const Eigen::VectorXd& u = Eigen::VectorXd::Random(nu);
+  crocoddyl::unittest::updateAllPinocchio(&pinocchio_model, &pinocchio_data, x);
+
+  // Checking that the inactive barrier is skipped and that its derivatives are indeed zero
+  cost_sum.calc(data, x, u);
+  cost_sum.calcDiff(data, x, u);
+  BOOST_CHECK(data->nskip == 1);
+  limit->calc(limit_data, x, u);
+  limit->calcDiff(limit_data, x, u);
+  BOOST_CHECK(limit_data->Lx.isZero());
+  BOOST_CHECK(limit_data->Lxx.isZero());
+
+  // Checking that an active barrier is not skipped
+  activation->set_bounds(crocoddyl::ActivationBounds(Eigen::VectorXd::Zero(ndx), Eigen::VectorXd::Zero(ndx)));
+  cost_sum.calc(data, x, u);
+  cost_sum.calcDiff(data, x, u);
+  BOOST_CHECK(data->nskip == 1);
+}
+
 //----------------------------------------------------------------------------//
 
 void register_cost_model_unit_tests(CostModelTypes::Type cost_type, StateModelTypes::Type state_type,
@@ -230,6 +412,8 @@ void register_cost_model_unit_tests(CostModelTypes::Type cost_type, StateModelTy
       BOOST_TEST_CASE(boost::bind(&test_partial_derivatives_against_numdiff, cost_type, state_type, activation_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_dimensions_in_cost_sum, cost_type, state_type, activation_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_partial_derivatives_in_cost_sum, cost_type, state_type, activation_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_weights_in_cost_sum, cost_type, state_type, activation_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_clone, cost_type, state_type, activation_type)));
   framework::master_test_suite().add(ts);
 }
 
@@ -244,6 +428,10 @@ bool init_function() {
       }
     }
   }
+  framework::master_test_suite().add(BOOST_TEST_CASE(
+      boost::bind(&test_node_references_in_cost_sum, StateModelTypes::StateMultibody_TalosArm)));
+  framework::master_test_suite().add(BOOST_TEST_CASE(
+      boost::bind(&test_inactive_barrier_in_cost_sum, StateModelTypes::StateMultibody_TalosArm)));
   return true;
 }
 
@@ -139,6 +139,38 @@ void test_partial_derivatives_against_numdiff(DifferentialActionModelTypes::Type
   }
 }
 
+void test_clone(DifferentialActionModelTypes::Type action_type) {
+  // create the model and its clone
+  DifferentialActionModelFactory factory;
+  const boost::shared_ptr<crocoddyl::DifferentialActionModelAbstract>& model = factory.create(action_type);
+  const boost::shared_ptr<crocoddyl::DifferentialActionModelAbstract>& clone = model->clone();
+  BOOST_CHECK(clone != model);
+  BOOST_CHECK(clone->get_state() == model->get_state());
+
+  // create the corresponding data objects
+  const boost::shared_ptr<crocoddyl::DifferentialActionDataAbstract>& data = model->createData();
+  const boost::shared_ptr<crocoddyl::DifferentialActionDataAbstract>& clone_data = clone->createData();
+  BOOST_CHECK(clone->checkData(clone_data));
+
+  // Generating random values for the state and control
+  const Eigen::VectorXd& x = model->get_state()->rand();
+  const Eigen::VectorXd& u = Eigen::VectorXd::Random(model->get_nu());
+
+  // Checking that both models compute the same values
+  model->calc(data, x, u);
+  model->calcDiff(data, x, u);
+  clone->calc(clone_data, x, u);
+  clone->calcDiff(clone_data, x, u);
+  BOOST_CHECK(data->cost == clone_data->cost);
+  BOOST_CHECK((data->xout - clone_data->xout).isZero());
+  BOOST_CHECK((data->Fx - clone_data->Fx).isZero());
+  BOOST_CHECK((data->Fu - clone_data->Fu).isZero());
+  BOOST_CHECK((data->Lx - clone_data->Lx).isZero());
+  BOOST_CHECK((data->Lu - clone_data->Lu).isZero());
+  BOOST_CHECK((data->Lxx - clone_data->Lxx).isZero());
+  BOOST_CHECK((data->Luu - clone_data->Luu).isZero());
+}
+
 //----------------------------------------------------------------------------//
 
 void register_action_model_unit_tests(DifferentialActionModelTypes::Type action_type) {
@@ -150,6 +182,7 @@ void register_action_model_unit_tests(DifferentialActionModelTypes::Type action_
   ts->add(BOOST_TEST_CASE(boost::bind(&test_calc_returns_state, action_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_calc_returns_a_cost, action_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_partial_derivatives_against_numdiff, action_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_clone, action_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_quasi_static, action_type)));
   framework::master_test_suite().add(ts);
 }
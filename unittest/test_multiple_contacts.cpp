@@ -518,6 +518,50 @@ void test_assert_updateForceDiff_assert_mismatch_model_data() {
   BOOST_CHECK(error_message.find(assert_argument) != std::string::npos);
 }
 
+void test_multiplyAccelerationDiff() {
+  // Setup the test
+  StateModelFactory state_factory;
+  crocoddyl::ContactModelMultiple model(boost::static_pointer_cast<crocoddyl::StateMultibody>(
+      state_factory.create(StateModelTypes::StateMultibody_RandomHumanoid)));
+  // create the corresponding data object
+  pinocchio::Model& pinocchio_model = *model.get_state()->get_pinocchio().get();
+  pinocchio::Data pinocchio_data(*model.get_state()->get_pinocchio().get());
+
+  // create and add some contact objects
+  for (std::size_t i = 0; i < 5; ++i) {
+    std::ostringstream os;
+    os << "random_contact_" << i;
+    model.addContact(os.str(), create_random_contact());
+  }
+  model.changeContactStatus("random_contact_2", false);
+
+  // create the data of the multiple-contacts
+  boost::shared_ptr<crocoddyl::ContactDataMultiple> data = model.createData(&pinocchio_data);
+
+  // compute the multiple contact data
+  Eigen::VectorXd x = model.get_state()->rand();
+  crocoddyl::unittest::updateAllPinocchio(&pinocchio_model, &pinocchio_data, x);
+  model.calc(data, x);
+  model.calcDiff(data, x);
+
+  // check the block-sparse product against the dense one
+  const std::size_t& nc = model.get_nc();
+  const std::size_t& nv = model.get_state()->get_nv();
+  const std::size_t& ndx = model.get_state()->get_ndx();
+  const Eigen::MatrixXd A = Eigen::MatrixXd::Random(nv, nc);
+  const Eigen::MatrixXd dense = A * data->da0_dx.topRows(nc);
+  const Eigen::MatrixXd out0 = Eigen::MatrixXd::Random(nv, ndx);
+  Eigen::MatrixXd out = out0;
+  model.multiplyAccelerationDiff(data, A, out);
+  BOOST_CHECK((out - dense).isMuchSmallerThan(1.0, 1e-9));
+  out = out0;
+  model.multiplyAccelerationDiff(data, A, out, crocoddyl::addto);
+  BOOST_CHECK((out - out0 - dense).isMuchSmallerThan(1.0, 1e-9));
+  out = out0;
+  model.multiplyAccelerationDiff(data, A, out, crocoddyl::rmfrom);
+  BOOST_CHECK((out - out0 + dense).isMuchSmallerThan(1.0, 1e-9));
+}
+
 void test_get_contacts() {
   // Setup the test
   StateModelFactory state_factory;
@@ -585,6 +629,7 @@ void register_unit_tests() {
   framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_calc_diff_no_recalc)));
   framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_updateForce)));
   framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_updateAccelerationDiff)));
+  framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_multiplyAccelerationDiff)));
   framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_get_contacts)));
   framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_get_nc)));
 }
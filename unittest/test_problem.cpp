@@ -10,7 +10,16 @@
 #define BOOST_TEST_ALTERNATIVE_INIT_API
 
 #include "crocoddyl/core/optctrl/shooting.hpp"
+#include "crocoddyl/core/optctrl/horizon.hpp"
 #include "crocoddyl/core/integrator/euler.hpp"
+#include "crocoddyl/core/integrator/rk4.hpp"
+#include "crocoddyl/core/integrator/multi-rate.hpp"
+#include "crocoddyl/core/actions/lqr.hpp"
+#include "crocoddyl/core/solvers/ddp.hpp"
+#include "crocoddyl/core/solvers/fddp.hpp"
+#include "crocoddyl/multibody/actions/centroidal-transition.hpp"
+#include "crocoddyl/multibody/actuations/full.hpp"
+#include "crocoddyl/multibody/costs/state.hpp"
 #include "factory/action.hpp"
 #include "factory/diff_action.hpp"
 #include "unittest_common.hpp"
@@ -268,6 +277,43 @@ void test_quasiStatic(ActionModelTypes::Type action_model_type) {
   }
 }
 
+void test_quasiStatic_reuse(ActionModelTypes::Type action_model_type) {
+  // create the model
+  ActionModelFactory factory;
+  const boost::shared_ptr<crocoddyl::ActionModelAbstract>& model = factory.create(action_model_type);
+
+  // create the shooting problem
+  std::size_t T = 20;
+  const Eigen::VectorXd& x0 = model->get_state()->rand();
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > models(T, model);
+  crocoddyl::ShootingProblem problem(x0, models, model);
+
+  // create random trajectory, where consecutive nodes share the same state
+  std::vector<Eigen::VectorXd> xs(T);
+  std::vector<Eigen::VectorXd> us(T);
+  for (std::size_t i = 0; i < T; ++i) {
+    if (i % 2 == 0) {
+      xs[i] = model->get_state()->rand();
+      xs[i].tail(model->get_state()->get_nv()) *= 0;
+    } else {
+      xs[i] = xs[i - 1];
+    }
+    us[i] = Eigen::VectorXd::Zero(model->get_nu());
+  }
+
+  // the nodes that reuse the command of their previous node get the command of an independent solve
+  problem.quasiStatic(us, xs);
+  for (std::size_t i = 0; i < T; ++i) {
+    const boost::shared_ptr<crocoddyl::ActionDataAbstract>& data = model->createData();
+    Eigen::VectorXd u = Eigen::VectorXd::Zero(model->get_nu());
+    model->quasiStatic(data, u, xs[i]);
+    BOOST_CHECK((u - us[i]).isMuchSmallerThan(1.0, 1e-7));
+    if (i % 2 == 1) {
+      BOOST_CHECK(us[i] == us[i - 1]);
+    }
+  }
+}
+
 void test_quasiStatic_diffAction(DifferentialActionModelTypes::Type action_model_type) {
   // create the model
   DifferentialActionModelFactory factory;
@@ -300,8 +346,423 @@ void test_quasiStatic_diffAction(DifferentialActionModelTypes::Type action_model
   }
 }
 
+void test_compress_horizon_diffAction(DifferentialActionModelTypes::Type action_model_type) {
+  // create the model
+  DifferentialActionModelFactory factory;
+  const boost::shared_ptr<crocoddyl::DifferentialActionModelAbstract>& diffModel = factory.create(action_model_type);
+  const double dt = 1e-2;
+  const boost::shared_ptr<crocoddyl::ActionModelAbstract>& model =
+      boost::make_shared<crocoddyl::IntegratedActionModelEuler>(diffModel, dt);
+
+  // create the shooting problem and check its time grid
+  std::size_t T = 20;
+  const Eigen::VectorXd& x0 = model->get_state()->rand();
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > models(T, model);
+  crocoddyl::ShootingProblem problem(x0, models, model);
+  const Eigen::VectorXd& time_grid = problem.get_timeGrid();
+  BOOST_CHECK(static_cast<std::size_t>(time_grid.size()) == T + 1);
+  for (std::size_t i = 0; i <= T; ++i) {
+    BOOST_CHECK_CLOSE(time_grid[i] + 1., static_cast<double>(i) * dt + 1., 1e-9);
+  }
+
+  // create a feasible trajectory
+  std::vector<Eigen::VectorXd> xs(T + 1, x0);
+  std::vector<Eigen::VectorXd> us(T);
+  for (std::size_t i = 0; i < T; ++i) {
+    us[i] = Eigen::VectorXd::Random(model->get_nu());
+  }
+  problem.rollout(us, xs);
+
+  // compress the horizon onto a geometric grid
+  std::size_t N = 10;
+  const Eigen::VectorXd& dts = crocoddyl::computeGeometricTimeSteps(dt, 1.2, N);
+  std::vector<Eigen::VectorXd> xs_out, us_out;
+  boost::shared_ptr<crocoddyl::ShootingProblem> compressed =
+      crocoddyl::compressHorizon(problem, dts, xs, us, xs_out, us_out);
+  BOOST_CHECK(compressed->get_T() == N);
+  BOOST_CHECK(xs_out.size() == N + 1);
+  BOOST_CHECK(us_out.size() == N);
+  const Eigen::VectorXd& new_time_grid = compressed->get_timeGrid();
+  double tau = 0.;
+  for (std::size_t j = 0; j < N; ++j) {
+    BOOST_CHECK_CLOSE(new_time_grid[j] + 1., tau + 1., 1e-9);
+    tau += dts[j];
+    BOOST_CHECK(compressed->get_runningModels()[j]->get_nu() == model->get_nu());
+  }
+  BOOST_CHECK_CLOSE(new_time_grid[N] + 1., tau + 1., 1e-9);
+
+  // check the interpolated warm start on the nodes shared by both grids
+  BOOST_CHECK((xs_out[0] - xs[0]).isMuchSmallerThan(1.0, 1e-9));
+  BOOST_CHECK((xs_out[1] - xs[1]).isMuchSmallerThan(1.0, 1e-9));
+  BOOST_CHECK((us_out[0] - us[0]).isMuchSmallerThan(1.0, 1e-9));
+  BOOST_CHECK((xs_out[N] - xs[T]).isMuchSmallerThan(1.0, 1e-9));
+}
+
+void test_set_dt_diffAction(DifferentialActionModelTypes::Type action_model_type) {
+  // create the model
+  DifferentialActionModelFactory factory;
+  const boost::shared_ptr<crocoddyl::DifferentialActionModelAbstract>& diffModel = factory.create(action_model_type);
+  const Eigen::VectorXd& x = diffModel->get_state()->rand();
+  const Eigen::VectorXd& u = Eigen::VectorXd::Random(diffModel->get_nu());
+
+  // a time step modified to (or from) zero behaves as the one used to construct the model, i.e. it disables (or
+  // enables) the integration
+  std::vector<double> dts(2);
+  dts[0] = 0.;
+  dts[1] = 1e-2;
+  for (std::size_t i = 0; i < dts.size(); ++i) {
+    const double& dt = dts[i];
+    const double& dt0 = dts[1 - i];
+    std::vector<boost::shared_ptr<crocoddyl::IntegratedActionModelAbstract> > models, modified_models;
+    models.push_back(boost::make_shared<crocoddyl::IntegratedActionModelEuler>(diffModel, dt));
+    modified_models.push_back(boost::make_shared<crocoddyl::IntegratedActionModelEuler>(diffModel, dt0));
+    models.push_back(boost::make_shared<crocoddyl::IntegratedActionModelRK4>(diffModel, dt));
+    modified_models.push_back(boost::make_shared<crocoddyl::IntegratedActionModelRK4>(diffModel, dt0));
+    models.push_back(boost::make_shared<crocoddyl::IntegratedActionModelMultiRate>(diffModel, dt, 2));
+    modified_models.push_back(boost::make_shared<crocoddyl::IntegratedActionModelMultiRate>(diffModel, dt0, 2));
+    for (std::size_t j = 0; j < models.size(); ++j) {
+      modified_models[j]->set_dt(dt);
+      const boost::shared_ptr<crocoddyl::ActionDataAbstract>& data = models[j]->createData();
+      const boost::shared_ptr<crocoddyl::ActionDataAbstract>& modified_data = modified_models[j]->createData();
+      models[j]->calc(data, x, u);
+      modified_models[j]->calc(modified_data, x, u);
+      BOOST_CHECK((data->xnext - modified_data->xnext).isMuchSmallerThan(1.0, 1e-9));
+      BOOST_CHECK_CLOSE(data->cost + 1., modified_data->cost + 1., 1e-9);
+      models[j]->calcDiff(data, x, u);
+      modified_models[j]->calcDiff(modified_data, x, u);
+      BOOST_CHECK((data->Fx - modified_data->Fx).isMuchSmallerThan(1.0, 1e-9));
+      BOOST_CHECK((data->Fu - modified_data->Fu).isMuchSmallerThan(1.0, 1e-9));
+      BOOST_CHECK((data->Lx - modified_data->Lx).isMuchSmallerThan(1.0, 1e-9));
+      BOOST_CHECK((data->Lu - modified_data->Lu).isMuchSmallerThan(1.0, 1e-9));
+    }
+  }
+}
+
+void test_clone(ActionModelTypes::Type action_model_type) {
+  // create the model
+  ActionModelFactory factory;
+  const boost::shared_ptr<crocoddyl::ActionModelAbstract>& model = factory.create(action_model_type);
+
+  // create the shooting problem and its clone
+  std::size_t T = 20;
+  const Eigen::VectorXd& x0 = model->get_state()->rand();
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > models(T, model);
+  crocoddyl::ShootingProblem problem(x0, models, model);
+  const boost::shared_ptr<crocoddyl::ShootingProblem>& clone = problem.clone();
+
+  // check that the clone owns its models and data, and that it keeps the sharing between nodes
+  BOOST_CHECK(clone->get_T() == T);
+  BOOST_CHECK(clone->get_x0() == x0);
+  for (std::size_t i = 0; i < T; ++i) {
+    BOOST_CHECK(clone->get_runningModels()[i] != model);
+    BOOST_CHECK(clone->get_runningModels()[i] == clone->get_runningModels()[0]);
+    BOOST_CHECK(clone->get_runningDatas()[i] != problem.get_runningDatas()[i]);
+  }
+  BOOST_CHECK(clone->get_terminalModel() == clone->get_runningModels()[0]);
+
+  // create random trajectory
+  std::vector<Eigen::VectorXd> xs(T + 1);
+  std::vector<Eigen::VectorXd> us(T);
+  for (std::size_t i = 0; i < T; ++i) {
+    xs[i] = model->get_state()->rand();
+    us[i] = Eigen::VectorXd::Random(model->get_nu());
+  }
+  xs.back() = model->get_state()->rand();
+
+  // check that both problems compute the same values
+  BOOST_CHECK(problem.calc(xs, us) == clone->calc(xs, us));
+  problem.calcDiff(xs, us);
+  clone->calcDiff(xs, us);
+  for (std::size_t i = 0; i < T; ++i) {
+    BOOST_CHECK((problem.get_runningDatas()[i]->Fx - clone->get_runningDatas()[i]->Fx).isZero());
+    BOOST_CHECK((problem.get_runningDatas()[i]->Lx - clone->get_runningDatas()[i]->Lx).isZero());
+  }
+}
+
+void test_heterogeneous_nodes() {
+  // create a whole-body phase followed by a centroidal phase
+  DifferentialActionModelFactory factory;
+  const boost::shared_ptr<crocoddyl::DifferentialActionModelContactFwdDynamics>& wholeDiffModel =
+      factory.create_contactFwdDynamics(StateModelTypes::StateMultibody_HyQ,
+                                        ActuationModelTypes::ActuationModelFloatingBase);
+  const boost::shared_ptr<crocoddyl::DifferentialActionModelCentroidalFwdDynamics>& centroidalDiffModel =
+      factory.create_centroidalFwdDynamics();
+  const boost::shared_ptr<crocoddyl::ActionModelAbstract>& wholeModel =
+      boost::make_shared<crocoddyl::IntegratedActionModelEuler>(wholeDiffModel, 1e-2);
+  const boost::shared_ptr<crocoddyl::ActionModelAbstract>& centroidalModel =
+      boost::make_shared<crocoddyl::IntegratedActionModelEuler>(centroidalDiffModel, 1e-2);
+  const boost::shared_ptr<crocoddyl::ActionModelCentroidalTransition>& transitionModel =
+      boost::make_shared<crocoddyl::ActionModelCentroidalTransition>(
+          boost::static_pointer_cast<crocoddyl::StateMultibody>(wholeModel->get_state()),
+          centroidalDiffModel->get_inertia());
+
+  // create the shooting problem
+  std::size_t T = 10;
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > models(T / 2, wholeModel);
+  models.push_back(transitionModel);
+  models.resize(T, centroidalModel);
+  const Eigen::VectorXd& x0 = wholeModel->get_state()->zero();
+  crocoddyl::ShootingProblem problem(x0, models, centroidalModel);
+
+  // the problem cannot be built when the next state of a node doesn't match the following node
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > wrong_models(T, wholeModel);
+  BOOST_CHECK_THROW(crocoddyl::ShootingProblem(x0, wrong_models, centroidalModel), std::exception);
+  BOOST_CHECK_THROW(problem.updateModel(T / 2, wholeModel), std::exception);
+
+  // check the rollout and derivatives along the nodes
+  std::vector<Eigen::VectorXd> us(T);
+  for (std::size_t i = 0; i < T; ++i) {
+    us[i] = Eigen::VectorXd::Zero(models[i]->get_nu());
+  }
+  const std::vector<Eigen::VectorXd>& xs = problem.rollout_us(us);
+  problem.calc(xs, us);
+  problem.calcDiff(xs, us);
+  for (std::size_t i = 0; i < T; ++i) {
+    const boost::shared_ptr<crocoddyl::ActionModelAbstract>& next =
+        i + 1 < T ? models[i + 1] : problem.get_terminalModel();
+    BOOST_CHECK(static_cast<std::size_t>(xs[i].size()) == models[i]->get_state()->get_nx());
+    BOOST_CHECK(static_cast<std::size_t>(problem.get_runningDatas()[i]->Fx.rows()) ==
+                next->get_state()->get_ndx());
+    BOOST_CHECK(static_cast<std::size_t>(problem.get_runningDatas()[i]->Fx.cols()) ==
+                models[i]->get_state()->get_ndx());
+  }
+
+  // check the transition Jacobian with finite differences
+  const boost::shared_ptr<crocoddyl::StateAbstract>& state = transitionModel->get_state();
+  const boost::shared_ptr<crocoddyl::ActionDataAbstract>& data = transitionModel->createData();
+  const boost::shared_ptr<crocoddyl::ActionDataAbstract>& data_dx = transitionModel->createData();
+  const Eigen::VectorXd& x = state->rand();
+  Eigen::VectorXd xp(state->get_nx());
+  Eigen::VectorXd dx = Eigen::VectorXd::Zero(state->get_ndx());
+  Eigen::MatrixXd Fx(12, state->get_ndx());
+  const double h = 1e-7;
+  transitionModel->calc(data, x);
+  transitionModel->calcDiff(data, x);
+  for (std::size_t i = 0; i < state->get_ndx(); ++i) {
+    dx(i) = h;
+    state->integrate(x, dx, xp);
+    transitionModel->calc(data_dx, xp);
+    Fx.col(i) = (data_dx->xnext - data->xnext) / h;
+    dx(i) = 0.;
+  }
+  BOOST_CHECK((data->Fx - Fx).isMuchSmallerThan(1.0, 1e-4));
+
+  // solve the problem with per-node buffers
+  crocoddyl::SolverDDP solver(boost::make_shared<crocoddyl::ShootingProblem>(problem));
+  solver.solve(xs, us, 2);
+  for (std::size_t i = 0; i < T; ++i) {
+    BOOST_CHECK(static_cast<std::size_t>(solver.get_Vxx()[i].rows()) == models[i]->get_state()->get_ndx());
+    BOOST_CHECK(static_cast<std::size_t>(solver.get_K()[i].cols()) == models[i]->get_state()->get_ndx());
+  }
+
+  // a circular append moves the phase boundary, so the solver reallocates the buffers of the moved nodes
+  solver.get_problem()->circularAppend(centroidalModel);
+  const std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> >& appended_models =
+      solver.get_problem()->get_runningModels();
+  solver.solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 2);
+  for (std::size_t i = 0; i < T; ++i) {
+    const std::size_t& ndx = appended_models[i]->get_state()->get_ndx();
+    BOOST_CHECK(static_cast<std::size_t>(solver.get_Vxx()[i].rows()) == ndx);
+    BOOST_CHECK(static_cast<std::size_t>(solver.get_Qxu()[i].rows()) == ndx);
+    BOOST_CHECK(static_cast<std::size_t>(solver.get_K()[i].cols()) == ndx);
+    BOOST_CHECK(static_cast<std::size_t>(solver.get_xs()[i].size()) == appended_models[i]->get_state()->get_nx());
+  }
+}
+
+void test_node_parameters() {
+  // create a problem whose nodes share one action model
+  StateModelFactory state_factory;
+  const boost::shared_ptr<crocoddyl::StateMultibody>& state = boost::static_pointer_cast<crocoddyl::StateMultibody>(
+      state_factory.create(StateModelTypes::StateMultibody_TalosArm));
+  const boost::shared_ptr<crocoddyl::ActuationModelFull>& actuation =
+      boost::make_shared<crocoddyl::ActuationModelFull>(state);
+  const boost::shared_ptr<crocoddyl::CostModelSum>& costs =
+      boost::make_shared<crocoddyl::CostModelSum>(state, actuation->get_nu());
+  costs->addCost("xReg", boost::make_shared<crocoddyl::CostModelState>(state, actuation->get_nu()), 1.);
+  const boost::shared_ptr<crocoddyl::ActionModelAbstract>& model =
+      boost::make_shared<crocoddyl::IntegratedActionModelEuler>(
+          boost::make_shared<crocoddyl::DifferentialActionModelFreeFwdDynamics>(state, actuation, costs), 1e-2);
+  const std::size_t T = 10;
+  const std::size_t node = 3;
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > models(T, model);
+  const boost::shared_ptr<crocoddyl::ShootingProblem>& problem =
+      boost::make_shared<crocoddyl::ShootingProblem>(state->zero(), models, model);
+
+  // set the reference and weight of a single node
+  const Eigen::VectorXd xref = state->rand();
+  boost::shared_ptr<crocoddyl::CostDataSum> costs_data =
+      boost::static_pointer_cast<crocoddyl::DifferentialActionDataFreeFwdDynamics>(
+          boost::static_pointer_cast<crocoddyl::IntegratedActionDataEuler>(problem->get_runningDatas()[node])
+              ->differential)
+          ->costs;
+  costs->changeCostReference(costs_data, "xReg", xref);
+  costs->changeCostWeight(costs_data, "xReg", 10.);
+
+  // the clone keeps the node parameters
+  const boost::shared_ptr<crocoddyl::ShootingProblem>& clone = problem->clone();
+  const boost::shared_ptr<crocoddyl::CostModelSum>& clone_costs =
+      boost::static_pointer_cast<crocoddyl::DifferentialActionModelFreeFwdDynamics>(
+          boost::static_pointer_cast<crocoddyl::IntegratedActionModelEuler>(clone->get_runningModels()[node])
+              ->get_differential())
+          ->get_costs();
+  const boost::shared_ptr<crocoddyl::CostDataSum>& clone_data =
+      boost::static_pointer_cast<crocoddyl::DifferentialActionDataFreeFwdDynamics>(
+          boost::static_pointer_cast<crocoddyl::IntegratedActionDataEuler>(clone->get_runningDatas()[node])
+              ->differential)
+          ->costs;
+  BOOST_CHECK(clone_costs->get_costs().find("xReg")->second->cost->get_nodeReference<Eigen::VectorXd>(
+                  clone_data->costs.find("xReg")->second) == xref);
+  BOOST_CHECK(clone_costs->getCostWeight(clone_data, "xReg") == 10.);
+
+  // the solver keeps the node parameters when it swaps its trial datas into the problem
+  crocoddyl::SolverDDP solver(problem);
+  solver.solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 3);
+  costs_data = boost::static_pointer_cast<crocoddyl::DifferentialActionDataFreeFwdDynamics>(
+                   boost::static_pointer_cast<crocoddyl::IntegratedActionDataEuler>(problem->get_runningDatas()[node])
+                       ->differential)
+                   ->costs;
+  BOOST_CHECK(costs->get_costs().find("xReg")->second->cost->get_nodeReference<Eigen::VectorXd>(
+                  costs_data->costs.find("xReg")->second) == xref);
+  BOOST_CHECK(costs->getCostWeight(costs_data, "xReg") == 10.);
+
+  // a recycled data drops the node parameters of its previous node
+  const boost::shared_ptr<crocoddyl::ActionDataAbstract> data_node = problem->get_runningDatas()[node];
+  problem->clearDataPool();
+  for (std::size_t i = 0; i < node + 2; ++i) {
+    problem->circularAppend(model);
+  }
+  BOOST_CHECK(problem->get_runningDatas().back() == data_node);
+  BOOST_CHECK(costs->get_costs().find("xReg")->second->cost->get_nodeReference<Eigen::VectorXd>(
+                  costs_data->costs.find("xReg")->second) == state->zero());
+  BOOST_CHECK(costs->getCostWeight(costs_data, "xReg") == 1.);
+
+  // a node reference can also be cleared explicitly
+  costs->changeCostReference(costs_data, "xReg", xref);
+  costs->resetCostReference(costs_data, "xReg");
+  BOOST_CHECK(costs->get_costs().find("xReg")->second->cost->get_nodeReference<Eigen::VectorXd>(
+                  costs_data->costs.find("xReg")->second) == state->zero());
+}
+
+void test_data_pool() {
+  // create a problem with two phases
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> model_a = boost::make_shared<crocoddyl::ActionModelLQR>(4, 2);
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> model_b = boost::make_shared<crocoddyl::ActionModelLQR>(4, 2);
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > models(2, model_a);
+  models.resize(4, model_b);
+  crocoddyl::ShootingProblem problem(model_a->get_state()->zero(), models, model_a);
+
+  // the data of an evicted node is handed back when its model is appended again
+  const boost::shared_ptr<crocoddyl::ActionDataAbstract> data_head = problem.get_runningDatas()[0];
+  problem.circularAppend(model_a);
+  BOOST_CHECK(problem.get_runningDatas().back() != data_head);
+  problem.circularAppend(model_a);
+  BOOST_CHECK(problem.get_runningDatas().back() == data_head);
+  BOOST_CHECK(problem.acquireData(model_b) != problem.get_runningDatas()[0]);
+
+  // the same holds when updating a node
+  const boost::shared_ptr<crocoddyl::ActionDataAbstract> data_node = problem.get_runningDatas()[0];
+  problem.updateModel(0, model_a);
+  problem.updateModel(1, model_b);
+  BOOST_CHECK(problem.get_runningDatas()[1] == data_node);
+
+  // the datas of destroyed models are dropped from the pool
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> model_c = boost::make_shared<crocoddyl::ActionModelLQR>(4, 2);
+  problem.updateModel(2, model_c);
+  const boost::weak_ptr<crocoddyl::ActionDataAbstract> data_c = problem.get_runningDatas()[2];
+  problem.updateModel(2, model_a);
+  model_c.reset();
+  BOOST_CHECK(!data_c.expired());
+  problem.circularAppend(model_b);
+  BOOST_CHECK(data_c.expired());
+
+  // the recycled datas are consistent with their models
+  std::vector<Eigen::VectorXd> us(problem.get_T(), Eigen::VectorXd::Zero(2));
+  const std::vector<Eigen::VectorXd>& xs = problem.rollout_us(us);
+  problem.calc(xs, us);
+  for (std::size_t i = 0; i < problem.get_T(); ++i) {
+    BOOST_CHECK(problem.get_runningModels()[i]->checkData(problem.get_runningDatas()[i]));
+  }
+  problem.clearDataPool();
+
+  // the datas handed over by the user do not pile up in the pool, as the problem never used more than T + 1 datas of
+  // this model at once
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > models_a(4, model_a);
+  crocoddyl::ShootingProblem problem_a(model_a->get_state()->zero(), models_a, model_a);
+  std::vector<boost::weak_ptr<crocoddyl::ActionDataAbstract> > evicted;
+  for (std::size_t i = 0; i < 20; ++i) {
+    evicted.push_back(problem_a.get_runningDatas()[0]);
+    problem_a.circularAppend(model_a, model_a->createData());
+  }
+  std::size_t pooled = 0;
+  for (std::size_t i = 0; i < evicted.size(); ++i) {
+    if (!evicted[i].expired()) {
+      ++pooled;
+    }
+  }
+  BOOST_CHECK(pooled == 1);
+
+  // a rejected update of the running models keeps the datas of the pool
+  const boost::weak_ptr<crocoddyl::ActionDataAbstract> data_pooled = problem_a.get_runningDatas()[0];
+  problem_a.circularAppend(model_a);
+  BOOST_CHECK(!data_pooled.expired());
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > models_wrong(models_a);
+  models_wrong[1] = boost::make_shared<crocoddyl::ActionModelLQR>(4, 3);
+  BOOST_CHECK_THROW(problem_a.set_runningModels(models_wrong), crocoddyl::Exception);
+  BOOST_CHECK(!data_pooled.expired());
+  models_wrong[1] = boost::make_shared<crocoddyl::ActionModelLQR>(6, 2);
+  BOOST_CHECK_THROW(problem_a.set_runningModels(models_wrong), crocoddyl::Exception);
+  BOOST_CHECK(!data_pooled.expired());
+  BOOST_CHECK(problem_a.get_runningModels() == models_a);
+}
+
 //----------------------------------------------------------------------------//
 
+class ActionModelLQRCountingDatas : public crocoddyl::ActionModelLQR {
+ public:
+  ActionModelLQRCountingDatas(const std::size_t& nx, const std::size_t& nu, std::size_t& ndatas)
+      : crocoddyl::ActionModelLQR(nx, nu), ndatas_(ndatas) {}
+
+  virtual boost::shared_ptr<crocoddyl::ActionDataAbstract> createData() {
+    ++ndatas_;
+    return crocoddyl::ActionModelLQR::createData();
+  }
+
+ private:
+  std::size_t& ndatas_;
+};
+
+void test_data_pool_cyclic_phases(bool with_solver) {
+  // create a cyclic schedule of three phases, whose horizon is shorter than the cycle, so each phase leaves the
+  // horizon and comes back
+  const std::size_t nphases = 3, nknots = 10, T = 20;
+  std::size_t ndatas = 0;
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > phases;
+  for (std::size_t i = 0; i < nphases; ++i) {
+    phases.push_back(boost::make_shared<ActionModelLQRCountingDatas>(4, 2, ndatas));
+  }
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > models;
+  for (std::size_t t = 0; t < T; ++t) {
+    models.push_back(phases[t / nknots]);
+  }
+  boost::shared_ptr<crocoddyl::ShootingProblem> problem =
+      boost::make_shared<crocoddyl::ShootingProblem>(Eigen::VectorXd::Zero(4), models, phases[0]);
+  crocoddyl::SolverFDDP solver(problem);
+
+  // the problem (and the trial datas of the solver) stop allocating datas once each phase went through the horizon
+  std::size_t ndatas_warm = 0;
+  const std::size_t ncycles = 4;
+  for (std::size_t k = T; k < T + ncycles * nphases * nknots; ++k) {
+    if (k == T + 2 * nphases * nknots) {
+      ndatas_warm = ndatas;
+    }
+    problem->circularAppend(phases[(k / nknots) % nphases]);
+    if (with_solver) {
+      solver.solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 2);
+    }
+  }
+  BOOST_CHECK_EQUAL(ndatas, ndatas_warm);
+}
+
 void register_action_model_unit_tests(ActionModelTypes::Type action_model_type) {
   boost::test_tools::output_test_stream test_name;
   test_name << "test_" << action_model_type;
@@ -310,7 +771,9 @@ void register_action_model_unit_tests(ActionModelTypes::Type action_model_type)
   ts->add(BOOST_TEST_CASE(boost::bind(&test_calc, action_model_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_calcDiff, action_model_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_quasiStatic, action_model_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_quasiStatic_reuse, action_model_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_rollout, action_model_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_clone, action_model_type)));
   framework::master_test_suite().add(ts);
 }
 
@@ -323,6 +786,8 @@ void register_diff_action_model_unit_tests(DifferentialActionModelTypes::Type ac
   ts->add(BOOST_TEST_CASE(boost::bind(&test_calcDiff_diffAction, action_model_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_quasiStatic_diffAction, action_model_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_rollout_diffAction, action_model_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_compress_horizon_diffAction, action_model_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_set_dt_diffAction, action_model_type)));
   framework::master_test_suite().add(ts);
 }
 
@@ -333,6 +798,11 @@ bool init_function() {
   for (size_t i = 0; i < DifferentialActionModelTypes::all.size(); ++i) {
     register_diff_action_model_unit_tests(DifferentialActionModelTypes::all[i]);
   }
+  framework::master_test_suite().add(BOOST_TEST_CASE(&test_heterogeneous_nodes));
+  framework::master_test_suite().add(BOOST_TEST_CASE(&test_node_parameters));
+  framework::master_test_suite().add(BOOST_TEST_CASE(&test_data_pool));
+  framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_data_pool_cyclic_phases, false)));
+  framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(&test_data_pool_cyclic_phases, true)));
   return true;
 }
 
@@ -12,6 +12,17 @@
 #define BOOST_TEST_ALTERNATIVE_INIT_API
 
 #include "crocoddyl/core/utils/callbacks.hpp"
+#include "crocoddyl/core/utils/async.hpp"
+#include "crocoddyl/core/utils/portfolio.hpp"
+#include "crocoddyl/core/actions/lqr.hpp"
+#include "crocoddyl/core/actions/unicycle.hpp"
+#include "crocoddyl/core/solvers/ddp.hpp"
+#include "crocoddyl/core/solvers/fddp.hpp"
+#include "crocoddyl/core/solvers/box-ddp.hpp"
+#include "crocoddyl/core/solvers/box-fddp.hpp"
+#include "crocoddyl/core/integrator/euler.hpp"
+#include "crocoddyl/multibody/actions/centroidal-transition.hpp"
+#include "factory/diff_action.hpp"
 #include "factory/solver.hpp"
 #include "unittest_common.hpp"
 
@@ -134,6 +145,400 @@ void test_solver_against_kkt_solver(SolverTypes::Type solver_type, ActionModelTy
 
 //____________________________________________________________________________//
 
+class SolverDDPSequential : public crocoddyl::SolverDDP {
+ public:
+  explicit SolverDDPSequential(boost::shared_ptr<crocoddyl::ShootingProblem> problem)
+      : crocoddyl::SolverDDP(problem) {}
+
+  // Linearizes the whole problem before starting the backward pass, i.e. without pipelining them
+  virtual crocoddyl::PassStatus computeDirectionStep(const bool& recalcDiff) {
+    if (recalcDiff) {
+      calcDiff();
+    }
+    backwardPass();
+    return pass_status_;
+  }
+};
+
+void test_pipelined_backward_pass(ActionModelTypes::Type action_type, size_t T) {
+  // Create the solver, and a derived one that runs calcDiff() and backwardPass() in sequence
+  SolverFactory factory;
+  boost::shared_ptr<crocoddyl::SolverDDP> solver =
+      boost::static_pointer_cast<crocoddyl::SolverDDP>(factory.create(SolverTypes::SolverDDP, action_type, T));
+  const boost::shared_ptr<crocoddyl::ShootingProblem>& problem = solver->get_problem();
+  SolverDDPSequential solver_seq(problem);
+
+  // Generate the different state along the trajectory
+  const boost::shared_ptr<crocoddyl::StateAbstract>& state = problem->get_runningModels()[0]->get_state();
+  std::vector<Eigen::VectorXd> xs;
+  std::vector<Eigen::VectorXd> us;
+  for (std::size_t i = 0; i < T; ++i) {
+    const boost::shared_ptr<crocoddyl::ActionModelAbstract>& model = problem->get_runningModels()[i];
+    xs.push_back(state->rand());
+    us.push_back(Eigen::VectorXd::Random(model->get_nu()));
+  }
+  xs.push_back(state->rand());
+
+  // Compute the search direction with both solvers along the same guess
+  solver_seq.setCandidate(xs, us);
+  solver_seq.computeDirection();
+  const double cost_seq = problem->get_cost();
+  solver->setCandidate(xs, us);
+  solver->computeDirection();
+
+  // Both compute the same cost, derivatives and Value function, and they keep the cost of the problem updated
+  BOOST_CHECK_CLOSE(solver->get_cost(), solver_seq.get_cost(), 1e-9);
+  BOOST_CHECK_CLOSE(problem->get_cost(), cost_seq, 1e-9);
+  BOOST_CHECK_CLOSE(problem->get_cost(), solver->get_cost(), 1e-9);
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK((solver->get_Qxx()[t] - solver_seq.get_Qxx()[t]).isZero(1e-9));
+    BOOST_CHECK((solver->get_Qxu()[t] - solver_seq.get_Qxu()[t]).isZero(1e-9));
+    BOOST_CHECK((solver->get_Quu()[t] - solver_seq.get_Quu()[t]).isZero(1e-9));
+    BOOST_CHECK((solver->get_Qx()[t] - solver_seq.get_Qx()[t]).isZero(1e-9));
+    BOOST_CHECK((solver->get_Qu()[t] - solver_seq.get_Qu()[t]).isZero(1e-9));
+    BOOST_CHECK((solver->get_K()[t] - solver_seq.get_K()[t]).isZero(1e-9));
+    BOOST_CHECK((solver->get_k()[t] - solver_seq.get_k()[t]).isZero(1e-9));
+  }
+  for (std::size_t t = 0; t <= T; ++t) {
+    BOOST_CHECK((solver->get_Vxx()[t] - solver_seq.get_Vxx()[t]).isZero(1e-9));
+    BOOST_CHECK((solver->get_Vx()[t] - solver_seq.get_Vx()[t]).isZero(1e-9));
+    BOOST_CHECK((solver->get_fs()[t] - solver_seq.get_fs()[t]).isZero(1e-9));
+  }
+}
+
+//____________________________________________________________________________//
+
+template <typename Solver>
+class SolverCountingSteps : public Solver {
+ public:
+  explicit SolverCountingSteps(boost::shared_ptr<crocoddyl::ShootingProblem> problem)
+      : Solver(problem), n_directions(0), n_steps(0) {}
+
+  std::size_t n_directions;
+  std::size_t n_steps;
+
+ protected:
+  virtual crocoddyl::PassStatus computeDirectionStep(const bool& recalcDiff) {
+    ++n_directions;
+    return Solver::computeDirectionStep(recalcDiff);
+  }
+  virtual crocoddyl::PassStatus tryStepLength(const double& steplength) {
+    ++n_steps;
+    return Solver::tryStepLength(steplength);
+  }
+};
+
+template <typename Solver>
+void test_overridden_steps(size_t T) {
+  // Create a problem whose initial state is far from the origin
+  SolverFactory factory;
+  const boost::shared_ptr<crocoddyl::ShootingProblem>& problem =
+      factory.create(SolverTypes::SolverDDP, ActionModelTypes::ActionModelUnicycle, T)->get_problem();
+  problem->set_x0(Eigen::Vector3d(-1., -1., 1.));
+  Solver solver(problem);
+  SolverCountingSteps<Solver> solver_derived(problem);
+
+  // The derived solver iterates through its overridden steps, and it reaches the same solution
+  solver.solve();
+  solver_derived.solve();
+  BOOST_CHECK(solver_derived.n_directions >= solver_derived.get_iter());
+  BOOST_CHECK(solver_derived.n_steps >= solver_derived.get_iter());
+  BOOST_CHECK(solver.get_iter() == solver_derived.get_iter());
+  BOOST_CHECK_CLOSE(solver.get_cost(), solver_derived.get_cost(), 1e-9);
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK((solver.get_xs()[t] - solver_derived.get_xs()[t]).isZero(1e-9));
+    BOOST_CHECK((solver.get_us()[t] - solver_derived.get_us()[t]).isZero(1e-9));
+  }
+}
+
+//____________________________________________________________________________//
+
+template <typename Solver>
+void test_pass_status_on_indefinite_problem(size_t T) {
+  // Create an LQR problem whose control Hessian is indefinite
+  const std::size_t nx = 4, nu = 2;
+  boost::shared_ptr<crocoddyl::ActionModelLQR> model = boost::make_shared<crocoddyl::ActionModelLQR>(nx, nu);
+  model->set_Fu(1e-2 * Eigen::MatrixXd::Identity(nx, nu));
+  model->set_Lxu(Eigen::MatrixXd::Zero(nx, nu));
+  model->set_Luu(-1e-1 * Eigen::MatrixXd::Identity(nu, nu));
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > runningModels(T, model);
+  boost::shared_ptr<crocoddyl::ShootingProblem> problem =
+      boost::make_shared<crocoddyl::ShootingProblem>(Eigen::VectorXd::Zero(nx), runningModels, model);
+  Solver solver(problem);
+
+  // The backward pass reports the failure without raising an exception
+  solver.setCandidate();
+  solver.calcDiff();
+  solver.set_xreg(1e-9);
+  solver.set_ureg(1e-9);
+  BOOST_CHECK_NO_THROW(solver.backwardPass());
+  BOOST_CHECK_EQUAL(solver.get_pass_status(), crocoddyl::BackwardError);
+
+  // The public API still raises an exception
+  BOOST_CHECK_THROW(solver.computeDirection(false), crocoddyl::Exception);
+
+  // Large enough regularization recovers the backward pass
+  solver.set_ureg(1.);
+  solver.backwardPass();
+  BOOST_CHECK_EQUAL(solver.get_pass_status(), crocoddyl::PassSuccess);
+
+  // The solver handles the failures by increasing the regularization
+  BOOST_CHECK_NO_THROW(solver.solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 10));
+}
+
+//____________________________________________________________________________//
+
+template <typename Solver>
+void test_trial_datas_double_buffering(size_t T) {
+  // Create an LQR problem with a different action model per node
+  const std::size_t nx = 4, nu = 2;
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > runningModels;
+  for (std::size_t t = 0; t < T; ++t) {
+    runningModels.push_back(boost::make_shared<crocoddyl::ActionModelLQR>(nx, nu));
+  }
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> terminalModel =
+      boost::make_shared<crocoddyl::ActionModelLQR>(nx, nu);
+  boost::shared_ptr<crocoddyl::ShootingProblem> problem =
+      boost::make_shared<crocoddyl::ShootingProblem>(Eigen::VectorXd::Zero(nx), runningModels, terminalModel);
+  Solver solver(problem);
+  solver.setCandidate();
+  solver.calcDiff();
+  solver.backwardPass();
+
+  // A line-search trial does not overwrite the node datas of the problem
+  const std::vector<boost::shared_ptr<crocoddyl::ActionDataAbstract> > datas = problem->get_runningDatas();
+  const Eigen::VectorXd xnext = datas.back()->xnext;
+  const double cost = solver.get_cost();
+  const double dV = solver.tryStep(1.);
+  BOOST_CHECK(problem->get_runningDatas() == datas);
+  BOOST_CHECK((datas.back()->xnext - xnext).isZero(1e-9));
+
+  // Accepting the trial hands over its datas and trajectory to the problem
+  solver.acceptStep(true);
+  BOOST_CHECK(problem->get_runningDatas() != datas);
+  double cost_accepted = problem->get_terminalData()->cost;
+  for (std::size_t t = 0; t < T; ++t) {
+    cost_accepted += problem->get_runningDatas()[t]->cost;
+  }
+  BOOST_CHECK_CLOSE(cost_accepted, cost - dV, 1e-9);
+  BOOST_CHECK_CLOSE(problem->calc(solver.get_xs(), solver.get_us()), cost - dV, 1e-9);
+
+  // The trial datas follow the circular append of the problem
+  problem->circularAppend(boost::make_shared<crocoddyl::ActionModelLQR>(nx, nu));
+  BOOST_CHECK_NO_THROW(solver.solve());
+}
+
+template <typename Solver>
+void test_trial_controls_dimension(size_t T) {
+  // Create an LQR problem whose nodes have different control dimensions
+  const std::size_t nx = 4;
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > runningModels;
+  for (std::size_t t = 0; t < T; ++t) {
+    runningModels.push_back(boost::make_shared<crocoddyl::ActionModelLQR>(nx, t % 2 == 0 ? 2 : 3));
+  }
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> terminalModel =
+      boost::make_shared<crocoddyl::ActionModelLQR>(nx, 2);
+  boost::shared_ptr<crocoddyl::ShootingProblem> problem =
+      boost::make_shared<crocoddyl::ShootingProblem>(Eigen::VectorXd::Ones(nx), runningModels, terminalModel);
+  const std::size_t& nu_max = problem->get_nu_max();
+  Solver solver(problem);
+
+  // A warm start with the control dimension of each node is padded up to the maximum control dimension
+  std::vector<Eigen::VectorXd> us(T);
+  for (std::size_t t = 0; t < T; ++t) {
+    us[t] = Eigen::VectorXd::Zero(runningModels[t]->get_nu());
+  }
+  solver.solve(crocoddyl::DEFAULT_VECTOR, us);
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK(static_cast<std::size_t>(solver.get_us()[t].size()) == nu_max);
+  }
+
+  // The controls keep the maximum dimension when the control dimension of the nodes changes
+  problem->circularAppend(boost::make_shared<crocoddyl::ActionModelLQR>(nx, T % 2 == 0 ? 2 : 3));
+  problem->updateModel(T / 2, boost::make_shared<crocoddyl::ActionModelLQR>(nx, 3));
+  for (std::size_t k = 0; k < 2; ++k) {
+    BOOST_CHECK_NO_THROW(solver.solve(crocoddyl::DEFAULT_VECTOR, us));
+    for (std::size_t t = 0; t < T; ++t) {
+      BOOST_CHECK(static_cast<std::size_t>(solver.get_us()[t].size()) == nu_max);
+    }
+  }
+}
+
+void test_speculative_rollout(size_t T) {
+  // Create a nonlinear problem, so that the solver accepts full steps along several iterations
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> model = boost::make_shared<crocoddyl::ActionModelUnicycle>();
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > runningModels(T, model);
+  const Eigen::Vector3d x0(-1., -1., 1.);
+  crocoddyl::SolverFDDP solver(boost::make_shared<crocoddyl::ShootingProblem>(x0, runningModels, model));
+  crocoddyl::SolverFDDP solver_speculative(boost::make_shared<crocoddyl::ShootingProblem>(x0, runningModels, model));
+  solver_speculative.set_speculative(true);
+  BOOST_CHECK(solver_speculative.get_speculative());
+
+  // The speculative linearization of the accepted steps does not change the iterates
+  solver.solve();
+  solver_speculative.solve();
+  BOOST_CHECK(solver.get_iter() == solver_speculative.get_iter());
+  BOOST_CHECK_CLOSE(solver.get_cost(), solver_speculative.get_cost(), 1e-9);
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK((solver.get_xs()[t] - solver_speculative.get_xs()[t]).isZero(1e-9));
+    BOOST_CHECK((solver.get_us()[t] - solver_speculative.get_us()[t]).isZero(1e-9));
+  }
+}
+
+//____________________________________________________________________________//
+
+template <typename Solver>
+void test_square_root_backward_pass(size_t T) {
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> model = boost::make_shared<crocoddyl::ActionModelUnicycle>();
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > runningModels(T, model);
+  const Eigen::Vector3d x0(-1., -1., 1.);
+  Solver solver(boost::make_shared<crocoddyl::ShootingProblem>(x0, runningModels, model));
+  Solver solver_sqrt(boost::make_shared<crocoddyl::ShootingProblem>(x0, runningModels, model));
+  solver_sqrt.set_square_root(true);
+  BOOST_CHECK(solver_sqrt.get_square_root());
+
+  // Both Riccati recursions compute the same Value function and policy
+  solver.setCandidate();
+  solver_sqrt.setCandidate();
+  solver.computeDirection();
+  solver_sqrt.computeDirection();
+  for (std::size_t t = 0; t <= T; ++t) {
+    const Eigen::MatrixXd& S = solver_sqrt.get_Sxx()[t];
+    BOOST_CHECK((S.transpose() * S - solver_sqrt.get_Vxx()[t]).isZero(1e-7));
+    BOOST_CHECK((solver.get_Vxx()[t] - solver_sqrt.get_Vxx()[t]).isZero(1e-7));
+    BOOST_CHECK((solver.get_Vx()[t] - solver_sqrt.get_Vx()[t]).isZero(1e-7));
+  }
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK((solver.get_K()[t] - solver_sqrt.get_K()[t]).isZero(1e-7));
+    BOOST_CHECK((solver.get_k()[t] - solver_sqrt.get_k()[t]).isZero(1e-7));
+  }
+
+  // and then the same iterates
+  solver.solve();
+  solver_sqrt.solve();
+  BOOST_CHECK(solver.get_iter() == solver_sqrt.get_iter());
+  BOOST_CHECK_CLOSE(solver.get_cost(), solver_sqrt.get_cost(), 1e-6);
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK((solver.get_xs()[t] - solver_sqrt.get_xs()[t]).isZero(1e-6));
+    BOOST_CHECK((solver.get_us()[t] - solver_sqrt.get_us()[t]).isZero(1e-6));
+  }
+}
+
+//____________________________________________________________________________//
+
+void deferTask(std::vector<boost::function<void()> >& tasks, const boost::function<void()>& task) {
+  tasks.push_back(task);
+}
+
+template <typename Solver>
+void test_solve_async(size_t T) {
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> model = boost::make_shared<crocoddyl::ActionModelUnicycle>();
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > runningModels(T, model);
+  const Eigen::Vector3d x0(-1., -1., 1.);
+  Solver solver(boost::make_shared<crocoddyl::ShootingProblem>(x0, runningModels, model));
+  boost::shared_ptr<Solver> solver_async =
+      boost::make_shared<Solver>(boost::make_shared<crocoddyl::ShootingProblem>(x0, runningModels, model));
+
+  // The asynchronous solve computes the same solution than the blocking one
+  const bool converged = solver.solve();
+  boost::shared_ptr<crocoddyl::SolveHandle> handle = crocoddyl::solveAsync(solver_async);
+  BOOST_CHECK(handle->get() == converged);
+  BOOST_CHECK(handle->is_ready());
+  BOOST_CHECK(solver_async->get_iter() == solver.get_iter());
+  BOOST_CHECK_CLOSE(solver_async->get_cost(), solver.get_cost(), 1e-9);
+  BOOST_CHECK(handle->get_progress()->get_iter() == solver.get_iter() + 1);  // counts the converged iteration
+  BOOST_CHECK_CLOSE(handle->get_progress()->get_cost(), solver.get_cost(), 1e-9);
+
+  // and the solver gets back its callbacks and cancellation token
+  BOOST_CHECK(solver_async->getCallbacks().empty());
+  BOOST_CHECK(!solver_async->get_cancellation_token());
+
+  // A solve cancelled before running stops without iterating
+  std::vector<boost::function<void()> > tasks;
+  handle = crocoddyl::solveAsync(solver_async, crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 100, false,
+                                 1e-9, boost::bind(&deferTask, boost::ref(tasks), _1));
+  BOOST_CHECK(!handle->is_ready());
+  handle->cancel();
+  BOOST_CHECK(handle->is_cancelled());
+  BOOST_CHECK(tasks.size() == 1);
+  tasks[0]();
+  BOOST_CHECK(handle->is_ready());
+  BOOST_CHECK(!handle->get());
+  BOOST_CHECK(solver_async->get_iter() == 0);
+  BOOST_CHECK(handle->get_progress()->get_iter() == 0);
+}
+
+//____________________________________________________________________________//
+
+void test_solver_portfolio(size_t T) {
+  boost::shared_ptr<crocoddyl::ActionModelAbstract> model = boost::make_shared<crocoddyl::ActionModelUnicycle>();
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > runningModels(T, model);
+  const Eigen::Vector3d x0(-1., -1., 0.);
+  boost::shared_ptr<crocoddyl::ShootingProblem> problem =
+      boost::make_shared<crocoddyl::ShootingProblem>(x0, runningModels, model);
+  crocoddyl::SolverDDP solver(problem->clone());
+  BOOST_CHECK(solver.solve());
+
+  // Each solver of the portfolio owns a clone of the problem
+  crocoddyl::SolverPortfolio portfolio(problem);
+  portfolio.addSolver<crocoddyl::SolverDDP>();
+  portfolio.addSolver<crocoddyl::SolverFDDP>(crocoddyl::WarmStartRollout);
+  portfolio.addSolver<crocoddyl::SolverBoxFDDP>(crocoddyl::WarmStartQuasiStatic);
+  BOOST_CHECK(portfolio.addSolver<crocoddyl::SolverFDDP>(crocoddyl::WarmStartPrevious) == 3);
+  for (std::size_t i = 0; i < portfolio.get_solvers().size(); ++i) {
+    BOOST_CHECK(portfolio.get_solvers()[i]->get_problem() != problem);
+  }
+
+  // The first converged solver reaches the same solution, and the others are stopped
+  for (std::size_t k = 0; k < 3; ++k) {
+    BOOST_CHECK(portfolio.solve());
+    BOOST_CHECK(portfolio.get_handles()[portfolio.get_best()]->get());
+    BOOST_CHECK_CLOSE(portfolio.get_best_solver()->get_cost(), solver.get_cost(), 1e-4);
+    for (std::size_t i = 0; i < portfolio.get_handles().size(); ++i) {
+      BOOST_CHECK(portfolio.get_handles()[i]->is_ready());
+    }
+  }
+
+  // The clones follow the initial state of the problem
+  const Eigen::Vector3d x1(1., 0.5, 0.);
+  problem->set_x0(x1);
+  BOOST_CHECK(portfolio.solve());
+  BOOST_CHECK((portfolio.get_xs()[0] - x1).isZero());
+  BOOST_CHECK(portfolio.get_us().size() == T);
+}
+
+void test_solver_portfolio_heterogeneous_nodes(size_t T) {
+  // create a whole-body phase followed by a centroidal phase
+  DifferentialActionModelFactory factory;
+  const boost::shared_ptr<crocoddyl::DifferentialActionModelCentroidalFwdDynamics>& centroidalDiffModel =
+      factory.create_centroidalFwdDynamics();
+  const boost::shared_ptr<crocoddyl::ActionModelAbstract>& wholeModel =
+      boost::make_shared<crocoddyl::IntegratedActionModelEuler>(
+          factory.create_contactFwdDynamics(StateModelTypes::StateMultibody_HyQ,
+                                            ActuationModelTypes::ActuationModelFloatingBase),
+          1e-2);
+  const boost::shared_ptr<crocoddyl::ActionModelAbstract>& centroidalModel =
+      boost::make_shared<crocoddyl::IntegratedActionModelEuler>(centroidalDiffModel, 1e-2);
+  std::vector<boost::shared_ptr<crocoddyl::ActionModelAbstract> > models(T / 2, wholeModel);
+  models.push_back(boost::make_shared<crocoddyl::ActionModelCentroidalTransition>(
+      boost::static_pointer_cast<crocoddyl::StateMultibody>(wholeModel->get_state()),
+      centroidalDiffModel->get_inertia()));
+  models.resize(T, centroidalModel);
+  boost::shared_ptr<crocoddyl::ShootingProblem> problem =
+      boost::make_shared<crocoddyl::ShootingProblem>(wholeModel->get_state()->zero(), models, centroidalModel);
+
+  // the quasi-static warm start gives each node a state of its own dimension
+  crocoddyl::SolverPortfolio portfolio(problem);
+  portfolio.addSolver<crocoddyl::SolverFDDP>(crocoddyl::WarmStartQuasiStatic);
+  BOOST_CHECK_NO_THROW(portfolio.solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 1));
+  for (std::size_t i = 0; i < T; ++i) {
+    BOOST_CHECK(static_cast<std::size_t>(portfolio.get_xs()[i].size()) == models[i]->get_state()->get_nx());
+  }
+  BOOST_CHECK(static_cast<std::size_t>(portfolio.get_xs()[T].size()) == centroidalModel->get_state()->get_nx());
+}
+
+//____________________________________________________________________________//
+
 bool init_function() {
   size_t T = 10;
 
@@ -158,6 +563,66 @@ bool init_function() {
       framework::master_test_suite().add(ts);
     }
   }
+
+  for (size_t action_type = 0; action_type < ActionModelTypes::ActionModelImpulseFwdDynamics_HyQ; ++action_type) {
+    boost::test_tools::output_test_stream test_name;
+    test_name << "test_pipelined_backward_pass_" << ActionModelTypes::all[action_type];
+    test_suite* ts = BOOST_TEST_SUITE(test_name.str());
+    ts->add(BOOST_TEST_CASE(boost::bind(&test_pipelined_backward_pass, ActionModelTypes::all[action_type], T)));
+    framework::master_test_suite().add(ts);
+  }
+
+  test_suite* ts_overridden = BOOST_TEST_SUITE("test_overridden_steps");
+  ts_overridden->add(BOOST_TEST_CASE(boost::bind(&test_overridden_steps<crocoddyl::SolverDDP>, T)));
+  ts_overridden->add(BOOST_TEST_CASE(boost::bind(&test_overridden_steps<crocoddyl::SolverFDDP>, T)));
+  ts_overridden->add(BOOST_TEST_CASE(boost::bind(&test_overridden_steps<crocoddyl::SolverBoxDDP>, T)));
+  ts_overridden->add(BOOST_TEST_CASE(boost::bind(&test_overridden_steps<crocoddyl::SolverBoxFDDP>, T)));
+  ts_overridden->add(BOOST_TEST_CASE(
+      boost::bind(&test_pass_status_on_indefinite_problem<SolverCountingSteps<crocoddyl::SolverDDP> >, T)));
+  ts_overridden->add(BOOST_TEST_CASE(
+      boost::bind(&test_pass_status_on_indefinite_problem<SolverCountingSteps<crocoddyl::SolverFDDP> >, T)));
+  framework::master_test_suite().add(ts_overridden);
+
+  test_suite* ts_pass_status = BOOST_TEST_SUITE("test_pass_status");
+  ts_pass_status->add(BOOST_TEST_CASE(boost::bind(&test_pass_status_on_indefinite_problem<crocoddyl::SolverDDP>, T)));
+  ts_pass_status->add(BOOST_TEST_CASE(boost::bind(&test_pass_status_on_indefinite_problem<crocoddyl::SolverFDDP>, T)));
+  ts_pass_status->add(
+      BOOST_TEST_CASE(boost::bind(&test_pass_status_on_indefinite_problem<crocoddyl::SolverBoxDDP>, T)));
+  ts_pass_status->add(
+      BOOST_TEST_CASE(boost::bind(&test_pass_status_on_indefinite_problem<crocoddyl::SolverBoxFDDP>, T)));
+  framework::master_test_suite().add(ts_pass_status);
+
+  test_suite* ts_trial_datas = BOOST_TEST_SUITE("test_trial_datas");
+  ts_trial_datas->add(BOOST_TEST_CASE(boost::bind(&test_trial_datas_double_buffering<crocoddyl::SolverDDP>, T)));
+  ts_trial_datas->add(BOOST_TEST_CASE(boost::bind(&test_trial_datas_double_buffering<crocoddyl::SolverFDDP>, T)));
+  ts_trial_datas->add(BOOST_TEST_CASE(boost::bind(&test_trial_datas_double_buffering<crocoddyl::SolverBoxDDP>, T)));
+  ts_trial_datas->add(BOOST_TEST_CASE(boost::bind(&test_trial_datas_double_buffering<crocoddyl::SolverBoxFDDP>, T)));
+  ts_trial_datas->add(BOOST_TEST_CASE(boost::bind(&test_trial_controls_dimension<crocoddyl::SolverDDP>, T)));
+  ts_trial_datas->add(BOOST_TEST_CASE(boost::bind(&test_trial_controls_dimension<crocoddyl::SolverFDDP>, T)));
+  ts_trial_datas->add(BOOST_TEST_CASE(boost::bind(&test_trial_controls_dimension<crocoddyl::SolverBoxDDP>, T)));
+  ts_trial_datas->add(BOOST_TEST_CASE(boost::bind(&test_trial_controls_dimension<crocoddyl::SolverBoxFDDP>, T)));
+  framework::master_test_suite().add(ts_trial_datas);
+
+  test_suite* ts_speculative = BOOST_TEST_SUITE("test_speculative_rollout");
+  ts_speculative->add(BOOST_TEST_CASE(boost::bind(&test_speculative_rollout, T)));
+  framework::master_test_suite().add(ts_speculative);
+
+  test_suite* ts_square_root = BOOST_TEST_SUITE("test_square_root_backward_pass");
+  ts_square_root->add(BOOST_TEST_CASE(boost::bind(&test_square_root_backward_pass<crocoddyl::SolverDDP>, T)));
+  ts_square_root->add(BOOST_TEST_CASE(boost::bind(&test_square_root_backward_pass<crocoddyl::SolverFDDP>, T)));
+  ts_square_root->add(BOOST_TEST_CASE(boost::bind(&test_square_root_backward_pass<crocoddyl::SolverBoxFDDP>, T)));
+  framework::master_test_suite().add(ts_square_root);
+
+  test_suite* ts_async = BOOST_TEST_SUITE("test_solve_async");
+  ts_async->add(BOOST_TEST_CASE(boost::bind(&test_solve_async<crocoddyl::SolverDDP>, T)));
+  ts_async->add(BOOST_TEST_CASE(boost::bind(&test_solve_async<crocoddyl::SolverFDDP>, T)));
+  ts_async->add(BOOST_TEST_CASE(boost::bind(&test_solve_async<crocoddyl::SolverBoxFDDP>, T)));
+  framework::master_test_suite().add(ts_async);
+
+  test_suite* ts_portfolio = BOOST_TEST_SUITE("test_solver_portfolio");
+  ts_portfolio->add(BOOST_TEST_CASE(boost::bind(&test_solver_portfolio, T)));
+  ts_portfolio->add(BOOST_TEST_CASE(boost::bind(&test_solver_portfolio_heterogeneous_nodes, T)));
+  framework::master_test_suite().add(ts_portfolio);
   return true;
 }
 
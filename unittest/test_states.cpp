@@ -303,6 +303,38 @@ void test_velocity_from_Jintegrate_Jdiff(StateModelTypes::Type state_type) {
   BOOST_CHECK((J2 * eps - (-dx + dxi) / h).isMuchSmallerThan(1.0, 1e-3));
 }
 
+void test_trajectory_operations(StateModelTypes::Type state_type) {
+  StateModelFactory factory;
+  const boost::shared_ptr<crocoddyl::StateAbstract>& state = factory.create(state_type);
+  // Generating random trajectories
+  const std::size_t T = 5;
+  std::vector<Eigen::VectorXd> x0s, x1s, dxs, dxouts, xouts;
+  std::vector<Eigen::MatrixXd> Jins, Jrefs;
+  for (std::size_t i = 0; i < T; ++i) {
+    x0s.push_back(state->rand());
+    x1s.push_back(state->rand());
+    dxs.push_back(Eigen::VectorXd::Random(state->get_ndx()));
+    Jins.push_back(Eigen::MatrixXd::Random(state->get_ndx(), state->get_ndx()));
+  }
+  dxouts.resize(T, Eigen::VectorXd::Zero(state->get_ndx()));
+  xouts.resize(T, Eigen::VectorXd::Zero(state->get_nx()));
+  Jrefs = Jins;
+
+  // Checking that the trajectory operations match the node-wise ones
+  state->diffTrajectory(x0s, x1s, dxouts);
+  state->integrateTrajectory(x0s, dxs, xouts);
+  state->JintegrateTransportTrajectory(x0s, dxs, Jins, crocoddyl::second);
+  Eigen::VectorXd dx(state->get_ndx()), x(state->get_nx());
+  for (std::size_t i = 0; i < T; ++i) {
+    state->diff(x0s[i], x1s[i], dx);
+    BOOST_CHECK((dxouts[i] - dx).isMuchSmallerThan(1.0, 1e-10));
+    state->integrate(x0s[i], dxs[i], x);
+    BOOST_CHECK((xouts[i] - x).isMuchSmallerThan(1.0, 1e-10));
+    state->JintegrateTransport(x0s[i], dxs[i], Jrefs[i], crocoddyl::second);
+    BOOST_CHECK((Jins[i] - Jrefs[i]).isMuchSmallerThan(1.0, 1e-10));
+  }
+}
+
 //----------------------------------------------------------------------------//
 
 void register_state_unit_tests(StateModelTypes::Type state_type) {
@@ -322,6 +354,7 @@ void register_state_unit_tests(StateModelTypes::Type state_type) {
   ts->add(BOOST_TEST_CASE(boost::bind(&test_JintegrateTransport, state_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_Jdiff_and_Jintegrate_are_inverses, state_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_velocity_from_Jintegrate_Jdiff, state_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_trajectory_operations, state_type)));
   framework::master_test_suite().add(ts);
 }
 